@@ -45,6 +45,7 @@ pixelix.ws.Client = function(options) {
     this._cmdQueue      = [];
     this._pendingCmd    = null;
     this._onEvent       = null;
+    this._onDisplayFrame = null;
 
     this._sendCmdFromQueue = function() {
         var msg = "";
@@ -95,9 +96,14 @@ pixelix.ws.Client.prototype.connect = function(options) {
                 this._onEvent = options.onEvent;
             }
 
+            if ("function" === typeof options.onDisplayFrame) {
+                this._onDisplayFrame = options.onDisplayFrame;
+            }
+
             try {
                 wsUrl = options.protocol + "://" + options.hostname + ":" + options.port + options.endpoint;
                 this._socket = new WebSocket(wsUrl);
+                this._socket.binaryType = "arraybuffer";
 
                 this._socket.onopen = function(openEvent) {
                     console.debug("Websocket opened.");
@@ -114,8 +120,12 @@ pixelix.ws.Client.prototype.connect = function(options) {
                 };
 
                 this._socket.onmessage = function(messageEvent) {
-                    console.debug("Websocket message: " + messageEvent.data);
-                    this._onMessage(messageEvent.data);
+                    if (messageEvent.data instanceof ArrayBuffer) {
+                        this._onBinaryMessage(messageEvent.data);
+                    } else {
+                        console.debug("Websocket message: " + messageEvent.data);
+                        this._onMessage(messageEvent.data);
+                    }
                 }.bind(this);
 
             } catch (exception) {
@@ -143,6 +153,33 @@ pixelix.ws.Client.prototype.disconnect = function(options) {
     }.bind(this));
 };
 
+/* Binary messages are only used for the display stream.
+ * Format: <version> <slot-id> <width> <height> followed by the color runs <repeat> <r> <g> <b>.
+ */
+pixelix.ws.Client.prototype._onBinaryMessage = function(msg) {
+    var view        = new DataView(msg);
+    var frame       = {};
+    var HEADER_SIZE = 6;
+    var RUN_SIZE    = 4;
+    var index       = 0;
+
+    if ((HEADER_SIZE > view.byteLength) || (1 !== view.getUint8(0))) {
+        console.error("Invalid display frame received.");
+    } else if (null !== this._onDisplayFrame) {
+        frame.slotId = view.getUint8(1);
+        frame.width = view.getUint16(2, true);
+        frame.height = view.getUint16(4, true);
+        frame.data = [];
+
+        /* Provide the runs in the same format like the GETDISP response. */
+        for(index = HEADER_SIZE; (index + RUN_SIZE) <= view.byteLength; index += RUN_SIZE) {
+            frame.data.push(view.getUint32(index, false) >>> 0);
+        }
+
+        this._onDisplayFrame(frame);
+    }
+};
+
 pixelix.ws.Client.prototype._onMessage = function(msg) {
     var data        = msg.split(";");
     var status      = data.shift();
@@ -184,6 +221,9 @@ pixelix.ws.Client.prototype._onMessage = function(msg) {
                 this._pendingCmd.resolve(rsp);
             } else if ("BUTTON" === this._pendingCmd.name) {
                 this._pendingCmd.resolve(rsp);
+            } else if ("DISPSTREAM" === this._pendingCmd.name) {
+                rsp.period = parseInt(data[0]);
+                this._pendingCmd.resolve(rsp);
             } else if ("EFFECT" === this._pendingCmd.name) {
                 rsp.fadeEffect = parseInt(data[0]);
                 this._pendingCmd.resolve(rsp);
@@ -274,6 +314,25 @@ pixelix.ws.Client.prototype.getDisplayContent = function() {
     }.bind(this));
 };
 
+pixelix.ws.Client.prototype.startDisplayStream = function(period) {
+    return new Promise(function(resolve, reject) {
+        if (null === this._socket) {
+            reject();
+        } else {
+            this._sendCmd({
+                name: "DISPSTREAM",
+                par: period,
+                resolve: resolve,
+                reject: reject
+            });
+        }
+    }.bind(this));
+};
+
+pixelix.ws.Client.prototype.stopDisplayStream = function() {
+    return this.startDisplayStream(0);
+};
+
 pixelix.ws.Client.prototype.getSlots = function() {
     return new Promise(function(resolve, reject) {
         if (null === this._socket) {
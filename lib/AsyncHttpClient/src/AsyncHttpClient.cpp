@@ -63,10 +63,11 @@
 static StaticSemaphore_t gxMutexBuffer;
 
 /**
- * Counting semaphore to serialize all asynchronous HTTP client requests.
- *  This is necessary, because a secure connection needs about 50k of heap.
+ * Counting semaphore to limit the number of concurrent asynchronous HTTP client connections.
+ * This is necessary, because a secure connection needs about 50k of heap.
+ * A kept alive connection holds it too, until it is closed.
  */
-static SemaphoreHandle_t ghMutex = xSemaphoreCreateMutexStatic(&gxMutexBuffer);
+static SemaphoreHandle_t ghMutex = xSemaphoreCreateCountingStatic(CONFIG_ASYNC_HTTP_CLIENT_MAX_CONNECTIONS, CONFIG_ASYNC_HTTP_CLIENT_MAX_CONNECTIONS, &gxMutexBuffer);
 
 /******************************************************************************
  * Public Methods
@@ -81,12 +82,15 @@ AsyncHttpClient::AsyncHttpClient() :
     m_cmdQueue(),
     m_evtQueue(),
     m_mutex(),
+    m_rxMutex(),
     m_hasGlobalMutex(false),
     m_isConnected(false),
     m_isReqOpen(false),
+    m_isDirectRx(false),
     m_onRspCallback(nullptr),
     m_onClosedCallback(),
     m_onErrorCallback(),
+    m_onBodyDataCallback(),
     m_hostname(),
     m_port(0U),
     m_isSecure(false),
@@ -103,6 +107,9 @@ AsyncHttpClient::AsyncHttpClient() :
     m_rspPart(RESPONSE_PART_STATUS_LINE),
     m_rsp(),
     m_rspLine(),
+    m_rspLineLen(0U),
+    m_isRspLineOverflow(false),
+    m_isRspComplete(false),
     m_transferCoding(TRANSFER_CODING_IDENTITY),
     m_contentLength(0U),
     m_contentIndex(0U),
@@ -114,6 +121,7 @@ AsyncHttpClient::AsyncHttpClient() :
     (void)m_cmdQueue.create(CMD_QUEUE_SIZE);
     (void)m_evtQueue.create(EVT_QUEUE_SIZE);
     (void)m_mutex.create();
+    (void)m_rxMutex.create();
 
     m_tcpClient.onConnect([this](void* arg, AsyncClient* client) {
         Event evt;
@@ -158,22 +166,50 @@ AsyncHttpClient::AsyncHttpClient() :
         UTIL_NOT_USED(arg);
 
         memset(&evt, 0, sizeof(evt));
-        evt.id          = EVENT_ID_DATA;
-        evt.u.data.data = m_allocator.allocateArray(len);
 
-        if (nullptr == evt.u.data.data)
+        /* If the body data is streamed to the application, the data is parsed
+         * directly from the TCP client receive buffer without copying it.
+         * Only the complete response is handed over to the process task,
+         * which notifies the application without the receive mutex held.
+         */
+        if (true == isDirectRx())
         {
-            LOG_ERROR("Couldn't allocate %u memory.", len);
+            bool isRspComplete = false;
+
+            /* Protect against concurrent access. */
+            {
+                MutexGuard<Mutex> guard(m_rxMutex);
+
+                onData(static_cast<const uint8_t*>(data), len);
+                isRspComplete = m_isRspComplete;
+            }
 
-            evt.u.data.size = 0U;
+            if (true == isRspComplete)
+            {
+                evt.id = EVENT_ID_RESPONSE;
+
+                (void)m_evtQueue.sendToBack(evt, portMAX_DELAY);
+            }
         }
         else
         {
-            evt.u.data.size = len;
-            memcpy(evt.u.data.data, data, len);
-        }
+            evt.id          = EVENT_ID_DATA;
+            evt.u.data.data = m_allocator.allocateArray(len);
 
-        (void)m_evtQueue.sendToBack(evt, portMAX_DELAY);
+            if (nullptr == evt.u.data.data)
+            {
+                LOG_ERROR("Couldn't allocate %u memory.", len);
+
+                evt.u.data.size = 0U;
+            }
+            else
+            {
+                evt.u.data.size = len;
+                memcpy(evt.u.data.data, data, len);
+            }
+
+            (void)m_evtQueue.sendToBack(evt, portMAX_DELAY);
+        }
     });
 
     m_tcpClient.onTimeout([this](void* arg, AsyncClient* client, uint32_t timeout) {
@@ -202,6 +238,7 @@ AsyncHttpClient::~AsyncHttpClient()
     end();
 
     /* Destroy at the end. */
+    m_rxMutex.destroy();
     m_mutex.destroy();
     m_evtQueue.destroy();
     m_cmdQueue.destroy();
@@ -444,6 +481,13 @@ void AsyncHttpClient::regOnError(const OnError& onError)
     m_onErrorCallback = onError;
 }
 
+void AsyncHttpClient::regOnBodyData(const OnBodyData& onBodyData)
+{
+    MutexGuard<Mutex> guard(m_rxMutex);
+
+    m_onBodyDataCallback = onBodyData;
+}
+
 bool AsyncHttpClient::GET()
 {
     Cmd cmd;
@@ -636,7 +680,27 @@ void AsyncHttpClient::processCmdQueue()
         }
         else
         {
-            giveGlobalMutex();
+            bool isReqOpen = false;
+
+            /* Protect against concurrent access. */
+            {
+                MutexGuard<Mutex> guard(m_mutex);
+
+                isReqOpen = m_isReqOpen;
+            }
+
+            /* A connection in establishment or a kept alive connection still
+             * holds the global mutex. Otherwise the number of established
+             * secure connections could exceed the limit, because an idle kept
+             * alive connection keeps its heap. A user of several clients, like
+             * a client pool, shall close an idle connection, before it sends a
+             * request with another client.
+             */
+            if ((false == isReqOpen) &&
+                (false == m_tcpClient.connected()))
+            {
+                giveGlobalMutex();
+            }
         }
     }
 }
@@ -662,7 +726,12 @@ void AsyncHttpClient::processEvtQueue()
             break;
 
         case EVENT_ID_DATA:
-            onData(evt.u.data.data, evt.u.data.size);
+            /* Protect against concurrent access. */
+            {
+                MutexGuard<Mutex> guard(m_rxMutex);
+
+                onData(evt.u.data.data, evt.u.data.size);
+            }
 
             if (nullptr != evt.u.data.data)
             {
@@ -670,12 +739,18 @@ void AsyncHttpClient::processEvtQueue()
                 evt.u.data.data = nullptr;
                 evt.u.data.size = 0U;
             }
+
+            handleCompleteResponse();
             break;
 
         case EVENT_ID_TIMEOUT:
             onTimeout(evt.u.timeout);
             break;
 
+        case EVENT_ID_RESPONSE:
+            handleCompleteResponse();
+            break;
+
         default:
             break;
         };
@@ -784,7 +859,10 @@ void AsyncHttpClient::onData(const uint8_t* data, size_t len)
      *                [ message-body ]
      */
 
-    while ((len > index) && (false == isError))
+    /* Data after a complete response is discarded until it is notified,
+     * because only one request is in flight.
+     */
+    while ((len > index) && (false == isError) && (false == m_isRspComplete))
     {
         switch (m_rspPart)
         {
@@ -831,11 +909,10 @@ void AsyncHttpClient::onData(const uint8_t* data, size_t len)
             {
                 if (true == parseChunkedResponse(data, len, index))
                 {
-                    notifyResponse();
-
                     m_transferCoding = TRANSFER_CODING_IDENTITY;
                     m_rspPart        = RESPONSE_PART_STATUS_LINE;
-                    m_rsp.clear();
+
+                    onResponse();
                 }
             }
             else
@@ -853,7 +930,7 @@ void AsyncHttpClient::onData(const uint8_t* data, size_t len)
                     copySize = available;
                 }
 
-                if (false == m_rsp.addPayload(&data[index], copySize))
+                if (false == addPayload(&data[index], copySize))
                 {
                     LOG_FATAL("Couldn't allocate memory for payload.");
                     m_tcpClient.close();
@@ -866,12 +943,11 @@ void AsyncHttpClient::onData(const uint8_t* data, size_t len)
 
                     if (m_contentLength <= m_contentIndex)
                     {
-                        notifyResponse();
-
-                        m_rspPart = RESPONSE_PART_STATUS_LINE;
-                        m_rsp.clear();
+                        m_rspPart       = RESPONSE_PART_STATUS_LINE;
                         m_contentLength = 0U;
                         m_contentIndex  = 0U;
+
+                        onResponse();
                     }
                 }
             }
@@ -883,6 +959,50 @@ void AsyncHttpClient::onData(const uint8_t* data, size_t len)
             isError = true;
             break;
         }
+
+        if ((false == isError) &&
+            (true == m_isRspLineOverflow))
+        {
+            LOG_ERROR("Response line too long.");
+            m_tcpClient.close();
+            isError = true;
+        }
+    }
+}
+
+bool AsyncHttpClient::isDirectRx()
+{
+    MutexGuard<Mutex> guard(m_mutex);
+    bool              isDirectRx = m_isDirectRx;
+
+    return isDirectRx;
+}
+
+void AsyncHttpClient::onResponse()
+{
+    m_isRspComplete = true;
+}
+
+void AsyncHttpClient::handleCompleteResponse()
+{
+    HttpResponse rsp;
+    bool         isRspComplete = false;
+
+    /* Protect against concurrent access. */
+    {
+        MutexGuard<Mutex> guard(m_rxMutex);
+
+        if (true == m_isRspComplete)
+        {
+            rsp.swap(m_rsp);
+            m_isRspComplete = false;
+            isRspComplete   = true;
+        }
+    }
+
+    if (true == isRspComplete)
+    {
+        notifyResponse(rsp);
     }
 }
 
@@ -1002,7 +1122,8 @@ bool AsyncHttpClient::postRequest(const uint8_t* payload, size_t size)
 
 bool AsyncHttpClient::sendRequest()
 {
-    bool        status = false;
+    bool        status     = false;
+    bool        isDirectRx = false;
     String      request;
     const char* PROTOCOL  = "HTTP";
     const char* SP        = " ";
@@ -1137,6 +1258,21 @@ bool AsyncHttpClient::sendRequest()
     request += m_headers;
     request += CRLF;
 
+    /* Protect against concurrent access. */
+    {
+        MutexGuard<Mutex> guard(m_rxMutex);
+
+        isDirectRx = (nullptr != m_onBodyDataCallback);
+    }
+
+    /* Protect against concurrent access. */
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        /* Streamed body data is parsed directly in the TCP client context. */
+        m_isDirectRx = isDirectRx;
+    }
+
     /* Send header */
     status   = (request.length() == m_tcpClient.write(request.c_str(), request.length()));
 
@@ -1160,54 +1296,113 @@ void AsyncHttpClient::clear()
     m_headers.clear();
     m_urlEncodedPars.clear();
 
-    m_rspPart = RESPONSE_PART_STATUS_LINE;
-    m_rsp.clear();
-    m_rspLine.clear();
-    m_transferCoding = TRANSFER_CODING_IDENTITY;
-    m_contentLength  = 0U;
-    m_contentIndex   = 0U;
-    m_chunkSize      = 0U;
-    m_chunkIndex     = 0U;
-    m_chunkBodyPart  = CHUNK_SIZE;
+    /* Protect against concurrent access. */
+    {
+        MutexGuard<Mutex> guard(m_rxMutex);
+
+        m_rspPart = RESPONSE_PART_STATUS_LINE;
+        m_rsp.clear();
+        m_rspLineLen        = 0U;
+        m_isRspLineOverflow = false;
+        m_isRspComplete     = false;
+        m_transferCoding    = TRANSFER_CODING_IDENTITY;
+        m_contentLength     = 0U;
+        m_contentIndex      = 0U;
+        m_chunkSize         = 0U;
+        m_chunkIndex        = 0U;
+        m_chunkBodyPart     = CHUNK_SIZE;
+    }
 
     /* Protect against concurrent access. */
     {
         MutexGuard<Mutex> guard(m_mutex);
 
-        m_isReqOpen = false;
+        m_isReqOpen  = false;
+        m_isDirectRx = false;
     }
 }
 
-bool AsyncHttpClient::isEOL(const String& str, size_t& len)
+bool AsyncHttpClient::readLine(const char* data, size_t len, size_t& index)
 {
-    bool       isEOL             = false;
-    const char TERMINATOR_LF[]   = "\n";
-    const char TERMINATOR_CRLF[] = "\r\n";
+    bool        isEOL     = false;
+    size_t      available = len - index;
+    size_t      lineLen   = available;
+    size_t      freeSize  = RSP_LINE_SIZE - 1U - m_rspLineLen;
+    const void* vLF       = memchr(&data[index], '\n', available);
 
-    len                          = 0U;
+    if (nullptr != vLF)
+    {
+        lineLen = static_cast<const char*>(vLF) - &data[index];
+        isEOL   = true;
+    }
 
-    /* RFC7230 - 3.5. Message Parsing Robustness
-     * Although the line terminator for the start-line and header fields is
-     * the sequence CRLF, a recipient MAY recognize a single LF as a line
-     * terminator and ignore any preceding CR.
+    /* A line, which doesn't fit into the line buffer, is not truncated.
+     * The rest of the data is skipped and the caller fails the response.
      */
-    if (0U != str.endsWith(TERMINATOR_LF))
+    if (lineLen > freeSize)
     {
-        isEOL = true;
+        m_isRspLineOverflow = true;
+        index               = len;
+        isEOL               = false;
+    }
+    else
+    {
+        memcpy(&m_rspLine[m_rspLineLen], &data[index], lineLen);
+        m_rspLineLen += lineLen;
+        index        += lineLen;
+    }
 
-        if (0U != str.endsWith(TERMINATOR_CRLF))
-        {
-            len = 2U;
-        }
-        else
+    if (true == isEOL)
+    {
+        /* Overstep LF */
+        ++index;
+
+        /* RFC7230 - 3.5. Message Parsing Robustness
+         * Although the line terminator for the start-line and header fields is
+         * the sequence CRLF, a recipient MAY recognize a single LF as a line
+         * terminator and ignore any preceding CR.
+         */
+        if ((0U < m_rspLineLen) &&
+            ('\r' == m_rspLine[m_rspLineLen - 1U]))
         {
-            len = 1U;
+            --m_rspLineLen;
         }
     }
 
+    m_rspLine[m_rspLineLen] = '\0';
+
     return isEOL;
 }
 
+void AsyncHttpClient::addRspHeader()
+{
+    char* value    = strchr(m_rspLine, ':');
+    char* valueEnd = &m_rspLine[m_rspLineLen];
+
+    /* Header = field-name ":" OWS field-value OWS */
+    if (nullptr != value)
+    {
+        /* Split the line in place to avoid any temporary string. */
+        *value = '\0';
+        ++value;
+
+        while ((' ' == *value) || ('\t' == *value))
+        {
+            ++value;
+        }
+
+        while ((value < valueEnd) &&
+               ((' ' == valueEnd[-1]) || ('\t' == valueEnd[-1])))
+        {
+            --valueEnd;
+        }
+
+        *valueEnd = '\0';
+
+        m_rsp.addHeader(m_rspLine, value);
+    }
+}
+
 bool AsyncHttpClient::handleRspHeader()
 {
     bool   isSuccess = true;
@@ -1270,23 +1465,14 @@ bool AsyncHttpClient::parseChunkedResponseSize(const char* data, size_t len, siz
 {
     bool isSizeEOF = false;
 
-    while ((len > index) && (false == isSizeEOF))
+    if (true == readLine(data, len, index))
     {
-        size_t terminatorLen  = 0U;
+        m_chunkSize = Util::hexToUInt32(m_rspLine);
 
-        m_rspLine            += data[index];
-        ++index;
+        LOG_INFO("Chunk size is %u byte.", m_chunkSize);
 
-        if (true == isEOL(m_rspLine, terminatorLen))
-        {
-            m_rspLine.remove(m_rspLine.length() - terminatorLen);
-            m_chunkSize = Util::hexToUInt32(m_rspLine);
-
-            LOG_INFO("Chunk size is %u byte.", m_chunkSize);
-
-            m_rspLine.clear();
-            isSizeEOF = true;
-        }
+        m_rspLineLen = 0U;
+        isSizeEOF    = true;
     }
 
     return isSizeEOF;
@@ -1308,7 +1494,7 @@ bool AsyncHttpClient::parseChunkedResponseChunkData(const uint8_t* data, size_t
         copySize = available;
     }
 
-    if (false == m_rsp.addPayload(&data[index], copySize))
+    if (false == addPayload(&data[index], copySize))
     {
         LOG_FATAL("Couldn't add chunk payload.");
 
@@ -1335,18 +1521,10 @@ bool AsyncHttpClient::parseChunkedResponseChunkDataEnd(const char* data, size_t
 {
     bool isDataEOF = false;
 
-    while ((len > index) && (false == isDataEOF))
+    if (true == readLine(data, len, index))
     {
-        size_t terminatorLen  = 0U;
-
-        m_rspLine            += data[index];
-        ++index;
-
-        if (true == isEOL(m_rspLine, terminatorLen))
-        {
-            m_rspLine.clear();
-            isDataEOF = true;
-        }
+        m_rspLineLen = 0U;
+        isDataEOF    = true;
     }
 
     return isDataEOF;
@@ -1358,18 +1536,11 @@ bool AsyncHttpClient::parseChunkedResponseTrailer(const char* data, size_t len,
 
     while ((len > index) && (false == isTrailerEOF))
     {
-        size_t terminatorLen  = 0U;
-
-        m_rspLine            += data[index];
-        ++index;
-
-        if (true == isEOL(m_rspLine, terminatorLen))
+        if (true == readLine(data, len, index))
         {
-            if (terminatorLen < m_rspLine.length())
+            if (0U < m_rspLineLen)
             {
-                m_rspLine.remove(m_rspLine.length() - terminatorLen);
-
-                LOG_DEBUG("Rsp. trailer: %s", m_rspLine.c_str());
+                LOG_DEBUG("Rsp. trailer: %s", m_rspLine);
             }
             else
             {
@@ -1378,7 +1549,7 @@ bool AsyncHttpClient::parseChunkedResponseTrailer(const char* data, size_t len,
                 isTrailerEOF = true;
             }
 
-            m_rspLine.clear();
+            m_rspLineLen = 0U;
         }
     }
 
@@ -1425,8 +1596,11 @@ bool AsyncHttpClient::parseChunkedResponse(const uint8_t* data, size_t len, size
                 {
                     m_chunkBodyPart = CHUNK_DATA;
 
-                    /* Extend response payload */
-                    m_rsp.extendPayload(m_chunkSize);
+                    /* Extend response payload, if it is not streamed. */
+                    if (nullptr == m_onBodyDataCallback)
+                    {
+                        m_rsp.extendPayload(m_chunkSize);
+                    }
                 }
             }
             break;
@@ -1469,22 +1643,12 @@ bool AsyncHttpClient::parseRspStatusLine(const char* data, size_t len, size_t& i
 {
     bool isStatusLineEOF = false;
 
-    while ((len > index) && (false == isStatusLineEOF))
+    if (true == readLine(data, len, index))
     {
-        size_t terminatorLen  = 0U;
-
-        m_rspLine            += data[index];
-        ++index;
-
-        if (true == isEOL(m_rspLine, terminatorLen))
-        {
-            m_rspLine.remove(m_rspLine.length() - terminatorLen);
-
-            m_rsp.addStatusLine(m_rspLine);
+        m_rsp.addStatusLine(m_rspLine);
 
-            isStatusLineEOF = true;
-            m_rspLine.clear();
-        }
+        isStatusLineEOF = true;
+        m_rspLineLen    = 0U;
     }
 
     return isStatusLineEOF;
@@ -1496,38 +1660,31 @@ bool AsyncHttpClient::parseRspHeader(const char* data, size_t len, size_t& index
 
     while ((len > index) && (false == isHeaderEOF))
     {
-        size_t terminatorLen  = 0U;
-
-        m_rspLine            += data[index];
-        ++index;
-
-        if (true == isEOL(m_rspLine, terminatorLen))
+        if (true == readLine(data, len, index))
         {
-            if (terminatorLen < m_rspLine.length())
+            if (0U < m_rspLineLen)
             {
-                m_rspLine.remove(m_rspLine.length() - terminatorLen);
-
-                LOG_DEBUG("Rsp. header: %s", m_rspLine.c_str());
+                LOG_DEBUG("Rsp. header: %s", m_rspLine);
 
-                m_rsp.addHeader(m_rspLine);
+                addRspHeader();
             }
             else
             {
                 isHeaderEOF = true;
             }
 
-            m_rspLine.clear();
+            m_rspLineLen = 0U;
         }
     }
 
     return isHeaderEOF;
 }
 
-void AsyncHttpClient::notifyResponse()
+void AsyncHttpClient::notifyResponse(const HttpResponse& rsp)
 {
     if (nullptr != m_onRspCallback)
     {
-        m_onRspCallback(m_rsp);
+        m_onRspCallback(rsp);
     }
 }
 
@@ -1547,6 +1704,22 @@ void AsyncHttpClient::notifyError()
     }
 }
 
+bool AsyncHttpClient::addPayload(const uint8_t* data, size_t size)
+{
+    bool isSuccessful = true;
+
+    if (nullptr != m_onBodyDataCallback)
+    {
+        m_onBodyDataCallback(data, size);
+    }
+    else
+    {
+        isSuccessful = m_rsp.addPayload(data, size);
+    }
+
+    return isSuccessful;
+}
+
 String AsyncHttpClient::urlEncode(const String& str)
 {
     String     encodedStr;
@@ -1683,9 +1856,9 @@ const char* AsyncHttpClient::errorToStr(int8_t error)
 
 bool AsyncHttpClient::takeGlobalMutex()
 {
-    bool isTaken = false;
+    bool isTaken = m_hasGlobalMutex;
 
-    if (false == m_hasGlobalMutex)
+    if (false == isTaken)
     {
         const uint32_t MAX_WAIT_TIME = 100U; /* ms */
 
@@ -41,6 +41,11 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_ASYNC_HTTP_CLIENT_MAX_CONNECTIONS
+/** Max. number of connections, which all asynchronous HTTP clients may hold at the same time. */
+#define CONFIG_ASYNC_HTTP_CLIENT_MAX_CONNECTIONS 1U
+#endif /* CONFIG_ASYNC_HTTP_CLIENT_MAX_CONNECTIONS */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -87,6 +92,11 @@ public:
      */
     typedef std::function<void()> OnError;
 
+    /**
+     * Prototype of HTTP response callback for received body data.
+     */
+    typedef std::function<void(const uint8_t* data, size_t size)> OnBodyData;
+
     /**
      * Constructs a http client.
      */
@@ -184,6 +194,23 @@ public:
      */
     void regOnError(const OnError& onError);
 
+    /**
+     * Register callback function on received body data.
+     * If registered, the body data is streamed to the callback chunk by chunk
+     * and not collected in the response. The response callback is still called
+     * after the complete response, but without payload.
+     *
+     * The body data is parsed directly in the TCP client context and the
+     * callback gets it without any intermediate copy. Therefore the callback
+     * shall return as fast as possible. It is called with the receive mutex
+     * held, which is taken by begin(), end() and regOnBodyData() too. The
+     * callback must not wait for a lock, which the caller of these methods
+     * may hold, otherwise it will deadlock.
+     *
+     * @param[in] onBodyData    Callback
+     */
+    void regOnBodyData(const OnBodyData& onBodyData);
+
     /**
      * Send GET request to host.
      *
@@ -234,6 +261,12 @@ private:
      */
     static const size_t EVT_QUEUE_SIZE             = 10U;
 
+    /**
+     * Max. length of a response line (status line, header, chunk size, trailer)
+     * incl. string termination. A longer line fails the response.
+     */
+    static const size_t RSP_LINE_SIZE              = 256U;
+
     /**
      * Command ids are used to identify what the user requests.
      */
@@ -277,7 +310,8 @@ private:
         EVENT_ID_DISCONNECTED,  /**< Connection is disconnected. */
         EVENT_ID_ERROR,         /**< A error happened. */
         EVENT_ID_DATA,          /**< Data is received. */
-        EVENT_ID_TIMEOUT        /**< A connection timeout happened. */
+        EVENT_ID_TIMEOUT,       /**< A connection timeout happened. */
+        EVENT_ID_RESPONSE       /**< A response is completely received in the TCP client context. */
 
     };
 
@@ -358,16 +392,19 @@ private:
     Queue<Cmd>            m_cmdQueue;       /**< Command queue */
     Queue<Event>          m_evtQueue;       /**< Event queue */
     Mutex                 m_mutex;          /**< Used to protect against concurrent access. */
+    Mutex                 m_rxMutex;        /**< Protects the response parsing state, which the TCP client and the process task access. */
     bool                  m_hasGlobalMutex; /**< Has the task the global mutex? */
 
     /* Protected data */
     bool m_isConnected; /**< Is a connection established? */
     bool m_isReqOpen;   /**< Is a request open? */
+    bool m_isDirectRx;  /**< Is the response parsed directly in the TCP client context? */
 
     /* Non-protected data */
     OnResponse     m_onRspCallback;       /**< Callback which to call for a complete response. */
     OnClosed       m_onClosedCallback;    /**< Callback which to call for a closed connection. */
     OnError        m_onErrorCallback;     /**< Callback which to call for a connection error. */
+    OnBodyData     m_onBodyDataCallback;  /**< Callback which to call for received body data. Protected by the receive mutex. */
     String         m_hostname;            /**< Server hostname */
     uint16_t       m_port;                /**< Server port */
     bool           m_isSecure;            /**< Secure transport (true) or not (false) */
@@ -382,9 +419,13 @@ private:
     const uint8_t* m_payload;             /**< Request payload */
     size_t         m_payloadSize;         /**< Request payload size in byte */
 
+    /* Response parsing data, protected by the receive mutex. */
     ResponsePart   m_rspPart;        /**< Current parsing part of the response */
     HttpResponse   m_rsp;            /**< Response */
-    String         m_rspLine;        /**< Single line, used for response parsing */
+    char           m_rspLine[RSP_LINE_SIZE]; /**< Single line, used for response parsing */
+    size_t         m_rspLineLen;     /**< Length of the single line in byte */
+    bool           m_isRspLineOverflow; /**< Is the single line longer than the line buffer? */
+    bool           m_isRspComplete;  /**< Is the response completely received, but not notified yet? */
     TransferCoding m_transferCoding; /**< Transfer coding */
     size_t         m_contentLength;  /**< Content length in byte */
     size_t         m_contentIndex;   /**< Content index */
@@ -454,12 +495,34 @@ private:
 
     /**
      * This method is called if data is received.
+     * It shall be called only with the receive mutex taken.
      *
      * @param[in] data      Data stream
      * @param[in] len       Data size in byte
      */
     void onData(const uint8_t* data, size_t len);
 
+    /**
+     * Is the response parsed directly in the TCP client context?
+     *
+     * @return If directly parsed, it will return true otherwise false.
+     */
+    bool isDirectRx();
+
+    /**
+     * This method is called if a response is completely received.
+     * It only marks the response as complete, because the application is
+     * notified later without the receive mutex held.
+     */
+    void onResponse();
+
+    /**
+     * Notify the application about a completely received response.
+     * The response is taken over from the parser without copying it, before
+     * the application is called without the receive mutex held.
+     */
+    void handleCompleteResponse();
+
     /**
      * This method is called if ACK timeout happens.
      *
@@ -514,14 +577,21 @@ private:
     void clear();
 
     /**
-     * Is line terminator detected?
+     * Read a response line into the line buffer, until the line terminator is
+     * detected. The line terminator itself is not stored.
      *
-     * @param[in]   str String
-     * @param[out]  len Length of terminator
+     * @param[in]       data    Data stream
+     * @param[in]       len     Data size in byte
+     * @param[in,out]   index   Current data index
      *
      * @return If line terminator detected, it will return true otherwise false.
      */
-    bool isEOL(const String& str, size_t& len);
+    bool readLine(const char* data, size_t len, size_t& index);
+
+    /**
+     * Add the header in the line buffer to the response.
+     */
+    void addRspHeader();
 
     /**
      * Handle response header.
@@ -611,8 +681,10 @@ private:
      * This method will be called for every complete response and provides
      * it to the application, depended on whether a application callback
      * function is registered or not.
+     *
+     * @param[in] rsp   Response
      */
-    void notifyResponse();
+    void notifyResponse(const HttpResponse& rsp);
 
     /**
      * This method will be called for a closed connection and notifies the
@@ -628,6 +700,17 @@ private:
      */
     void notifyError();
 
+    /**
+     * Add received body data to the response or stream it to the application,
+     * depended on whether a application callback function is registered or not.
+     *
+     * @param[in] data  Body data
+     * @param[in] size  Body data size in byte
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool addPayload(const uint8_t* data, size_t size);
+
     /**
      * URL encode string (RFC1738 section 2.2)
      *
@@ -647,11 +730,11 @@ private:
     const char* errorToStr(int8_t error);
 
     /**
-     * Take global mutex to serialize all AsyncHttpClient's.
-     * Attention, the task which takes the global mutex must give it back as well.
-     * Its not allowed that one task takes the global mutex and another task gives it back.
+     * Take global mutex to limit the number of connections of all AsyncHttpClient's.
+     * It is held as long as the connection exists, which includes a kept alive
+     * connection between two requests.
      *
-     * @return If taken, it will return true otherwise false. If already taken, it will return false.
+     * @return If taken, it will return true otherwise false. If already taken, it will return true.
      */
     bool takeGlobalMutex();
 
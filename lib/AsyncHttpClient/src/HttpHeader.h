@@ -82,6 +82,18 @@ public:
     {
     }
 
+    /**
+     * Constructs header, based on the given values.
+     *
+     * @param[in] name  Field name
+     * @param[in] value Field value
+     */
+    HttpHeader(const char* name, const char* value) :
+        m_name(name),
+        m_value(value)
+    {
+    }
+
     /**
      * Constructs a header, based on a single header line.
      *
@@ -95,6 +95,20 @@ HttpResponse& HttpResponse::operator=(const HttpResponse& rsp)
     return *this;
 }
 
+void HttpResponse::swap(HttpResponse& rsp)
+{
+    if (this != &rsp)
+    {
+        std::swap(m_httpVersion, rsp.m_httpVersion);
+        std::swap(m_statusCode, rsp.m_statusCode);
+        std::swap(m_reasonPhrase, rsp.m_reasonPhrase);
+        m_headers.swap(rsp.m_headers);
+        std::swap(m_payload, rsp.m_payload);
+        std::swap(m_size, rsp.m_size);
+        std::swap(m_wrIndex, rsp.m_wrIndex);
+    }
+}
+
 void HttpResponse::clear()
 {
     clearHeaders();
@@ -165,6 +179,11 @@ void HttpResponse::addHeader(const String& line)
     m_headers.emplace_back(line);
 }
 
+void HttpResponse::addHeader(const char* name, const char* value)
+{
+    m_headers.emplace_back(name, value);
+}
+
 bool HttpResponse::extendPayload(size_t size)
 {
     DataAllocator allocator;
@@ -227,7 +246,7 @@ String HttpResponse::getReasonPhrase() const
     return m_reasonPhrase;
 }
 
-String HttpResponse::getHeader(const String& name)
+String HttpResponse::getHeader(const String& name) const
 {
     String value;
 
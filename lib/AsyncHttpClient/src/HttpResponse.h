@@ -46,6 +46,7 @@
  *****************************************************************************/
 #include <WString.h>
 #include <vector>
+#include <utility>
 #include <TypedAllocator.hpp>
 #include <PsAllocator.hpp>
 
@@ -114,6 +115,14 @@ public:
      */
     HttpResponse& operator=(const HttpResponse& rsp);
 
+    /**
+     * Exchange the content with a different response.
+     * In contrast to the assignment, the payload is not copied.
+     *
+     * @param[in,out] rsp   Response
+     */
+    void swap(HttpResponse& rsp);
+
     /**
      * Clear response.
      */
@@ -133,6 +142,14 @@ public:
      */
     void addHeader(const String& line);
 
+    /**
+     * Add header during parsing the response.
+     *
+     * @param[in] name  Field name
+     * @param[in] value Field value
+     */
+    void addHeader(const char* name, const char* value);
+
     /**
      * Extend payload size in bytes.
      *
@@ -180,7 +197,7 @@ public:
      * 
      * @return Field value
      */
-    String getHeader(const String& name);
+    String getHeader(const String& name) const;
 
     /**
      * Get payload.
@@ -47,6 +47,7 @@
 #include <stdint.h>
 #include "BaseGfx.hpp"
 #include "BaseGfxBrush.hpp"
+#include "GlyphCache.hpp"
 #include "gfxfont.h"
 
 /******************************************************************************
@@ -72,7 +73,8 @@ public:
      * Note, until no GFXfont is assigned, it can not draw any character.
      */
     BaseFont() :
-        m_gfxFont(nullptr)
+        m_gfxFont(nullptr),
+        m_cachedFont(nullptr)
     {
     }
 
@@ -82,7 +84,8 @@ public:
      * @param[in] font  Font, which to copy.
      */
     BaseFont(const BaseFont& font) :
-        m_gfxFont(font.m_gfxFont)
+        m_gfxFont(font.m_gfxFont),
+        m_cachedFont(font.m_cachedFont)
     {
     }
 
@@ -92,7 +95,8 @@ public:
      * @param[in] gfxFont   GFXfont
      */
     BaseFont(const GFXfont* gfxFont) :
-        m_gfxFont(gfxFont)
+        m_gfxFont(gfxFont),
+        m_cachedFont(nullptr)
     {
     }
 
@@ -114,7 +118,8 @@ public:
     {
         if (&font != this)
         {
-            m_gfxFont = font.m_gfxFont;
+            m_gfxFont    = font.m_gfxFont;
+            m_cachedFont = font.m_cachedFont;
         }
 
         return *this;
@@ -137,7 +142,11 @@ public:
      */
     void setGfxFont(const GFXfont* gfxFont)
     {
-        m_gfxFont = gfxFont;
+        if (m_gfxFont != gfxFont)
+        {
+            m_gfxFont    = gfxFont;
+            m_cachedFont = nullptr;
+        }
     }
 
     /**
@@ -246,37 +255,36 @@ public:
             /* Is character available in the font? Note, carriage return is skipped. */
             if (nullptr != glyph)
             {
+                int16_t glyphX = cursorX + glyph->xOffset;
+                int16_t glyphY = cursorY + glyph->yOffset;
+
                 /* Handle character only, if it is really drawn on the screen. */
-                if (0 <= (cursorX + glyph->xAdvance))
+                if ((0 <= (cursorX + glyph->xAdvance)) &&
+                    (0 < (glyphX + glyph->width)) &&
+                    (gfx.getWidth() > glyphX) &&
+                    (0 < (glyphY + glyph->height)) &&
+                    (gfx.getHeight() > glyphY))
                 {
-                    int16_t  x             = 0;
-                    int16_t  y             = 0;
-                    uint16_t bitmapOffset  = glyph->bitmapOffset;
-                    uint8_t  bitmapRowBits = 0U;
-                    uint8_t  bitCnt        = 0U;
+                    if (nullptr == m_cachedFont)
+                    {
+                        m_cachedFont = GlyphCache::getFont(m_gfxFont);
+                    }
 
-                    for (y = 0U; y < glyph->height; ++y)
+                    /* Not cached, because of missing memory? */
+                    if (nullptr == m_cachedFont)
                     {
-                        for (x = 0U; x < glyph->width; ++x)
+                        drawGlyphBitmap(gfx, glyphX, glyphY, *glyph, brush);
+                    }
+                    else
+                    {
+                        const GlyphCache::Glyph& cachedGlyph = m_cachedFont->glyphs[uChar - m_gfxFont->first];
+                        uint16_t                 idx         = 0U;
+
+                        for (idx = 0U; idx < cachedGlyph.spanCount; ++idx)
                         {
-                            /* Every 8 bit, the bitmap offset must be increased. */
-                            if (0U == (bitCnt & 0x07))
-                            {
-                                bitmapRowBits = m_gfxFont->bitmap[bitmapOffset];
-                                ++bitmapOffset;
-                            }
-                            ++bitCnt;
-
-                            /* A 1b in the bitmap row bits must be drawn as single pixel. */
-                            if (0U != (bitmapRowBits & 0x80U))
-                            {
-                                int16_t xPos = cursorX + x + glyph->xOffset;
-                                int16_t yPos = cursorY + y + glyph->yOffset;
-
-                                gfx.drawPixel(xPos, yPos, brush.getColor(xPos, yPos));
-                            }
-
-                            bitmapRowBits <<= 1U;
+                            const GlyphCache::Span& span = m_cachedFont->spans[cachedGlyph.firstSpan + idx];
+
+                            drawSpan(gfx, glyphX + span.x, glyphY + span.y, span.length, brush);
                         }
                     }
                 }
@@ -293,7 +301,147 @@ public:
 
 private:
 
-    const GFXfont* m_gfxFont; /**< Current selected graphics font, based on Adafruit GFXfont format. */
+    const GFXfont*          m_gfxFont;    /**< Current selected graphics font, based on Adafruit GFXfont format. */
+    const GlyphCache::Font* m_cachedFont; /**< The decoded glyphs of the font or nullptr, if not requested yet. */
+
+    /**
+     * Draw a glyph by decoding its bitmap.
+     *
+     * @param[in] gfx       Graphics interface
+     * @param[in] glyphX    x-coordinate of the glyph upper left corner
+     * @param[in] glyphY    y-coordinate of the glyph upper left corner
+     * @param[in] glyph     Glyph which to draw
+     * @param[in] brush     Brush to draw the glyph.
+     */
+    void drawGlyphBitmap(BaseGfx<TColor>& gfx, int16_t glyphX, int16_t glyphY, const GFXglyph& glyph, const BaseGfxBrush<TColor>& brush)
+    {
+        int16_t  x             = 0;
+        int16_t  y             = 0;
+        uint16_t bitmapOffset  = glyph.bitmapOffset;
+        uint8_t  bitmapRowBits = 0U;
+        uint8_t  bitCnt        = 0U;
+
+        for (y = 0U; y < glyph.height; ++y)
+        {
+            for (x = 0U; x < glyph.width; ++x)
+            {
+                /* Every 8 bit, the bitmap offset must be increased. */
+                if (0U == (bitCnt & 0x07))
+                {
+                    bitmapRowBits = m_gfxFont->bitmap[bitmapOffset];
+                    ++bitmapOffset;
+                }
+                ++bitCnt;
+
+                /* A 1b in the bitmap row bits must be drawn as single pixel. */
+                if (0U != (bitmapRowBits & 0x80U))
+                {
+                    int16_t xPos = glyphX + x;
+                    int16_t yPos = glyphY + y;
+
+                    gfx.drawPixel(xPos, yPos, brush.getColor(xPos, yPos));
+                }
+
+                bitmapRowBits <<= 1U;
+            }
+        }
+    }
+
+    /**
+     * Draw a horizontal span of a glyph. The span is clipped at the borders.
+     *
+     * @param[in] gfx       Graphics interface
+     * @param[in] x         x-coordinate of the span start
+     * @param[in] y         y-coordinate of the span
+     * @param[in] length    Span length in pixel
+     * @param[in] brush     Brush to draw the span.
+     */
+    void drawSpan(BaseGfx<TColor>& gfx, int16_t x, int16_t y, uint16_t length, const BaseGfxBrush<TColor>& brush)
+    {
+        int16_t width = static_cast<int16_t>(gfx.getWidth());
+
+        if ((0 <= y) &&
+            (gfx.getHeight() > y))
+        {
+            /* Clip at the left border. */
+            if (0 > x)
+            {
+                uint16_t skip = static_cast<uint16_t>(-x);
+
+                length = (length > skip) ? (length - skip) : 0U;
+                x      = 0;
+            }
+
+            /* Clip at the right border. */
+            if (width < (x + length))
+            {
+                length = (width > x) ? static_cast<uint16_t>(width - x) : 0U;
+            }
+        }
+        else
+        {
+            length = 0U;
+        }
+
+        /* Anything to draw? */
+        if (0U < length)
+        {
+            uint16_t dstOffset  = 0U;
+            TColor*  dstAddress = gfx.getFrameBufferXAddr(x, y, length, dstOffset);
+            bool     isSolid    = brush.isSolid();
+            TColor   color      = brush.getColor(x, y);
+            uint16_t idx        = 0U;
+
+            if (nullptr == dstAddress)
+            {
+                while (length > idx)
+                {
+                    if ((false == isSolid) && (0U < idx))
+                    {
+                        color = brush.getColor(x + idx, y);
+                    }
+
+                    gfx.drawPixel(x + idx, y, color);
+
+                    ++idx;
+                }
+            }
+            else
+            {
+                uint16_t first = length;
+                uint16_t last  = 0U;
+
+                while (length > idx)
+                {
+                    TColor& dst = dstAddress[idx * dstOffset];
+
+                    if ((false == isSolid) && (0U < idx))
+                    {
+                        color = brush.getColor(x + idx, y);
+                    }
+
+                    if (color != dst)
+                    {
+                        dst = color;
+
+                        if (length == first)
+                        {
+                            first = idx;
+                        }
+
+                        last = idx;
+                    }
+
+                    ++idx;
+                }
+
+                if (length > first)
+                {
+                    gfx.markDirty(x + first, y, last - first + 1U, 1U);
+                }
+            }
+        }
+    }
 };
 
 /******************************************************************************
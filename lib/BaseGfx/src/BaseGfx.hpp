@@ -187,6 +187,30 @@ public:
      */
     virtual const TColor* getFrameBufferYAddr(int16_t x, int16_t y, uint16_t length, uint16_t& offset) const = 0;
 
+    /**
+     * Mark a rectangular region as changed. All drawing functions of the
+     * base graphics call it only for pixels whose color really changed,
+     * so the receiver is able to update only the modified part of e.g. a
+     * physical display.
+     *
+     * If the pixels are manipulated directly via getColor() or the
+     * framebuffer address, the caller is responsible to mark them.
+     *
+     * The default implementation discards the information.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Region width in pixel
+     * @param[in] height    Region height in pixel
+     */
+    virtual void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height)
+    {
+        (void)x;
+        (void)y;
+        (void)width;
+        (void)height;
+    }
+
     /**
      * Copy from source, starting at upper left corner (0, 0).
      *
@@ -200,8 +224,9 @@ public:
      */
     void copy(const BaseGfx<TColor>& gfx)
     {
-        uint16_t minWidth  = std::min(getWidth(), gfx.getWidth());
-        uint16_t minHeight = std::min(getHeight(), gfx.getHeight());
+        uint16_t    minWidth  = std::min(getWidth(), gfx.getWidth());
+        uint16_t    minHeight = std::min(getHeight(), gfx.getHeight());
+        DirtyRegion dirtyRegion;
 
         /* For better performance choose larger side for the internal
          * copy operation.
@@ -212,7 +237,7 @@ public:
 
             for (y = 0; y < minHeight; ++y)
             {
-                internalCopyX(0, y, minWidth, gfx, 0, y);
+                internalCopyX(0, y, minWidth, gfx, 0, y, dirtyRegion);
             }
         }
         else
@@ -221,9 +246,34 @@ public:
 
             for (x = 0; x < minWidth; ++x)
             {
-                internalCopyY(x, 0, minHeight, gfx, x, 0);
+                internalCopyY(x, 0, minHeight, gfx, x, 0, dirtyRegion);
             }
         }
+
+        markDirtyRegion(dirtyRegion);
+    }
+
+    /**
+     * Copy from source with the given intensity, starting at upper left
+     * corner (0, 0). The source itself is not changed, which makes it
+     * suitable for non-destructive fading independent of the color format.
+     *
+     * @param[in] gfx       Graphics interface of source
+     * @param[in] intensity Intensity [0; 255] - 0: min. bright / 255: max. bright
+     */
+    void copy(const BaseGfx<TColor>& gfx, uint8_t intensity)
+    {
+        uint16_t    minWidth  = std::min(getWidth(), gfx.getWidth());
+        uint16_t    minHeight = std::min(getHeight(), gfx.getHeight());
+        int16_t     y;
+        DirtyRegion dirtyRegion;
+
+        for (y = 0; y < minHeight; ++y)
+        {
+            internalCopyX(0, y, minWidth, gfx, 0, y, intensity, dirtyRegion);
+        }
+
+        markDirtyRegion(dirtyRegion);
     }
 
     /**
@@ -242,19 +292,10 @@ public:
         /* Anything to draw? */
         if (0U < height)
         {
-            uint16_t dstOffset  = 0U;
-            TColor*  dstAddress = getFrameBufferYAddr(x, y, height, dstOffset);
+            DirtyRegion dirtyRegion;
 
-            if (nullptr != dstAddress)
-            {
-                uint16_t idx = 0U;
-
-                while (height > idx)
-                {
-                    dstAddress[idx * dstOffset] = color;
-                    ++idx;
-                }
-            }
+            internalFillY(x, y, height, color, dirtyRegion);
+            markDirtyRegion(dirtyRegion);
         }
     }
 
@@ -274,19 +315,10 @@ public:
         /* Anything to draw? */
         if (0U < width)
         {
-            uint16_t dstOffset  = 0U;
-            TColor*  dstAddress = getFrameBufferXAddr(x, y, width, dstOffset);
-
-            if (nullptr != dstAddress)
-            {
-                uint16_t idx = 0U;
+            DirtyRegion dirtyRegion;
 
-                while (width > idx)
-                {
-                    dstAddress[idx * dstOffset] = color;
-                    ++idx;
-                }
-            }
+            internalFillX(x, y, width, color, dirtyRegion);
+            markDirtyRegion(dirtyRegion);
         }
     }
 
@@ -418,6 +450,8 @@ public:
         if ((0U < width) &&
             (0U < height))
         {
+            DirtyRegion dirtyRegion;
+
             /* For better performance choose larger side for the draw
              * operation.
              */
@@ -427,7 +461,7 @@ public:
 
                 for (yIndex = 0; yIndex < height; ++yIndex)
                 {
-                    drawHLine(x, y + yIndex, width, color);
+                    internalFillX(x, y + yIndex, width, color, dirtyRegion);
                 }
             }
             else
@@ -436,9 +470,11 @@ public:
 
                 for (xIndex = 0; xIndex < width; ++xIndex)
                 {
-                    drawVLine(x + xIndex, y, height, color);
+                    internalFillY(x + xIndex, y, height, color, dirtyRegion);
                 }
             }
+
+            markDirtyRegion(dirtyRegion);
         }
     }
 
@@ -506,8 +542,21 @@ public:
      */
     void drawBitmap(int16_t x, int16_t y, const BaseGfxBitmap<TColor>& bitmap)
     {
-        uint16_t minWidth  = std::min(bitmap.getWidth(), getWidth());
-        uint16_t minHeight = std::min(bitmap.getHeight(), getHeight());
+        uint16_t minWidth  = bitmap.getWidth();
+        uint16_t minHeight = bitmap.getHeight();
+        int16_t  srcX      = 0;
+        int16_t  srcY      = 0;
+
+        /* If the bitmap starts outside the canvas, only its remaining part is drawn. */
+        if (0 > x)
+        {
+            srcX = -x;
+        }
+
+        if (0 > y)
+        {
+            srcY = -y;
+        }
 
         adaptCoordAndLength(x, minWidth, getWidth());
         adaptCoordAndLength(y, minHeight, getHeight());
@@ -516,6 +565,8 @@ public:
         if ((0U < minWidth) &&
             (0U < minHeight))
         {
+            DirtyRegion dirtyRegion;
+
             /* For better performance choose larger side for the internal
              * copy operation.
              */
@@ -525,7 +576,7 @@ public:
 
                 for (yIndex = 0; yIndex < minHeight; ++yIndex)
                 {
-                    internalCopyX(x, y + yIndex, minWidth, bitmap, 0, yIndex);
+                    internalCopyX(x, y + yIndex, minWidth, bitmap, srcX, srcY + yIndex, dirtyRegion);
                 }
             }
             else
@@ -534,9 +585,11 @@ public:
 
                 for (xIndex = 0; xIndex < minWidth; ++xIndex)
                 {
-                    internalCopyY(x + xIndex, y, minHeight, bitmap, xIndex, 0);
+                    internalCopyY(x + xIndex, y, minHeight, bitmap, srcX + xIndex, srcY, dirtyRegion);
                 }
             }
+
+            markDirtyRegion(dirtyRegion);
         }
     }
 
@@ -556,8 +609,21 @@ public:
      */
     void drawBitmap(int16_t x, int16_t y, const BaseGfxBitmap<TColor>& bitmap, const TColor& transparentColor)
     {
-        uint16_t minWidth  = std::min(bitmap.getWidth(), getWidth());
-        uint16_t minHeight = std::min(bitmap.getHeight(), getHeight());
+        uint16_t minWidth  = bitmap.getWidth();
+        uint16_t minHeight = bitmap.getHeight();
+        int16_t  srcX      = 0;
+        int16_t  srcY      = 0;
+
+        /* If the bitmap starts outside the canvas, only its remaining part is drawn. */
+        if (0 > x)
+        {
+            srcX = -x;
+        }
+
+        if (0 > y)
+        {
+            srcY = -y;
+        }
 
         adaptCoordAndLength(x, minWidth, getWidth());
         adaptCoordAndLength(y, minHeight, getHeight());
@@ -566,6 +632,8 @@ public:
         if ((0U < minWidth) &&
             (0U < minHeight))
         {
+            DirtyRegion dirtyRegion;
+
             /* For better performance choose larger side for the internal
              * copy operation.
              */
@@ -575,7 +643,7 @@ public:
 
                 for (yIndex = 0; yIndex < minHeight; ++yIndex)
                 {
-                    internalCopyX(x, y + yIndex, minWidth, bitmap, 0, yIndex, transparentColor);
+                    internalCopyX(x, y + yIndex, minWidth, bitmap, srcX, srcY + yIndex, transparentColor, dirtyRegion);
                 }
             }
             else
@@ -584,9 +652,11 @@ public:
 
                 for (xIndex = 0; xIndex < minWidth; ++xIndex)
                 {
-                    internalCopyY(x + xIndex, y, minHeight, bitmap, xIndex, 0, transparentColor);
+                    internalCopyY(x + xIndex, y, minHeight, bitmap, srcX + xIndex, srcY, transparentColor, dirtyRegion);
                 }
             }
+
+            markDirtyRegion(dirtyRegion);
         }
     }
 
@@ -633,10 +703,8 @@ private:
         /* Negative */
         else
         {
-            length = std::min(length, maxLength);
-
             /* Out of bounds? */
-            if (static_cast<uint16_t>(-coord) > length)
+            if (static_cast<uint16_t>(-coord) >= length)
             {
                 length = 0U;
                 coord  = 0;
@@ -644,23 +712,290 @@ private:
             else
             {
                 length -= static_cast<uint16_t>(-coord);
+                length  = std::min(length, maxLength);
                 coord   = 0;
             }
         }
     }
 
+    /**
+     * Bounding box of the pixels, which were changed by a drawing operation.
+     * It is used to mark the destination dirty only once per operation.
+     */
+    struct DirtyRegion
+    {
+        bool    isDirty; /**< Is any pixel changed? */
+        int16_t x1;      /**< Upper left x-coordinate */
+        int16_t y1;      /**< Upper left y-coordinate */
+        int16_t x2;      /**< Lower right x-coordinate (inclusive) */
+        int16_t y2;      /**< Lower right y-coordinate (inclusive) */
+
+        /**
+         * Constructs a empty region.
+         */
+        DirtyRegion() :
+            isDirty(false),
+            x1(0),
+            y1(0),
+            x2(0),
+            y2(0)
+        {
+        }
+
+        /**
+         * Add a changed rectangular region.
+         *
+         * @param[in] x         x-coordinate of upper left point
+         * @param[in] y         y-coordinate of upper left point
+         * @param[in] width     Region width in pixel
+         * @param[in] height    Region height in pixel
+         */
+        void add(int16_t x, int16_t y, uint16_t width, uint16_t height)
+        {
+            int16_t xEnd = x + static_cast<int16_t>(width) - 1;
+            int16_t yEnd = y + static_cast<int16_t>(height) - 1;
+
+            if (false == isDirty)
+            {
+                x1      = x;
+                y1      = y;
+                x2      = xEnd;
+                y2      = yEnd;
+                isDirty = true;
+            }
+            else
+            {
+                x1 = std::min(x1, x);
+                y1 = std::min(y1, y);
+                x2 = std::max(x2, xEnd);
+                y2 = std::max(y2, yEnd);
+            }
+        }
+    };
+
+    /**
+     * Mark the region dirty, which was changed by a drawing operation.
+     *
+     * @param[in] dirtyRegion   The changed region.
+     */
+    void markDirtyRegion(const DirtyRegion& dirtyRegion)
+    {
+        if (true == dirtyRegion.isDirty)
+        {
+            markDirty(dirtyRegion.x1,
+                dirtyRegion.y1,
+                static_cast<uint16_t>(dirtyRegion.x2 - dirtyRegion.x1 + 1),
+                static_cast<uint16_t>(dirtyRegion.y2 - dirtyRegion.y1 + 1));
+        }
+    }
+
+    /**
+     * Fill pixels with a color. Only pixels with a different color are
+     * changed.
+     *
+     * If the pixels are contiguous in memory, the unchanged pixels at both
+     * ends are skipped and the remaining block is filled at once.
+     *
+     * @param[in]   dstAddress  Address of the first pixel.
+     * @param[in]   dstOffset   Address offset in pixel to the next pixel.
+     * @param[in]   length      Number of pixels.
+     * @param[in]   color       Color
+     * @param[out]  first       Index of the first changed pixel. If no pixel is changed, it will be length.
+     * @param[out]  last        Index of the last changed pixel.
+     */
+    static void fillPixels(TColor* dstAddress, uint16_t dstOffset, uint16_t length, const TColor& color, uint16_t& first, uint16_t& last)
+    {
+        first = length;
+        last  = 0U;
+
+        if (1U == dstOffset)
+        {
+            uint16_t idx = 0U;
+
+            while ((length > idx) && (color == dstAddress[idx]))
+            {
+                ++idx;
+            }
+
+            if (length > idx)
+            {
+                first = idx;
+                last  = length - 1U;
+
+                /* Stops latest at the first changed pixel. */
+                while (color == dstAddress[last])
+                {
+                    --last;
+                }
+
+                std::fill(&dstAddress[first], &dstAddress[last + 1U], color);
+            }
+        }
+        else
+        {
+            uint16_t idx = 0U;
+
+            while (length > idx)
+            {
+                TColor& dst = dstAddress[idx * dstOffset];
+
+                if (color != dst)
+                {
+                    dst = color;
+
+                    if (length == first)
+                    {
+                        first = idx;
+                    }
+
+                    last = idx;
+                }
+
+                ++idx;
+            }
+        }
+    }
+
+    /**
+     * Copy pixels from a source. Only pixels with a different color are
+     * changed.
+     *
+     * If the pixels of source and destination are contiguous in memory, the
+     * unchanged pixels at both ends are skipped and the remaining block is
+     * copied at once.
+     *
+     * @param[in]   dstAddress  Address of the first destination pixel.
+     * @param[in]   dstOffset   Address offset in pixel to the next destination pixel.
+     * @param[in]   srcAddress  Address of the first source pixel.
+     * @param[in]   srcOffset   Address offset in pixel to the next source pixel.
+     * @param[in]   length      Number of pixels.
+     * @param[out]  first       Index of the first changed pixel. If no pixel is changed, it will be length.
+     * @param[out]  last        Index of the last changed pixel.
+     */
+    static void copyPixels(TColor* dstAddress, uint16_t dstOffset, const TColor* srcAddress, uint16_t srcOffset, uint16_t length, uint16_t& first, uint16_t& last)
+    {
+        first = length;
+        last  = 0U;
+
+        if ((1U == dstOffset) &&
+            (1U == srcOffset))
+        {
+            uint16_t idx = 0U;
+
+            while ((length > idx) && (srcAddress[idx] == dstAddress[idx]))
+            {
+                ++idx;
+            }
+
+            if (length > idx)
+            {
+                first = idx;
+                last  = length - 1U;
+
+                /* Stops latest at the first changed pixel. */
+                while (srcAddress[last] == dstAddress[last])
+                {
+                    --last;
+                }
+
+                std::copy(&srcAddress[first], &srcAddress[last + 1U], &dstAddress[first]);
+            }
+        }
+        else
+        {
+            uint16_t idx = 0U;
+
+            while (length > idx)
+            {
+                TColor&       dstColor = dstAddress[idx * dstOffset];
+                const TColor& srcColor = srcAddress[idx * srcOffset];
+
+                if (srcColor != dstColor)
+                {
+                    dstColor = srcColor;
+
+                    if (length == first)
+                    {
+                        first = idx;
+                    }
+
+                    last = idx;
+                }
+
+                ++idx;
+            }
+        }
+    }
+
+    /**
+     * Fill pixels along the x-axis with a color.
+     *
+     * @param[in]       x           Destination x-coordinate.
+     * @param[in]       y           Destination y-coordinate.
+     * @param[in]       width       Number of pixels which to fill.
+     * @param[in]       color       Color
+     * @param[in, out]  dirtyRegion The changed pixels are added to it.
+     */
+    void internalFillX(int16_t x, int16_t y, uint16_t width, const TColor& color, DirtyRegion& dirtyRegion)
+    {
+        uint16_t dstOffset  = 0U;
+        TColor*  dstAddress = getFrameBufferXAddr(x, y, width, dstOffset);
+
+        if (nullptr != dstAddress)
+        {
+            uint16_t first = width;
+            uint16_t last  = 0U;
+
+            fillPixels(dstAddress, dstOffset, width, color, first, last);
+
+            if (width > first)
+            {
+                dirtyRegion.add(x + first, y, last - first + 1U, 1U);
+            }
+        }
+    }
+
+    /**
+     * Fill pixels along the y-axis with a color.
+     *
+     * @param[in]       x           Destination x-coordinate.
+     * @param[in]       y           Destination y-coordinate.
+     * @param[in]       height      Number of pixels which to fill.
+     * @param[in]       color       Color
+     * @param[in, out]  dirtyRegion The changed pixels are added to it.
+     */
+    void internalFillY(int16_t x, int16_t y, uint16_t height, const TColor& color, DirtyRegion& dirtyRegion)
+    {
+        uint16_t dstOffset  = 0U;
+        TColor*  dstAddress = getFrameBufferYAddr(x, y, height, dstOffset);
+
+        if (nullptr != dstAddress)
+        {
+            uint16_t first = height;
+            uint16_t last  = 0U;
+
+            fillPixels(dstAddress, dstOffset, height, color, first, last);
+
+            if (height > first)
+            {
+                dirtyRegion.add(x, y + first, 1U, last - first + 1U);
+            }
+        }
+    }
+
     /**
      * Copies pixels along the x-axis from a source at given coordinates to the
      * destination at given coordinates.
      *
-     * @param[in] x         Destination x-coordinate.
-     * @param[in] y         Destination y-coordinate.
-     * @param[in] width     Number of pixels which to copy.
-     * @param[in] src       Source to copy from.
-     * @param[in] srcX      Source x-coordinate.
-     * @param[in] srcY      Source y-coordinate.
+     * @param[in]      x           Destination x-coordinate.
+     * @param[in]      y           Destination y-coordinate.
+     * @param[in]      width       Number of pixels which to copy.
+     * @param[in]      src         Source to copy from.
+     * @param[in]      srcX        Source x-coordinate.
+     * @param[in]      srcY        Source y-coordinate.
+     * @param[in, out] dirtyRegion The changed pixels are added to it.
      */
-    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY)
+    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, DirtyRegion& dirtyRegion)
     {
         uint16_t      dstOffset  = 0U;
         uint16_t      srcOffset  = 0U;
@@ -670,13 +1005,72 @@ private:
         if ((nullptr != dstAddress) &&
             (nullptr != srcAddress))
         {
-            uint16_t idx = 0U;
+            uint16_t first = width;
+            uint16_t last  = 0U;
+
+            copyPixels(dstAddress, dstOffset, srcAddress, srcOffset, width, first, last);
+
+            if (width > first)
+            {
+                dirtyRegion.add(x + first, y, last - first + 1U, 1U);
+            }
+        }
+    }
+
+    /**
+     * Copies pixels along the x-axis from a source at given coordinates to the
+     * destination at given coordinates. The intensity is applied to the copied
+     * pixels only.
+     *
+     * @param[in]      x           Destination x-coordinate.
+     * @param[in]      y           Destination y-coordinate.
+     * @param[in]      width       Number of pixels which to copy.
+     * @param[in]      src         Source to copy from.
+     * @param[in]      srcX        Source x-coordinate.
+     * @param[in]      srcY        Source y-coordinate.
+     * @param[in]      intensity   Intensity [0; 255] - 0: min. bright / 255: max. bright
+     * @param[in, out] dirtyRegion The changed pixels are added to it.
+     */
+    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, uint8_t intensity, DirtyRegion& dirtyRegion)
+    {
+        uint16_t      dstOffset  = 0U;
+        uint16_t      srcOffset  = 0U;
+        TColor*       dstAddress = getFrameBufferXAddr(x, y, width, dstOffset);
+        const TColor* srcAddress = src.getFrameBufferXAddr(srcX, srcY, width, srcOffset);
+
+        if ((nullptr != dstAddress) &&
+            (nullptr != srcAddress))
+        {
+            uint16_t idx   = 0U;
+            uint16_t first = width;
+            uint16_t last  = 0U;
 
             while (width > idx)
             {
-                dstAddress[idx * dstOffset] = srcAddress[idx * srcOffset];
+                TColor& dst   = dstAddress[idx * dstOffset];
+                TColor  color = srcAddress[idx * srcOffset];
+
+                color.setIntensity(intensity);
+
+                if (color != dst)
+                {
+                    dst = color;
+
+                    if (width == first)
+                    {
+                        first = idx;
+                    }
+
+                    last = idx;
+                }
+
                 ++idx;
             }
+
+            if (width > first)
+            {
+                dirtyRegion.add(x + first, y, last - first + 1U, 1U);
+            }
         }
     }
 
@@ -685,15 +1079,16 @@ private:
      * destination at given coordinates. If the source pixel color matches the
      * transparent color, it will not be copied.
      *
-     * @param[in] x                 Destination x-coordinate.
-     * @param[in] y                 Destination y-coordinate.
-     * @param[in] width             Number of pixels which to copy.
-     * @param[in] src               Source to copy from.
-     * @param[in] srcX              Source x-coordinate.
-     * @param[in] srcY              Source y-coordinate.
-     * @param[in] transparentColor  Color which shall be treated as transparent.
+     * @param[in]      x                Destination x-coordinate.
+     * @param[in]      y                Destination y-coordinate.
+     * @param[in]      width            Number of pixels which to copy.
+     * @param[in]      src              Source to copy from.
+     * @param[in]      srcX             Source x-coordinate.
+     * @param[in]      srcY             Source y-coordinate.
+     * @param[in]      transparentColor Color which shall be treated as transparent.
+     * @param[in, out] dirtyRegion      The changed pixels are added to it.
      */
-    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, const TColor& transparentColor)
+    void internalCopyX(int16_t x, int16_t y, uint16_t width, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, const TColor& transparentColor, DirtyRegion& dirtyRegion)
     {
         uint16_t      dstOffset  = 0U;
         uint16_t      srcOffset  = 0U;
@@ -703,19 +1098,35 @@ private:
         if ((nullptr != dstAddress) &&
             (nullptr != srcAddress))
         {
-            uint16_t idx = 0U;
+            uint16_t idx   = 0U;
+            uint16_t first = width;
+            uint16_t last  = 0U;
 
             while (width > idx)
             {
-                const TColor* color = &srcAddress[idx * srcOffset];
+                TColor&       dstColor = dstAddress[idx * dstOffset];
+                const TColor& srcColor = srcAddress[idx * srcOffset];
 
-                if (transparentColor != (*color))
+                if ((transparentColor != srcColor) &&
+                    (srcColor != dstColor))
                 {
-                    dstAddress[idx * dstOffset] = srcAddress[idx * srcOffset];
+                    dstColor = srcColor;
+
+                    if (width == first)
+                    {
+                        first = idx;
+                    }
+
+                    last = idx;
                 }
 
                 ++idx;
             }
+
+            if (width > first)
+            {
+                dirtyRegion.add(x + first, y, last - first + 1U, 1U);
+            }
         }
     }
 
@@ -723,14 +1134,15 @@ private:
      * Copies pixels along the y-axis from a source at given coordinates to the
      * destination at given coordinates.
      *
-     * @param[in] x         Destination x-coordinate.
-     * @param[in] y         Destination y-coordinate.
-     * @param[in] height    Number of pixels which to copy.
-     * @param[in] src       Source to copy from.
-     * @param[in] srcX      Source x-coordinate.
-     * @param[in] srcY      Source y-coordinate.
+     * @param[in]      x           Destination x-coordinate.
+     * @param[in]      y           Destination y-coordinate.
+     * @param[in]      height      Number of pixels which to copy.
+     * @param[in]      src         Source to copy from.
+     * @param[in]      srcX        Source x-coordinate.
+     * @param[in]      srcY        Source y-coordinate.
+     * @param[in, out] dirtyRegion The changed pixels are added to it.
      */
-    void internalCopyY(int16_t x, int16_t y, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY)
+    void internalCopyY(int16_t x, int16_t y, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, DirtyRegion& dirtyRegion)
     {
         uint16_t      dstOffset  = 0U;
         uint16_t      srcOffset  = 0U;
@@ -740,12 +1152,14 @@ private:
         if ((nullptr != dstAddress) &&
             (nullptr != srcAddress))
         {
-            uint16_t idx = 0U;
+            uint16_t first = height;
+            uint16_t last  = 0U;
 
-            while (height > idx)
+            copyPixels(dstAddress, dstOffset, srcAddress, srcOffset, height, first, last);
+
+            if (height > first)
             {
-                dstAddress[idx * dstOffset] = srcAddress[idx * srcOffset];
-                ++idx;
+                dirtyRegion.add(x, y + first, 1U, last - first + 1U);
             }
         }
     }
@@ -755,15 +1169,16 @@ private:
      * destination at given coordinates. If the source pixel color matches the
      * transparent color, it will not be copied.
      *
-     * @param[in] x                 Destination x-coordinate.
-     * @param[in] y                 Destination y-coordinate.
-     * @param[in] height            Number of pixels which to copy.
-     * @param[in] src               Source to copy from.
-     * @param[in] srcX              Source x-coordinate.
-     * @param[in] srcY              Source y-coordinate.
-     * @param[in] transparentColor  Color which shall be treated as transparent.
+     * @param[in]      x                Destination x-coordinate.
+     * @param[in]      y                Destination y-coordinate.
+     * @param[in]      height           Number of pixels which to copy.
+     * @param[in]      src              Source to copy from.
+     * @param[in]      srcX             Source x-coordinate.
+     * @param[in]      srcY             Source y-coordinate.
+     * @param[in]      transparentColor Color which shall be treated as transparent.
+     * @param[in, out] dirtyRegion      The changed pixels are added to it.
      */
-    void internalCopyY(int16_t x, int16_t y, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, const TColor& transparentColor)
+    void internalCopyY(int16_t x, int16_t y, uint16_t height, const BaseGfx<TColor>& src, int16_t srcX, int16_t srcY, const TColor& transparentColor, DirtyRegion& dirtyRegion)
     {
         uint16_t      dstOffset  = 0U;
         uint16_t      srcOffset  = 0U;
@@ -773,19 +1188,35 @@ private:
         if ((nullptr != dstAddress) &&
             (nullptr != srcAddress))
         {
-            uint16_t idx = 0U;
+            uint16_t idx   = 0U;
+            uint16_t first = height;
+            uint16_t last  = 0U;
 
             while (height > idx)
             {
-                const TColor* color = &srcAddress[idx * srcOffset];
+                TColor&       dstColor = dstAddress[idx * dstOffset];
+                const TColor& srcColor = srcAddress[idx * srcOffset];
 
-                if (transparentColor != (*color))
+                if ((transparentColor != srcColor) &&
+                    (srcColor != dstColor))
                 {
-                    dstAddress[idx * dstOffset] = srcAddress[idx * srcOffset];
+                    dstColor = srcColor;
+
+                    if (height == first)
+                    {
+                        first = idx;
+                    }
+
+                    last = idx;
                 }
 
                 ++idx;
             }
+
+            if (height > first)
+            {
+                dirtyRegion.add(x, y + first, 1U, last - first + 1U);
+            }
         }
     }
 };
@@ -80,17 +80,123 @@ public:
     {
     }
 
+    /**
+     * Mark a rectangular region as changed. It will be merged with the
+     * already dirty region to its bounding box.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Region width in pixel
+     * @param[in] height    Region height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) override
+    {
+        if ((0U < width) &&
+            (0U < height))
+        {
+            int16_t x2 = x + static_cast<int16_t>(width) - 1;
+            int16_t y2 = y + static_cast<int16_t>(height) - 1;
+
+            if (false == m_isDirty)
+            {
+                m_dirtyX1 = x;
+                m_dirtyY1 = y;
+                m_dirtyX2 = x2;
+                m_dirtyY2 = y2;
+                m_isDirty = true;
+            }
+            else
+            {
+                m_dirtyX1 = std::min(m_dirtyX1, x);
+                m_dirtyY1 = std::min(m_dirtyY1, y);
+                m_dirtyX2 = std::max(m_dirtyX2, x2);
+                m_dirtyY2 = std::max(m_dirtyY2, y2);
+            }
+        }
+    }
+
+    /**
+     * Mark the whole bitmap as changed.
+     */
+    void markAllDirty()
+    {
+        markDirty(0, 0, this->getWidth(), this->getHeight());
+    }
+
+    /**
+     * Is any pixel changed since the last clearDirty()?
+     *
+     * @return If a region is dirty, it will return true otherwise false.
+     */
+    bool isDirty() const
+    {
+        return m_isDirty;
+    }
+
+    /**
+     * Get the bounding box of all changed pixels since the last clearDirty().
+     * The region is limited to the bitmap.
+     *
+     * @param[out] x        x-coordinate of upper left point
+     * @param[out] y        y-coordinate of upper left point
+     * @param[out] width    Region width in pixel
+     * @param[out] height   Region height in pixel
+     *
+     * @return If a region is dirty, it will return true otherwise false.
+     */
+    bool getDirtyRegion(int16_t& x, int16_t& y, uint16_t& width, uint16_t& height) const
+    {
+        bool    isDirty = false;
+        int16_t x1      = std::max(m_dirtyX1, static_cast<int16_t>(0));
+        int16_t y1      = std::max(m_dirtyY1, static_cast<int16_t>(0));
+        int16_t x2      = std::min(m_dirtyX2, static_cast<int16_t>(this->getWidth() - 1));
+        int16_t y2      = std::min(m_dirtyY2, static_cast<int16_t>(this->getHeight() - 1));
+
+        if ((true == m_isDirty) &&
+            (x1 <= x2) &&
+            (y1 <= y2))
+        {
+            x       = x1;
+            y       = y1;
+            width   = static_cast<uint16_t>(x2 - x1 + 1);
+            height  = static_cast<uint16_t>(y2 - y1 + 1);
+            isDirty = true;
+        }
+
+        return isDirty;
+    }
+
+    /**
+     * Forget the dirty region, e.g. after it was transferred to the
+     * physical display.
+     */
+    void clearDirty()
+    {
+        m_isDirty = false;
+    }
+
 protected:
 
     /**
      * Constructs a bitmap.
+     * A new bitmap is considered as completely dirty.
      */
-    BaseGfxBitmap()
+    BaseGfxBitmap() :
+        m_isDirty(true),
+        m_dirtyX1(0),
+        m_dirtyY1(0),
+        m_dirtyX2(INT16_MAX),
+        m_dirtyY2(INT16_MAX)
     {
     }
 
 private:
 
+    bool    m_isDirty;  /**< Is a region dirty? */
+    int16_t m_dirtyX1;  /**< Dirty region upper left x-coordinate */
+    int16_t m_dirtyY1;  /**< Dirty region upper left y-coordinate */
+    int16_t m_dirtyX2;  /**< Dirty region lower right x-coordinate (inclusive) */
+    int16_t m_dirtyY2;  /**< Dirty region lower right y-coordinate (inclusive) */
 };
 
 /**
@@ -157,6 +263,8 @@ public:
                     ++idx;
                 }
             }
+
+            BaseGfxBitmap<TColor>::markAllDirty();
         }
 
         return *this;
@@ -245,7 +353,13 @@ public:
             (width > x) &&
             (height > y))
         {
-            m_pixels[pixelMap(x, y)] = color;
+            TColor& pixel = m_pixels[pixelMap(x, y)];
+
+            if (color != pixel)
+            {
+                pixel = color;
+                BaseGfxBitmap<TColor>::markDirty(x, y, 1U, 1U);
+            }
         }
     }
 
@@ -509,6 +623,8 @@ public:
                         ++idx;
                     }
                 }
+
+                BaseGfxBitmap<TColor>::markAllDirty();
             }
         }
 
@@ -537,6 +653,8 @@ public:
                 m_width     = width;
                 m_height    = height;
 
+                BaseGfxBitmap<TColor>::markAllDirty();
+
                 isSuccessful = true;
             }
         }
@@ -640,7 +758,13 @@ public:
             (m_width > x) &&
             (m_height > y))
         {
-            m_pixels[pixelMap(x, y)] = color;
+            TColor& pixel = m_pixels[pixelMap(x, y)];
+
+            if (color != pixel)
+            {
+                pixel = color;
+                BaseGfxBitmap<TColor>::markDirty(x, y, 1U, 1U);
+            }
         }
     }
 
@@ -95,6 +95,17 @@ public:
      */
     virtual void setIntensity(uint8_t intensity)        = 0;
 
+    /**
+     * Is the color independent of the position?
+     * If true, the color can be requested once for several pixels.
+     *
+     * @return If the color is independent of the position, it will return true otherwise false.
+     */
+    virtual bool isSolid() const
+    {
+        return false;
+    }
+
 protected:
 
     /**
@@ -120,7 +131,8 @@ public:
      */
     BaseGfxSolidBrush() :
         BaseGfxBrush<TColor>(),
-        m_color()
+        m_color(),
+        m_intensity(m_color.getIntensity())
     {
     }
 
@@ -131,7 +143,8 @@ public:
      */
     BaseGfxSolidBrush(const TColor& color) :
         BaseGfxBrush<TColor>(),
-        m_color(color)
+        m_color(color),
+        m_intensity(color.getIntensity())
     {
     }
 
@@ -152,9 +165,14 @@ public:
      */
     TColor getColor(int16_t x, int16_t y) const override
     {
+        TColor color = m_color;
+
         (void)x;
         (void)y;
-        return m_color;
+
+        color.setIntensity(m_intensity);
+
+        return color;
     }
 
     /**
@@ -164,17 +182,30 @@ public:
      */
     uint8_t getIntensity() const override
     {
-        return m_color.getIntensity();
+        return m_intensity;
     }
 
     /**
      * Set brush intensity.
+     * The intensity is kept separate from the color and applied only to the
+     * color provided for drawing. This way it works with color formats, which
+     * apply the intensity destructive too.
      *
      * @param[in] intensity Brush intensity [0; 255] - 0: min. bright / 255: max. bright.
      */
     void setIntensity(uint8_t intensity) override
     {
-        m_color.setIntensity(intensity);
+        m_intensity = intensity;
+    }
+
+    /**
+     * Is the color independent of the position?
+     *
+     * @return Always true, because its a single color.
+     */
+    bool isSolid() const override
+    {
+        return true;
     }
 
     /**
@@ -194,12 +225,14 @@ public:
      */
     void setColor(const TColor& color)
     {
-        m_color = color;
+        m_color     = color;
+        m_intensity = color.getIntensity();
     }
 
 private:
 
-    TColor m_color; /**< Color of the brush. */
+    TColor  m_color;     /**< Color of the brush. */
+    uint8_t m_intensity; /**< Brush intensity [0; 255] - 0: min. bright / 255: max. bright. */
 };
 
 /**
@@ -222,7 +255,8 @@ public:
         m_endColor(),
         m_offset(0),
         m_gradientLength(32U),    /* Default gradient length in pixels. */
-        m_verticalGradient(false) /* Default horizontal gradient. */
+        m_verticalGradient(false), /* Default horizontal gradient. */
+        m_intensity(m_startColor.getIntensity())
     {
     }
 
@@ -242,7 +276,8 @@ public:
         m_endColor(endColor),
         m_offset(offset),
         m_gradientLength(gradientLength),
-        m_verticalGradient(verticalGradient)
+        m_verticalGradient(verticalGradient),
+        m_intensity(startColor.getIntensity())
     {
     }
 
@@ -286,7 +321,13 @@ public:
             ratio = static_cast<uint8_t>((pos * 255) / m_gradientLength);
         }
 
-        return blendColors(m_startColor, m_endColor, ratio);
+        TColor startColor = m_startColor;
+        TColor endColor   = m_endColor;
+
+        startColor.setIntensity(m_intensity);
+        endColor.setIntensity(m_intensity);
+
+        return blendColors(startColor, endColor, ratio);
     }
 
     /**
@@ -296,18 +337,19 @@ public:
      */
     uint8_t getIntensity() const override
     {
-        return m_startColor.getIntensity();
+        return m_intensity;
     }
 
     /**
      * Set brush intensity.
+     * The intensity is kept separate from the gradient colors, see
+     * BaseGfxSolidBrush::setIntensity().
      *
      * @param[in] intensity Brush intensity [0; 255] - 0: min. bright / 255: max. bright.
      */
     void setIntensity(uint8_t intensity) override
     {
-        m_startColor.setIntensity(intensity);
-        m_endColor.setIntensity(intensity);
+        m_intensity = intensity;
     }
 
     /**
@@ -338,6 +380,7 @@ public:
     void setStartColor(const TColor& color)
     {
         m_startColor = color;
+        m_intensity  = color.getIntensity();
     }
 
     /**
@@ -418,6 +461,7 @@ private:
     int16_t  m_offset;           /**< Offset in pixels of the gradient start color. */
     uint16_t m_gradientLength;   /**< Length of the gradient in pixels. */
     bool     m_verticalGradient; /**< Flag for vertical gradient. */
+    uint8_t  m_intensity;        /**< Brush intensity [0; 255] - 0: min. bright / 255: max. bright. */
 
     /**
      * Blend two colors based on a ratio (integer version).
@@ -310,6 +310,25 @@ public:
         }
     }
 
+    /**
+     * Mark a rectangular region as changed in the parent canvas.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Region width in pixel
+     * @param[in] height    Region height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        if (nullptr != m_parentGfx)
+        {
+            int16_t absX = x + m_offsX;
+            int16_t absY = y + m_offsY;
+
+            m_parentGfx->markDirty(absX, absY, width, height);
+        }
+    }
+
     /**
      * Get the address inside the framebuffer at certain coordinates.
      * If the requested length is not available, it will return nullptr.
@@ -433,6 +433,58 @@ public:
         }
     }
 
+    /**
+     * Move the text cursor in the same way like drawing the text would do,
+     * but without drawing it. Wrap around handling is performed if configured.
+     *
+     * @param[in] maxLineWidth  Max. line width in pixel, necessary to consider text wrap around.
+     * @param[in] text          Text which to skip
+     */
+    void moveTextCursor(uint16_t maxLineWidth, const char* text)
+    {
+        size_t idx = 0U;
+
+        if ((nullptr == text) ||
+            (nullptr == m_font.getGfxFont()))
+        {
+            return;
+        }
+
+        while ('\0' != text[idx])
+        {
+            uint16_t charBoxWidth  = 0U;
+            uint16_t charBoxHeight = 0U;
+
+            if ('\n' == text[idx])
+            {
+                m_cursorX  = 0;
+                m_cursorY += m_font.getHeight();
+            }
+            else if (true == m_font.getCharBoundingBox(text[idx], charBoxWidth, charBoxHeight))
+            {
+                /* If text wrap around is enabled and the character is clipping,
+                 * jump to the next line.
+                 */
+                if (true == m_isTextWrapEnabled)
+                {
+                    if (maxLineWidth < (m_cursorX + charBoxWidth))
+                    {
+                        m_cursorX  = 0;
+                        m_cursorY += charBoxHeight;
+                    }
+                }
+
+                m_cursorX += charBoxWidth;
+            }
+            else
+            {
+                ;
+            }
+
+            ++idx;
+        }
+    }
+
 private:
 
     int16_t                   m_cursorX;           /**< Cursor x-coordinate */
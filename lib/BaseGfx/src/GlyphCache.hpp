@@ -0,0 +1,332 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   GlyphCache.hpp
+ * @brief  Cache of the pre-decoded font glyphs
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef GLYPH_CACHE_HPP
+#define GLYPH_CACHE_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <atomic>
+#include "gfxfont.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The glyph cache holds the glyphs of a GFXfont decoded to horizontal spans
+ * of set pixels. Drawing a glyph from its spans avoids decoding the glyph
+ * bitmap bit by bit in every frame.
+ *
+ * The glyphs of a font are decoded at once, when the font is requested the
+ * first time. The decoded fonts are kept forever, because the fonts are
+ * constant too. If the cache is full or the memory couldn't be allocated,
+ * the font is not cached and the glyphs must be decoded from the bitmap.
+ *
+ * The cache is lock-free and may be used by several tasks.
+ */
+class GlyphCache
+{
+public:
+
+    /**
+     * A horizontal span of set pixels in the glyph bitmap.
+     */
+    struct Span
+    {
+        uint8_t x;      /**< x-coordinate in the glyph bitmap */
+        uint8_t y;      /**< y-coordinate in the glyph bitmap */
+        uint8_t length; /**< Number of set pixels */
+    };
+
+    /**
+     * The spans of a single glyph.
+     */
+    struct Glyph
+    {
+        uint16_t firstSpan; /**< Index of the first span */
+        uint16_t spanCount; /**< Number of spans */
+    };
+
+    /**
+     * A decoded font.
+     */
+    struct Font
+    {
+        const GFXfont* gfxFont; /**< The decoded GFXfont */
+        Glyph*         glyphs;  /**< Glyphs, one per character from first to last */
+        Span*          spans;   /**< Spans of all glyphs */
+    };
+
+    /**
+     * Get the decoded font. If the font is not decoded yet, it will be
+     * decoded.
+     *
+     * @param[in] gfxFont   GFXfont
+     *
+     * @return If available, the decoded font will be returned otherwise nullptr.
+     */
+    static const Font* getFont(const GFXfont* gfxFont)
+    {
+        std::atomic<Font*>* fonts = getFonts();
+        const Font*         font  = nullptr;
+        size_t              idx   = 0U;
+
+        if (nullptr != gfxFont)
+        {
+            /* The fonts are only added, never removed. Therefore the first
+             * free entry marks the end of the decoded fonts.
+             */
+            while ((MAX_FONTS > idx) && (nullptr == font))
+            {
+                Font* entry = fonts[idx].load(std::memory_order_acquire);
+
+                if (nullptr == entry)
+                {
+                    Font* newFont = createFont(gfxFont);
+
+                    /* Not enough memory available? */
+                    if (nullptr == newFont)
+                    {
+                        break;
+                    }
+
+                    /* Another task may have added a font to this entry in the meantime. */
+                    if (true == fonts[idx].compare_exchange_strong(entry, newFont, std::memory_order_acq_rel))
+                    {
+                        font = newFont;
+                    }
+                    else
+                    {
+                        destroyFont(newFont);
+
+                        if (gfxFont == entry->gfxFont)
+                        {
+                            font = entry;
+                        }
+                    }
+                }
+                else if (gfxFont == entry->gfxFont)
+                {
+                    font = entry;
+                }
+                else
+                {
+                    ;
+                }
+
+                ++idx;
+            }
+        }
+
+        return font;
+    }
+
+    /**
+     * Max. number of fonts, which are cached.
+     */
+    static const size_t MAX_FONTS = 8U;
+
+private:
+
+    /**
+     * Get the decoded fonts.
+     *
+     * @return Decoded fonts
+     */
+    static std::atomic<Font*>* getFonts()
+    {
+        static std::atomic<Font*> fonts[MAX_FONTS];
+
+        return fonts;
+    }
+
+    /**
+     * Decode all glyphs of a font.
+     *
+     * @param[in] gfxFont   GFXfont
+     *
+     * @return If successful, the decoded font will be returned otherwise nullptr.
+     */
+    static Font* createFont(const GFXfont* gfxFont)
+    {
+        Font*    font       = new (std::nothrow) Font();
+        size_t   glyphCount = static_cast<size_t>(gfxFont->last) - gfxFont->first + 1U;
+        uint32_t spanCount  = 0U;
+        size_t   idx        = 0U;
+
+        if (nullptr != font)
+        {
+            font->gfxFont = gfxFont;
+            font->glyphs  = nullptr;
+            font->spans   = nullptr;
+
+            /* The first pass counts the spans, the second pass stores them. */
+            for (idx = 0U; idx < glyphCount; ++idx)
+            {
+                spanCount += decodeGlyph(gfxFont, gfxFont->glyph[idx], nullptr);
+            }
+
+            if (UINT16_MAX >= spanCount)
+            {
+                font->glyphs = new (std::nothrow) Glyph[glyphCount];
+                font->spans  = new (std::nothrow) Span[(0U == spanCount) ? 1U : spanCount];
+            }
+
+            if ((nullptr == font->glyphs) ||
+                (nullptr == font->spans))
+            {
+                destroyFont(font);
+                font = nullptr;
+            }
+            else
+            {
+                uint16_t firstSpan = 0U;
+
+                for (idx = 0U; idx < glyphCount; ++idx)
+                {
+                    Glyph& glyph = font->glyphs[idx];
+
+                    glyph.firstSpan  = firstSpan;
+                    glyph.spanCount  = decodeGlyph(gfxFont, gfxFont->glyph[idx], &font->spans[firstSpan]);
+                    firstSpan       += glyph.spanCount;
+                }
+            }
+        }
+
+        return font;
+    }
+
+    /**
+     * Destroy a decoded font.
+     *
+     * @param[in] font  Decoded font
+     */
+    static void destroyFont(Font* font)
+    {
+        if (nullptr != font)
+        {
+            delete[] font->glyphs;
+            delete[] font->spans;
+            delete font;
+        }
+    }
+
+    /**
+     * Decode the bitmap of a glyph to spans.
+     *
+     * @param[in]   gfxFont GFXfont
+     * @param[in]   glyph   Glyph of the GFXfont
+     * @param[out]  spans   Spans, which to fill. If nullptr, the spans are only counted.
+     *
+     * @return Number of spans
+     */
+    static uint16_t decodeGlyph(const GFXfont* gfxFont, const GFXglyph& glyph, Span* spans)
+    {
+        uint16_t spanCount     = 0U;
+        uint16_t bitmapOffset  = glyph.bitmapOffset;
+        uint8_t  bitmapRowBits = 0U;
+        uint8_t  bitCnt        = 0U;
+        uint8_t  x             = 0U;
+        uint8_t  y             = 0U;
+
+        for (y = 0U; y < glyph.height; ++y)
+        {
+            bool isSpan = false;
+
+            for (x = 0U; x < glyph.width; ++x)
+            {
+                /* Every 8 bit, the bitmap offset must be increased. */
+                if (0U == (bitCnt & 0x07))
+                {
+                    bitmapRowBits = gfxFont->bitmap[bitmapOffset];
+                    ++bitmapOffset;
+                }
+                ++bitCnt;
+
+                /* A 1b in the bitmap row bits is a pixel of a span. */
+                if (0U != (bitmapRowBits & 0x80U))
+                {
+                    if (false == isSpan)
+                    {
+                        if (nullptr != spans)
+                        {
+                            spans[spanCount].x      = x;
+                            spans[spanCount].y      = y;
+                            spans[spanCount].length = 0U;
+                        }
+
+                        ++spanCount;
+                        isSpan = true;
+                    }
+
+                    if (nullptr != spans)
+                    {
+                        ++spans[spanCount - 1U].length;
+                    }
+                }
+                else
+                {
+                    isSpan = false;
+                }
+
+                bitmapRowBits <<= 1U;
+            }
+        }
+
+        return spanCount;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GLYPH_CACHE_HPP */
+
+/** @} */
\ No newline at end of file
@@ -79,6 +79,10 @@ public:
     /**
      * Show framebuffer on physical display. This may be synchronous
      * or asynchronous.
+     *
+     * Only the region which changed since the last show() is transferred.
+     * The drawing methods report the changed pixels via the inherited
+     * BaseGfx::markDirty().
      */
     virtual void show() = 0;
 
@@ -90,6 +94,17 @@ public:
      */
     virtual bool isReady() const = 0;
 
+    /**
+     * Wait until the display is ready for another update via show() or
+     * the timeout is over. In contrast to polling isReady(), the calling
+     * task is blocked and the CPU is free for other tasks.
+     *
+     * @param[in] timeout   Timeout in ms.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    virtual bool waitUntilReady(uint32_t timeout) = 0;
+
     /**
      * Set brightness from 0 to 255.
      *
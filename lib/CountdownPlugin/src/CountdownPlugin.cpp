@@ -156,19 +156,6 @@ bool CountdownPlugin::setTopic(const String& topic, const JsonObjectConst& value
     return isSuccessful;
 }
 
-bool CountdownPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void CountdownPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -293,7 +280,7 @@ bool CountdownPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
             m_targetDateInformation.plural   = jsonDescPlural.as<const char*>();
             m_targetDateInformation.singular = jsonDescSingular.as<const char*>();
 
-            m_hasTopicChanged                = true;
+            notifyTopicChanged(TOPIC_CONFIG);
 
             status                           = true;
         }
@@ -186,8 +186,7 @@ public:
         m_targetDate(),
         m_targetDateInformation(),
         m_remainingDays(""),
-        m_mutex(),
-        m_hasTopicChanged(false)
+        m_mutex()
     {
         /* Example data, used to generate the very first configuration file. */
         m_targetDate.day                 = 1U;
@@ -324,17 +323,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -401,7 +389,6 @@ private:
     TargetDayDescription   m_targetDateInformation; /**< String used for configured additional target date information. */
     String                 m_remainingDays;         /**< String used for displaying the remaining days untril the target date. */
     mutable MutexRecursive m_mutex;                 /**< Mutex to protect against concurrent access. */
-    bool                   m_hasTopicChanged;       /**< Has the topic content changed? */
 
     /**
      * Get configuration in JSON.
@@ -116,19 +116,6 @@ bool DateTimePlugin::setTopic(const String& topic, const JsonObjectConst& value)
     return isSuccessful;
 }
 
-bool DateTimePlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void DateTimePlugin::setSlot(const ISlotPlugin* slotInterf)
 {
     m_slotInterf = slotInterf;
@@ -179,6 +166,7 @@ void DateTimePlugin::active(YAGfx& gfx)
 
     /* The date/time shall be updated on the display right after plugin activation. */
     updateDateTime(true);
+    m_isUpdateRequired = true;
 }
 
 void DateTimePlugin::inactive()
@@ -193,6 +181,21 @@ void DateTimePlugin::update(YAGfx& gfx)
     MutexGuard<MutexRecursive> guard(m_mutex);
 
     m_view.update(gfx);
+    m_isUpdateRequired = false;
+}
+
+uint32_t DateTimePlugin::getTimeToNextUpdate() const
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+    uint32_t                   timeToNextUpdate = CHECK_UPDATE_PERIOD;
+
+    if ((true == m_isUpdateRequired) ||
+        (true == m_view.isAnimated()))
+    {
+        timeToNextUpdate = 0U;
+    }
+
+    return timeToNextUpdate;
 }
 
 /******************************************************************************
@@ -283,7 +286,9 @@ bool DateTimePlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         m_view.setDayOffColor(Util::colorFromHtml(jsonDayOffColor.as<const char*>()));
         m_view.setViewMode(static_cast<IDateTimeView::ViewMode>(jsonViewMode.as<uint8_t>()));
 
-        m_hasTopicChanged = true;
+        m_isUpdateRequired = true;
+
+        notifyTopicChanged(TOPIC_CONFIG);
     }
 
     return status;
@@ -455,6 +460,7 @@ void DateTimePlugin::updateDateTime(bool force)
             (m_shownSecond != timeInfo.tm_sec))
         {
             m_view.setCurrentTime(timeInfo);
+            m_isUpdateRequired = true;
         }
 
         if (true == showTime)
@@ -472,6 +478,7 @@ void DateTimePlugin::updateDateTime(bool force)
                 if (true == getTimeAsString(timeAsStr, extTimeFormat, &timeInfo))
                 {
                     m_view.setFormatText(timeAsStr);
+                    m_isUpdateRequired = true;
 
                     m_shownSecond = timeInfo.tm_sec;
                 }
@@ -492,6 +499,7 @@ void DateTimePlugin::updateDateTime(bool force)
                 if (true == getTimeAsString(dateAsStr, extDateFormat, &timeInfo))
                 {
                     m_view.setFormatText(dateAsStr);
+                    m_isUpdateRequired = true;
 
                     m_shownDayOfTheYear = timeInfo.tm_yday;
                 }
@@ -508,6 +516,7 @@ void DateTimePlugin::updateDateTime(bool force)
         if (true == force)
         {
             m_view.setFormatText("{hc}Time Sync");
+            m_isUpdateRequired = true;
         }
     }
 }
@@ -87,7 +87,7 @@ public:
         m_timeZone(),
         m_slotInterf(nullptr),
         m_mutex(),
-        m_hasTopicChanged(false)
+        m_isUpdateRequired(true)
     {
         (void)m_mutex.create();
     }
@@ -217,17 +217,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     * 
-     * @param[in] topic The topic which to check.
-     * 
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-    
     /**
      * Set the slot interface, which the plugin can used to request information
      * from the slot, it is plugged in.
@@ -291,6 +280,15 @@ public:
      */
     void update(YAGfx& gfx) final;
 
+    /**
+     * Get the duration until the plugin requires the next update() call.
+     * The date/time changes at most every second, which is handled by
+     * process().
+     *
+     * @return Duration in ms. 0 means update in the next display refresh cycle.
+     */
+    uint32_t getTimeToNextUpdate() const final;
+
 private:
 
     /**
@@ -341,7 +339,7 @@ private:
     String                  m_timeZone;             /**< Timezone of the time to show. If empty, the local time is used. */
     const ISlotPlugin*      m_slotInterf;           /**< Slot interface */
     mutable MutexRecursive  m_mutex;                /**< Mutex to protect against concurrent access. */
-    bool                    m_hasTopicChanged;      /**< Has the topic content changed? */
+    bool                    m_isUpdateRequired;     /**< Has the view content changed since the last update()? */
 
     /**
      * Get configuration in JSON.
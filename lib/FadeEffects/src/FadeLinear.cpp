@@ -66,7 +66,8 @@ void FadeLinear::init()
 
 bool FadeLinear::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 {
-    bool isFinished = false;
+    bool    isFinished = false;
+    uint8_t intensity  = Color::MAX_BRIGHT;
 
     (void)prev;
 
@@ -79,24 +80,25 @@ bool FadeLinear::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if ((Color::MAX_BRIGHT - FADING_STEP) <= m_intensity)
     {
-        dimBitmap(next, Color::MAX_BRIGHT);
-        m_state     = FADE_STATE_INIT;
-        isFinished  = true;
+        m_state    = FADE_STATE_INIT;
+        isFinished = true;
     }
     else
     {
-        dimBitmap(next, m_intensity);
+        intensity    = m_intensity;
         m_intensity += FADING_STEP;
     }
 
-    gfx.copy(next);
+    /* The framebuffer of the plugin is not changed, only the copy is faded. */
+    gfx.copy(next, intensity);
 
     return isFinished;
 }
 
 bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 {
-    bool isFinished = false;
+    bool    isFinished = false;
+    uint8_t intensity  = Color::MIN_BRIGHT;
 
     (void)next;
 
@@ -109,17 +111,17 @@ bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if ((Color::MIN_BRIGHT + FADING_STEP) >= m_intensity)
     {
-        dimBitmap(prev, Color::MIN_BRIGHT);
-        m_state     = FADE_STATE_INIT;
-        isFinished  = true;
+        m_state    = FADE_STATE_INIT;
+        isFinished = true;
     }
     else
     {
-        dimBitmap(prev, m_intensity);
+        intensity    = m_intensity;
         m_intensity -= FADING_STEP;
     }
 
-    gfx.copy(prev);
+    /* The framebuffer of the plugin is not changed, only the copy is faded. */
+    gfx.copy(prev, intensity);
 
     return isFinished;
 }
@@ -132,22 +134,6 @@ bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
  * Private Methods
  *****************************************************************************/
 
-void FadeLinear::dimBitmap(YAGfxBitmap& bitmap, uint8_t intensity)
-{
-    uint16_t    width   = bitmap.getWidth();
-    uint16_t    height  = bitmap.getHeight();
-    int16_t     x;
-    int16_t     y;
-
-    for(y = 0; y < height; ++y)
-    {
-        for(x = 0; x < width; ++x)
-        {
-            bitmap.getColor(x, y).setIntensity(intensity);
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -213,19 +213,6 @@ bool GrabViaMqttPlugin::setTopic(const String& topic, const JsonObjectConst& val
     return isSuccessful;
 }
 
-bool GrabViaMqttPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void GrabViaMqttPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -260,6 +247,7 @@ void GrabViaMqttPlugin::stop()
     MutexGuard<MutexRecursive> guard(m_mutex);
 
     unsubscribe();
+    m_jsonDocPayload.release();
 
     PluginWithConfig::stop();
 }
@@ -347,6 +335,7 @@ bool GrabViaMqttPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
 
         m_path       = jsonPath.as<const char*>();
         m_filter     = jsonFilter;
+        compileFilter();
         m_format     = jsonFormat.as<const char*>();
         m_multiplier = jsonMultiplier.as<float>();
         m_offset     = jsonOffset.as<float>();
@@ -383,7 +372,7 @@ bool GrabViaMqttPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
             subscribe();
         }
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
 
         status            = true;
     }
@@ -391,10 +380,22 @@ bool GrabViaMqttPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
     return status;
 }
 
-void GrabViaMqttPlugin::getJsonValueByFilter(JsonVariantConst src, JsonVariantConst filter, JsonArray& values)
+void GrabViaMqttPlugin::compileFilter()
+{
+    String filter;
+
+    (void)serializeJson(m_filter, filter);
+
+    if (false == m_streamFilter.setFilter(filter))
+    {
+        LOG_WARNING("Invalid JSON filter: %s", filter.c_str());
+    }
+}
+
+void GrabViaMqttPlugin::appendValuesByFilter(JsonVariantConst src, JsonVariantConst filter, String& output, size_t& valueCount)
 {
     /* Source type and filter type must always match.
-     * If not, it is a configuration error and the values array will be empty.
+     * If not, it is a configuration error and no value is appended.
      */
     if ((true == src.is<JsonObjectConst>()) &&
         (true == filter.is<JsonObjectConst>()))
@@ -406,15 +407,18 @@ void GrabViaMqttPlugin::getJsonValueByFilter(JsonVariantConst src, JsonVariantCo
             if ((true == pair.value().is<JsonObjectConst>()) ||
                 (true == pair.value().is<JsonArrayConst>()))
             {
-                getJsonValueByFilter(src[pair.key()], filter[pair.key()], values);
+                appendValuesByFilter(src[pair.key()], filter[pair.key()], output, valueCount);
             }
             /* Capture the value from the source, by using the filter pair key. */
             else
             {
-                if (false == values.add(src[pair.key()]))
+                if (0U < valueCount)
                 {
-                    break;
+                    output += m_delimiter;
                 }
+
+                appendValue(src[pair.key()], output);
+                ++valueCount;
             }
         }
     }
@@ -430,15 +434,18 @@ void GrabViaMqttPlugin::getJsonValueByFilter(JsonVariantConst src, JsonVariantCo
             if ((true == filterArray[0].is<JsonObjectConst>()) ||
                 (true == filterArray[0].is<JsonArrayConst>()))
             {
-                getJsonValueByFilter(value, filterArray[0], values);
+                appendValuesByFilter(value, filterArray[0], output, valueCount);
             }
             /* Capture the value from the source. */
             else
             {
-                if (false == values.add(value))
+                if (0U < valueCount)
                 {
-                    break;
+                    output += m_delimiter;
                 }
+
+                appendValue(value, output);
+                ++valueCount;
             }
         }
     }
@@ -474,110 +481,116 @@ void GrabViaMqttPlugin::unsubscribe()
 
 void GrabViaMqttPlugin::mqttTopicCallback(const String& topic, const uint8_t* payload, size_t size)
 {
-    const size_t         JSON_DOC_SIZE = 1024U;
-    DynamicJsonDocument  jsonDoc(JSON_DOC_SIZE);
-    DeserializationError error = deserializeJson(jsonDoc, payload, size);
+    MutexGuard<MutexRecursive> guard(m_mutex);
+    bool                       isFiltered = false;
 
-    if (DeserializationError::Ok != error)
+    /* Reduce the payload to the filtered values in a single pass, without
+     * deserializing the whole payload.
+     */
+    m_streamFilter.reset();
+
+    if (true == m_streamFilter.parse(reinterpret_cast<const char*>(payload), size))
+    {
+        isFiltered = m_streamFilter.finish();
+    }
+
+    if (false == isFiltered)
     {
         LOG_WARNING("MQTT payload contains invalid JSON.");
     }
     else
     {
-        DynamicJsonDocument jsonDocValues(JSON_DOC_SIZE);
-        JsonArray           jsonValuesArray = jsonDocValues.to<JsonArray>();
-        size_t              index           = 0U;
-        String              outputStr;
-        size_t              valueCount = 0U;
+        DynamicJsonDocument& jsonDoc = m_jsonDocPayload.get();
+        bool                 isValid = true;
 
-        getJsonValueByFilter(jsonDoc, m_filter, jsonValuesArray);
-        valueCount = jsonValuesArray.size();
-
-        if (true == jsonDocValues.overflowed())
+        /* If the filter skips the whole payload, e.g. because no filter is
+         * set, the output is empty. Like for a payload, which doesn't match
+         * to the filter, no value is grabbed and the text is cleared.
+         */
+        if (false == m_streamFilter.getOutput().isEmpty())
         {
-            LOG_ERROR("Less memory for JSON values available.");
-
-            /* The last value may be corrupt, throw it away and show the rest. */
-            if (0U < valueCount)
+            if (DeserializationError::Ok != deserializeJson(jsonDoc, m_streamFilter.getOutput()))
             {
-                --valueCount;
+                LOG_WARNING("Less memory for filtered MQTT payload available.");
+                isValid = false;
             }
         }
 
-        for (index = 0U; index < valueCount; ++index)
+        if (true == isValid)
         {
-            JsonVariantConst jsonValue = jsonValuesArray[index];
+            String outputStr;
+            size_t valueCount = 0U;
 
-            if (0U < index)
-            {
-                outputStr += m_delimiter;
-            }
+            appendValuesByFilter(jsonDoc, m_filter, outputStr, valueCount);
 
-            /* Is it a number and format string doesn't contain a '%s'? */
-            if ((true == jsonValue.is<float>()) &&
-                (false == Util::isFormatSpecifierInStr(m_format, 's'))) /* Prevent mistake which may cause a LoadProhibited core panic by snprintf. */
-            {
-                const size_t BUFFER_SIZE = 128U;
-                char         buffer[BUFFER_SIZE];
-                float        value = jsonValue.as<float>();
+            LOG_INFO("Grabbed: %s", outputStr.c_str());
 
-                /* Is it not a number? */
-                if (true == std::isnan(value))
-                {
-                    outputStr += "!";
-                }
-                else
-                {
-                    value *= m_multiplier;
-                    value += m_offset;
+            m_view.setFormatText(outputStr);
+        }
+    }
+}
 
-                    (void)snprintf(buffer, sizeof(buffer), m_format.c_str(), value);
+void GrabViaMqttPlugin::appendValue(JsonVariantConst jsonValue, String& output)
+{
+    /* Is it a number and format string doesn't contain a '%s'? */
+    if ((true == jsonValue.is<float>()) &&
+        (false == Util::isFormatSpecifierInStr(m_format, 's'))) /* Prevent mistake which may cause a LoadProhibited core panic by snprintf. */
+    {
+        const size_t BUFFER_SIZE = 128U;
+        char         buffer[BUFFER_SIZE];
+        float        value = jsonValue.as<float>();
 
-                    outputStr += buffer;
-                }
-            }
-            /* Is it a string and should be converted to a floating point number? */
-            else if ((true == jsonValue.is<String>()) &&
-                     (true == Util::isFormatSpecifierInStr(m_format, 'f')))
-            {
-                const size_t BUFFER_SIZE = 128U;
-                char         buffer[BUFFER_SIZE];
-                float        value = jsonValue.as<String>().toFloat();
+        /* Is it not a number? */
+        if (true == std::isnan(value))
+        {
+            output += "!";
+        }
+        else
+        {
+            value *= m_multiplier;
+            value += m_offset;
 
-                /* Is it not a number? */
-                if (true == std::isnan(value))
-                {
-                    outputStr += "!";
-                }
-                else
-                {
-                    value *= m_multiplier;
-                    value += m_offset;
+            (void)snprintf(buffer, sizeof(buffer), m_format.c_str(), value);
 
-                    (void)snprintf(buffer, sizeof(buffer), m_format.c_str(), value);
+            output += buffer;
+        }
+    }
+    /* Is it a string and should be converted to a floating point number? */
+    else if ((true == jsonValue.is<String>()) &&
+             (true == Util::isFormatSpecifierInStr(m_format, 'f')))
+    {
+        const size_t BUFFER_SIZE = 128U;
+        char         buffer[BUFFER_SIZE];
+        float        value = jsonValue.as<String>().toFloat();
 
-                    outputStr += buffer;
-                }
-            }
-            /* Is it a string? */
-            else if (true == jsonValue.is<String>())
-            {
-                const size_t BUFFER_SIZE = 128U;
-                char         buffer[BUFFER_SIZE];
+        /* Is it not a number? */
+        if (true == std::isnan(value))
+        {
+            output += "!";
+        }
+        else
+        {
+            value *= m_multiplier;
+            value += m_offset;
 
-                (void)snprintf(buffer, sizeof(buffer), m_format.c_str(), jsonValue.as<const char*>());
+            (void)snprintf(buffer, sizeof(buffer), m_format.c_str(), value);
 
-                outputStr += buffer;
-            }
-            else
-            {
-                outputStr += "?";
-            }
+            output += buffer;
         }
+    }
+    /* Is it a string? */
+    else if (true == jsonValue.is<String>())
+    {
+        const size_t BUFFER_SIZE = 128U;
+        char         buffer[BUFFER_SIZE];
 
-        LOG_INFO("Grabbed: %s", outputStr.c_str());
+        (void)snprintf(buffer, sizeof(buffer), m_format.c_str(), jsonValue.as<const char*>());
 
-        m_view.setFormatText(outputStr);
+        output += buffer;
+    }
+    else
+    {
+        output += "?";
     }
 }
 
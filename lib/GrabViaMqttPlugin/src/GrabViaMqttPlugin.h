@@ -51,6 +51,8 @@
 #include <Mutex.hpp>
 #include <FileSystem.h>
 #include <FileMgrService.h>
+#include <JsonStreamFilter.h>
+#include <ReusableJsonDocument.hpp>
 
 /******************************************************************************
  * Macros
@@ -78,13 +80,14 @@ public:
         m_view(),
         m_path(),
         m_filter(1024U),
+        m_streamFilter(),
+        m_jsonDocPayload(),
         m_iconFileId(FileMgrService::FILE_ID_INVALID),
         m_format("%s"),
         m_delimiter("::"),
         m_multiplier(1.0f),
         m_offset(0.0f),
-        m_mutex(),
-        m_hasTopicChanged(false)
+        m_mutex()
     {
         (void)m_mutex.create();
     }
@@ -221,17 +224,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -280,16 +272,22 @@ private:
      */
     static const char*       TOPIC_CONFIG;
 
-    _GrabViaMqttPlugin::View m_view;            /**< View with all widgets. */
-    String                   m_path;            /**< MQTT topic path */
-    DynamicJsonDocument      m_filter;          /**< Filter used for the response in JSON format. */
-    FileMgrService::FileId   m_iconFileId;      /**< Icon file id. */
-    String                   m_format;          /**< Format used to embed the retrieved filtered value. */
-    String                   m_delimiter;       /**< Delimiter is used in case several values shall be shown, because of an JSON array. */
-    float                    m_multiplier;      /**< If grabbed value is a number, it will be multiplied with the multiplier. */
-    float                    m_offset;          /**< If grabbed value is a number, the offset will be added after the multiplication with the multiplier. */
-    mutable MutexRecursive   m_mutex;           /**< Mutex to protect against concurrent access. */
-    bool                     m_hasTopicChanged; /**< Has the topic content changed? */
+    /**
+     * Size of the JSON document for the filtered payload in byte.
+     */
+    static const size_t      JSON_DOC_SIZE = 1024U;
+
+    _GrabViaMqttPlugin::View            m_view;           /**< View with all widgets. */
+    String                              m_path;           /**< MQTT topic path */
+    DynamicJsonDocument                 m_filter;         /**< Filter used for the response in JSON format. */
+    JsonStreamFilter                    m_streamFilter;   /**< Filter compiled once, which reduces the payload to the filtered values. */
+    ReusableJsonDocument<JSON_DOC_SIZE> m_jsonDocPayload; /**< JSON document for the filtered payload, reused for every message. */
+    FileMgrService::FileId              m_iconFileId;     /**< Icon file id. */
+    String                              m_format;         /**< Format used to embed the retrieved filtered value. */
+    String                              m_delimiter;      /**< Delimiter is used in case several values shall be shown, because of an JSON array. */
+    float                               m_multiplier;     /**< If grabbed value is a number, it will be multiplied with the multiplier. */
+    float                               m_offset;         /**< If grabbed value is a number, the offset will be added after the multiplication with the multiplier. */
+    mutable MutexRecursive              m_mutex;          /**< Mutex to protect against concurrent access. */
 
     /**
      * Get configuration in JSON.
@@ -308,14 +306,29 @@ private:
     bool setConfiguration(const JsonObjectConst& jsonCfg) final;
 
     /**
-     * Get value from JSON source by the filter.
+     * Compile the filter for the stream filter, which is used to reduce
+     * every received payload.
+     */
+    void compileFilter();
+
+    /**
+     * Append the formatted values from JSON source by the filter to the output.
      * It will be called recursively and can handle nested JSON objects and arrays.
      *
-     * @param[in]   src     Source in JSON format
-     * @param[in]   filter  Filter in JSON format
-     * @param[out]  values  Array of values in JSON format
+     * @param[in]       src         Source in JSON format
+     * @param[in]       filter      Filter in JSON format
+     * @param[in, out]  output      Output with the formatted values
+     * @param[in, out]  valueCount  Number of values in the output
+     */
+    void appendValuesByFilter(JsonVariantConst src, JsonVariantConst filter, String& output, size_t& valueCount);
+
+    /**
+     * Append a single formatted value to the output.
+     *
+     * @param[in]       jsonValue   Value in JSON format
+     * @param[in, out]  output      Output with the formatted values
      */
-    void getJsonValueByFilter(JsonVariantConst src, JsonVariantConst filter, JsonArray& values);
+    void appendValue(JsonVariantConst jsonValue, String& output);
 
     /**
      * Subscribe MQTT topic to be informed about value changes.
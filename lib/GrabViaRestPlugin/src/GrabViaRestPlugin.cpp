@@ -221,19 +221,6 @@ bool GrabViaRestPlugin::setTopic(const String& topic, const JsonObjectConst& val
     return isSuccessful;
 }
 
-bool GrabViaRestPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void GrabViaRestPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -478,7 +465,7 @@ bool GrabViaRestPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         /* Force update on display */
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
 
         status            = true;
     }
@@ -488,17 +475,17 @@ bool GrabViaRestPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
 
 bool GrabViaRestPlugin::startHttpRequest()
 {
-    bool                            status = false;
-    RestService::PreProcessCallback preProcessCallback =
-        [this](const char* payload, size_t size, DynamicJsonDocument& doc) {
-            return this->preProcessAsyncWebResponse(payload, size, doc);
-        };
+    bool status = false;
 
-    if (false == m_url.isEmpty())
+    if (true == m_filter.overflowed())
+    {
+        LOG_ERROR("Less memory for filter available.");
+    }
+    else if (false == m_url.isEmpty())
     {
         if (true == m_method.equalsIgnoreCase("GET"))
         {
-            m_dynamicRestId = RestService::getInstance().get(m_url, preProcessCallback);
+            m_dynamicRestId = RestService::getInstance().get(m_url, m_filter, getUID());
 
             if (RestService::INVALID_REST_ID == m_dynamicRestId)
             {
@@ -511,7 +498,7 @@ bool GrabViaRestPlugin::startHttpRequest()
         }
         else if (true == m_method.equalsIgnoreCase("POST"))
         {
-            m_dynamicRestId = RestService::getInstance().post(m_url, preProcessCallback);
+            m_dynamicRestId = RestService::getInstance().post(m_url, m_filter, nullptr, 0U, getUID());
 
             if (RestService::INVALID_REST_ID == m_dynamicRestId)
             {
@@ -527,34 +514,12 @@ bool GrabViaRestPlugin::startHttpRequest()
             LOG_WARNING("Invalid HTTP method %s.", m_method.c_str());
         }
     }
-
-    return status;
-}
-
-bool GrabViaRestPlugin::preProcessAsyncWebResponse(const char* payload, size_t payloadSize, DynamicJsonDocument& jsonDoc)
-{
-    bool                       isSuccessful = false;
-    MutexGuard<MutexRecursive> guard(m_mutex);
-
-    if (true == m_filter.overflowed())
-    {
-        LOG_ERROR("Less memory for filter available.");
-    }
     else
     {
-        DeserializationError error = deserializeJson(jsonDoc, payload, payloadSize, DeserializationOption::Filter(m_filter));
-
-        if (DeserializationError::Ok != error.code())
-        {
-            LOG_WARNING("JSON parse error: %s", error.c_str());
-        }
-        else
-        {
-            isSuccessful = true;
-        }
+        ;
     }
 
-    return isSuccessful;
+    return status;
 }
 
 void GrabViaRestPlugin::getJsonValueByFilter(JsonVariantConst src, JsonVariantConst filter, JsonArray& values)
@@ -87,7 +87,6 @@ public:
         m_offset(0.0f),
         m_requestTimer(),
         m_mutex(),
-        m_hasTopicChanged(false),
         m_dynamicRestId(RestService::INVALID_REST_ID),
         m_isAllowedToSend(true)
     {
@@ -226,17 +225,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -308,7 +296,6 @@ private:
     float                    m_offset;          /**< If grabbed value is a number, the offset will be added after the multiplication with the multiplier. */
     SimpleTimer              m_requestTimer;    /**< Timer used for cyclic request of new data. */
     mutable MutexRecursive   m_mutex;           /**< Mutex to protect against concurrent access. */
-    bool                     m_hasTopicChanged; /**< Has the topic content changed? */
     uint32_t                 m_dynamicRestId;   /**< Used to identify plugin when interacting with RestService. Id changes with every request. */
     bool                     m_isAllowedToSend; /**< Is allowed to send REST-Api request? */
 
@@ -335,18 +322,6 @@ private:
      */
     bool startHttpRequest(void);
 
-    /**
-     * Handle asynchronous web response from the server.
-     * This will be called in LwIP context! Don't modify any member here directly!
-     *
-     * @param[in] payload     Payload of the web response
-     * @param[in] payloadSize Size of the payload
-     * @param[out] jsonDoc    DynamicJsonDocument used to store result in.
-     *
-     * @return If successful it will return true otherwise false.
-     */
-    bool preProcessAsyncWebResponse(const char* payload, size_t payloadSize, DynamicJsonDocument& jsonDoc);
-
     /**
      * Get value from JSON source by the filter.
      * It will be called recursively and can handle nested JSON objects and arrays.
@@ -129,19 +129,6 @@ bool GruenbeckPlugin::setTopic(const String& topic, const JsonObjectConst& value
     return isSuccessful;
 }
 
-bool GruenbeckPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void GruenbeckPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -299,7 +286,7 @@ bool GruenbeckPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         /* Force update on display */
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
 
         status            = true;
     }
@@ -319,7 +306,7 @@ bool GruenbeckPlugin::startHttpRequest()
     {
         String url      = String("http://") + m_ipAddress + "/mux_http?id=42&show=D_Y_10_1~";
 
-        m_dynamicRestId = RestService::getInstance().get(url, preProcessCallback);
+        m_dynamicRestId = RestService::getInstance().get(url, preProcessCallback, getUID());
 
         if (RestService::INVALID_REST_ID == m_dynamicRestId)
         {
@@ -81,7 +81,6 @@ public:
         m_ipAddress("192.168.0.16"),
         m_requestTimer(),
         m_mutex(),
-        m_hasTopicChanged(false),
         m_dynamicRestId(RestService::INVALID_REST_ID),
         m_isAllowedToSend(true)
     {
@@ -213,17 +212,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -288,7 +276,6 @@ private:
     String                 m_ipAddress;       /**< IP-address of the Gruenbeck server. */
     SimpleTimer            m_requestTimer;    /**< Timer, used for cyclic request of new data. */
     mutable MutexRecursive m_mutex;           /**< Mutex to protect against concurrent access. */
-    bool                   m_hasTopicChanged; /**< Has the topic content changed? */
     uint32_t               m_dynamicRestId;   /**< Used to identify plugin when interacting with RestService. Id changes with every request. */
     bool                   m_isAllowedToSend; /**< Is allowed to send REST-Api request? */
 
@@ -115,27 +115,47 @@ Display::~Display()
 
 void Display::show()
 {
-    if (true == m_isOn)
+    int16_t  dirtyX      = 0;
+    int16_t  dirtyY      = 0;
+    uint16_t dirtyWidth  = 0U;
+    uint16_t dirtyHeight = 0U;
+
+    /* The panel driver keeps its own DMA buffer, therefore only the
+     * changed pixels need to be written.
+     */
+    if ((true == m_isOn) &&
+        (true == m_ledMatrix.getDirtyRegion(dirtyX, dirtyY, dirtyWidth, dirtyHeight)))
     {
         int16_t y;
         int16_t x;
 
-        for(y = 0; y < Board::LedMatrix::height; ++y)
+        for(y = dirtyY; y < (dirtyY + dirtyHeight); ++y)
         {
-            for(x = 0; x < Board::LedMatrix::width; ++x)
+            for(x = dirtyX; x < (dirtyX + dirtyWidth); ++x)
             {
-                Color& color = m_ledMatrix.getColor(x, y);
+                const Color& color = m_ledMatrix.getColor(x, y);
+                uint8_t      red   = 0U;
+                uint8_t      green = 0U;
+                uint8_t      blue  = 0U;
+
+                /* Get all base colors at once, which scales a faded pixel
+                 * with a single word-parallel operation instead of one
+                 * division per channel.
+                 */
+                color.get(red, green, blue);
 
 #if CONFIG_DISPLAY_ROTATE180 != 0
                 m_panel.drawPixelRGB888(
                     Board::LedMatrix::width - x - 1, 
                     Board::LedMatrix::height - y - 1,
-                    color.getRed(), color.getGreen(), color.getBlue());
+                    red, green, blue);
 #else
-                m_panel.drawPixelRGB888(x, y, color.getRed(), color.getGreen(), color.getBlue());
+                m_panel.drawPixelRGB888(x, y, red, green, blue);
 #endif
             }
         }
+
+        m_ledMatrix.clearDirty();
     }
 }
 
@@ -150,6 +170,9 @@ void Display::off()
 void Display::on()
 {
     m_isOn = true;
+
+    /* The panel was cleared during power off. */
+    m_ledMatrix.markAllDirty();
 }
 
 bool Display::isOn() const
@@ -108,6 +108,22 @@ public:
         return true;
     }
 
+    /**
+     * Wait until the display is ready for another update via show() or
+     * the timeout is over.
+     *
+     * @param[in] timeout   Timeout in ms.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    bool waitUntilReady(uint32_t timeout) final
+    {
+        /* The update is synchronous, therefore nothing to wait for. */
+        (void)timeout;
+
+        return true;
+    }
+
     /**
      * Set brightness from 0 to 255.
      *
@@ -179,6 +195,19 @@ public:
         return m_ledMatrix.getColor(x, y);
     }
 
+    /**
+     * Mark a rectangular region as changed.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Region width in pixel
+     * @param[in] height    Region height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        m_ledMatrix.markDirty(x, y, width, height);
+    }
+
     /**
      * Get the address inside the framebuffer at certain coordinates.
      * If the requested length is not available, it will return nullptr.
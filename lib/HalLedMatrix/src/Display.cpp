@@ -72,8 +72,10 @@ Display::Display() :
     m_strip(Board::LedMatrix::width * Board::LedMatrix::height, Board::Pin::ledMatrixDataOutPinNo),
     m_topo(Board::LedMatrix::width, Board::LedMatrix::height),
     m_ledMatrix(),
+    m_pixelMap(),
     m_isOn(true)
 {
+    initPixelMap();
 }
 
 Display::~Display()
@@ -82,25 +84,58 @@ Display::~Display()
 
 void Display::show()
 {
-    if (true == m_isOn)
+    int16_t  dirtyX      = 0;
+    int16_t  dirtyY      = 0;
+    uint16_t dirtyWidth  = 0U;
+    uint16_t dirtyHeight = 0U;
+
+    /* The strip keeps its pixel buffer, therefore only the changed pixels
+     * need to be updated and without any change nothing is transferred.
+     */
+    if ((true == m_isOn) &&
+        (true == m_ledMatrix.getDirtyRegion(dirtyX, dirtyY, dirtyWidth, dirtyHeight)))
     {
-        const int16_t height = m_ledMatrix.getHeight();
-        const int16_t width = m_ledMatrix.getWidth();
-
-        for (int16_t y = 0; y < height; ++y)
+        /* Same scaling as the luminance shader of NeoPixelBusLg, which is
+         * bypassed by writing directly into the strip pixel buffer.
+         */
+        const uint16_t  LUMINANCE   = static_cast<uint16_t>(m_strip.GetLuminance()) + 1U;
+        uint8_t*        pixels      = m_strip.Pixels();
+        int16_t         y;
+
+        for (y = dirtyY; y < (dirtyY + dirtyHeight); ++y)
         {
-            for (int16_t x = 0; x < width; ++x)
+            uint16_t        offset      = 0U;
+            const Color*    src         = m_ledMatrix.getFrameBufferXAddr(dirtyX, y, dirtyWidth, offset);
+            const uint16_t* pixelMap    = &m_pixelMap[y * Board::LedMatrix::width + dirtyX];
+
+            if (nullptr != src)
             {
-                HtmlColor htmlColor = static_cast<uint32_t>(m_ledMatrix.getColor(x, y));
-#if CONFIG_DISPLAY_ROTATE180 != 0
-                m_strip.SetPixelColor(m_topo.Map(width - x - 1, height - y - 1), htmlColor);
-#else
-                m_strip.SetPixelColor(m_topo.Map(x, y), htmlColor);
-#endif
+                uint16_t idx = 0U;
+
+                while (dirtyWidth > idx)
+                {
+                    uint8_t red     = 0U;
+                    uint8_t green   = 0U;
+                    uint8_t blue    = 0U;
+
+                    src[idx * offset].get(red, green, blue);
+
+                    NeoGrbFeature::applyPixelColor(
+                        pixels,
+                        pixelMap[idx],
+                        RgbColor(
+                            static_cast<uint8_t>((red * LUMINANCE) >> 8U),
+                            static_cast<uint8_t>((green * LUMINANCE) >> 8U),
+                            static_cast<uint8_t>((blue * LUMINANCE) >> 8U)));
+
+                    ++idx;
+                }
             }
         }
 
+        m_strip.Dirty();
         m_strip.Show();
+        m_ledMatrix.clearDirty();
     }
 }
 
@@ -116,6 +151,9 @@ void Display::off()
 void Display::on()
 {
     m_isOn = true;
+
+    /* The strip was cleared during power off. */
+    m_ledMatrix.markAllDirty();
 }
 
 bool Display::isOn() const
@@ -123,6 +161,45 @@ bool Display::isOn() const
     return m_isOn;
 }
 
+bool Display::waitUntilReady(uint32_t timeout)
+{
+    uint32_t    timestamp   = millis();
+    bool        isReady     = m_strip.CanShow();
+
+    /* NeoPixelBus provides no transfer complete event, therefore the
+     * task sleeps for a tick between the checks instead of spinning.
+     */
+    while ((false == isReady) &&
+           (timeout > (millis() - timestamp)))
+    {
+        vTaskDelay(1U);
+        isReady = m_strip.CanShow();
+    }
+
+    return isReady;
+}
+
+void Display::initPixelMap()
+{
+    const int16_t   width   = Board::LedMatrix::width;
+    const int16_t   height  = Board::LedMatrix::height;
+    int16_t         y;
+
+    for (y = 0; y < height; ++y)
+    {
+        int16_t x;
+
+        for (x = 0; x < width; ++x)
+        {
+#if CONFIG_DISPLAY_ROTATE180 != 0
+            m_pixelMap[y * width + x] = m_topo.Map(width - x - 1, height - y - 1);
+#else
+            m_pixelMap[y * width + x] = m_topo.Map(x, y);
+#endif
+        }
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -109,6 +109,16 @@ public:
         return m_strip.CanShow();
     }
 
+    /**
+     * Wait until the display is ready for another update via show() or
+     * the timeout is over.
+     *
+     * @param[in] timeout   Timeout in ms.
+     *
+     * @return If ready for another update via show(), it will return true otherwise false.
+     */
+    bool waitUntilReady(uint32_t timeout) final;
+
     /**
      * Set brightness from 0 to 255.
      *
@@ -124,6 +134,9 @@ public:
             (Board::LedMatrix::maxCurrentPerLed * Board::LedMatrix::width *Board::LedMatrix::height);
 
         m_strip.SetLuminance(SAFE_LUMINANCE);
+
+        /* The luminance is applied by setting the pixel colors. */
+        m_ledMatrix.markAllDirty();
     }
 
     /**
@@ -181,6 +194,19 @@ public:
         return m_ledMatrix.getColor(x, y);
     }
 
+    /**
+     * Mark a rectangular region as changed.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Region width in pixel
+     * @param[in] height    Region height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        m_ledMatrix.markDirty(x, y, width, height);
+    }
+
     /**
      * Get the address inside the framebuffer at certain coordinates.
      * If the requested length is not available, it will return nullptr.
@@ -276,6 +302,9 @@ public:
 
 private:
 
+    /** Number of LEDs in the matrix. */
+    static const uint16_t   PIXEL_COUNT = Board::LedMatrix::width * Board::LedMatrix::height;
+
     /**
      * Pixel representation of the LED matrix. Gamma correction disabled.
      */
@@ -290,6 +319,12 @@ private:
      */
     YAGfxStaticBitmap<Board::LedMatrix::width, Board::LedMatrix::height>    m_ledMatrix;
 
+    /**
+     * Maps the framebuffer pixel index (row by row) to the strip pixel index.
+     * The panel topology and the rotation are considered.
+     */
+    uint16_t                                                                m_pixelMap[PIXEL_COUNT];
+
     /**
      * Is display on?
      */
@@ -308,6 +343,11 @@ private:
     Display(const Display& display);
     Display& operator=(const Display& display);
 
+    /**
+     * Calculate the framebuffer to strip pixel mapping.
+     */
+    void initPixelMap();
+
     /**
      * Draw a single pixel on the display.
      *
@@ -82,33 +82,47 @@ Display::~Display()
 
 void Display::show()
 {
-    int32_t x;
-    int32_t y;
+    int16_t  dirtyX      = 0;
+    int16_t  dirtyY      = 0;
+    uint16_t dirtyWidth  = 0U;
+    uint16_t dirtyHeight = 0U;
 
-    for (y = 0; y < MATRIX_HEIGHT; ++y)
+    /* Only the changed matrix pixels are transferred to the TFT. */
+    if (true == m_ledMatrix.getDirtyRegion(dirtyX, dirtyY, dirtyWidth, dirtyHeight))
     {
-        for (x = 0; x < MATRIX_WIDTH; ++x)
+        int32_t x;
+        int32_t y;
+
+        for (y = dirtyY; y < (dirtyY + dirtyHeight); ++y)
         {
+            for (x = dirtyX; x < (dirtyX + dirtyWidth); ++x)
+            {
+                Color    brightnessAdjustedColor = m_ledMatrix.getColor(x, y);
 #if CONFIG_DISPLAY_ROTATE180 != 0
-            Color brightnessAdjustedColor = m_ledMatrix.getColor(MATRIX_WIDTH - x - 1, MATRIX_HEIGHT - y - 1);
+                int32_t  xMatrix      = MATRIX_WIDTH - x - 1;
+                int32_t  yMatrix      = MATRIX_HEIGHT - y - 1;
 #else
-            Color brightnessAdjustedColor = m_ledMatrix.getColor(x, y);
+                int32_t  xMatrix      = x;
+                int32_t  yMatrix      = y;
 #endif
-            uint16_t intensity    = brightnessAdjustedColor.getIntensity();
-            int32_t  xNative      = y * (PIXEL_HEIGHT + PiXEL_DISTANCE) + BORDER_Y;
-            int32_t  yNative      = TFT_HEIGHT - (x * (PIXEL_WIDTH + PiXEL_DISTANCE) + BORDER_X) - 1;
-
-            intensity            *= (static_cast<uint16_t>(m_brightness) + 1U);
-            intensity            /= 256U;
-            brightnessAdjustedColor.setIntensity(static_cast<uint8_t>(intensity));
-
-            m_tft.fillRect(
-                xNative,
-                yNative,
-                PIXEL_HEIGHT,
-                PIXEL_WIDTH,
-                brightnessAdjustedColor.toRgb565());
+                uint16_t intensity    = brightnessAdjustedColor.getIntensity();
+                int32_t  xNative      = yMatrix * (PIXEL_HEIGHT + PiXEL_DISTANCE) + BORDER_Y;
+                int32_t  yNative      = TFT_HEIGHT - (xMatrix * (PIXEL_WIDTH + PiXEL_DISTANCE) + BORDER_X) - 1;
+
+                intensity            *= (static_cast<uint16_t>(m_brightness) + 1U);
+                intensity            /= 256U;
+                brightnessAdjustedColor.setIntensity(static_cast<uint8_t>(intensity));
+
+                m_tft.fillRect(
+                    xNative,
+                    yNative,
+                    PIXEL_HEIGHT,
+                    PIXEL_WIDTH,
+                    brightnessAdjustedColor.toRgb565());
+            }
         }
+
+        m_ledMatrix.clearDirty();
     }
 }
 
@@ -260,48 +260,6 @@ bool IconTextLampPlugin::setTopic(const String& topic, const JsonObjectConst& va
     return isSuccessful;
 }
 
-bool IconTextLampPlugin::hasTopicChanged(const String& topic)
-{
-    bool hasTopicChanged = false;
-
-    if (true == topic.equals(TOPIC_TEXT))
-    {
-        MutexGuard<MutexRecursive> guard(m_mutex);
-
-        hasTopicChanged       = m_hasTopicTextChanged;
-        m_hasTopicTextChanged = false;
-    }
-    else if (true == topic.equals(TOPIC_LAMPS))
-    {
-        MutexGuard<MutexRecursive> guard(m_mutex);
-
-        hasTopicChanged        = m_hasTopicLampsChanged;
-        m_hasTopicLampsChanged = false;
-    }
-    else if (true == topic.startsWith(String(TOPIC_LAMP) + "/"))
-    {
-        uint32_t indexBeginLampId = topic.lastIndexOf("/") + 1U;
-        String   lampIdStr        = topic.substring(indexBeginLampId);
-        uint8_t  lampId           = _IconTextLampPlugin::View::MAX_LAMPS;
-        bool     status           = Util::strToUInt8(lampIdStr, lampId);
-
-        if ((true == status) &&
-            (_IconTextLampPlugin::View::MAX_LAMPS > lampId))
-        {
-            MutexGuard<MutexRecursive> guard(m_mutex);
-
-            hasTopicChanged               = m_hasTopicLampChanged[lampId];
-            m_hasTopicLampChanged[lampId] = false;
-        }
-    }
-    else
-    {
-        ;
-    }
-
-    return hasTopicChanged;
-}
-
 void IconTextLampPlugin::start(uint16_t width, uint16_t height)
 {
     String                     iconFullPath;
@@ -366,7 +324,7 @@ void IconTextLampPlugin::setText(const String& formatText, bool storeFlag)
             requestStoreToPersistentMemory();
         }
 
-        m_hasTopicTextChanged = true;
+        notifyTopicChanged(TOPIC_TEXT);
     }
 }
 
@@ -378,8 +336,8 @@ bool IconTextLampPlugin::loadIcon(FileMgrService::FileId fileId, bool storeFlag)
 
     if (m_iconFileId != fileId)
     {
-        m_iconFileId          = fileId;
-        m_hasTopicTextChanged = true;
+        m_iconFileId = fileId;
+        notifyTopicChanged(TOPIC_TEXT);
 
         if (true == storeFlag)
         {
@@ -417,8 +375,8 @@ void IconTextLampPlugin::clearIcon(bool storeFlag)
         /* Clear icon first in the view (will close file). */
         m_view.clearIcon();
 
-        m_iconFileId          = FileMgrService::FILE_ID_INVALID;
-        m_hasTopicTextChanged = true;
+        m_iconFileId = FileMgrService::FILE_ID_INVALID;
+        notifyTopicChanged(TOPIC_TEXT);
 
         if (true == storeFlag)
         {
@@ -446,8 +404,8 @@ void IconTextLampPlugin::setLamp(uint8_t lampId, bool state)
         {
             m_view.setLamp(lampId, state);
 
-            m_hasTopicLampsChanged        = true;
-            m_hasTopicLampChanged[lampId] = true;
+            notifyTopicChanged(TOPIC_LAMPS);
+            notifyTopicChanged(String(TOPIC_LAMP) + "/" + lampId);
         }
     }
 }
@@ -514,14 +472,14 @@ bool IconTextLampPlugin::setActualConfiguration(const JsonObjectConst& jsonCfg)
                 }
             }
 
-            m_hasTopicTextChanged = true;
+            notifyTopicChanged(TOPIC_TEXT);
         }
 
         if (m_view.getFormatText() != newFormatText)
         {
             m_view.setFormatText(newFormatText);
 
-            m_hasTopicTextChanged = true;
+            notifyTopicChanged(TOPIC_TEXT);
         }
 
         status = true;
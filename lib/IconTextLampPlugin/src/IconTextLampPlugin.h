@@ -81,10 +81,7 @@ public:
         m_iconFileId(FileMgrService::FILE_ID_INVALID),
         m_formatTextStored(),
         m_iconFileIdStored(FileMgrService::FILE_ID_INVALID),
-        m_mutex(),
-        m_hasTopicTextChanged(false),
-        m_hasTopicLampsChanged(false),
-        m_hasTopicLampChanged{ false, false, false, false }
+        m_mutex()
     {
         (void)m_mutex.create();
     }
@@ -192,17 +189,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -308,9 +294,6 @@ private:
     String                    m_formatTextStored;                                          /**< It contains the format text, which is persistent stored. */
     FileMgrService::FileId    m_iconFileIdStored;                                          /**< Icon file id, which is persistent stored. */
     mutable MutexRecursive    m_mutex;                                                     /**< Mutex to protect against concurrent access. */
-    bool                      m_hasTopicTextChanged;                                       /**< Has the topic text content changed? Used to notify the TopicHandlerService about changes. */
-    bool                      m_hasTopicLampsChanged;                                      /**< Has the topic lamps content changed? Used to notify the TopicHandlerService about changes. */
-    bool                      m_hasTopicLampChanged[_IconTextLampPlugin::View::MAX_LAMPS]; /**< Has the topic lamp content changed? Used to notify the TopicHandlerService about changes. */
 
     /**
      * Get actual configuration in JSON.
@@ -186,19 +186,6 @@ bool IconTextPlugin::setTopic(const String& topic, const JsonObjectConst& value)
     return isSuccessful;
 }
 
-bool IconTextPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void IconTextPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -208,6 +195,7 @@ void IconTextPlugin::start(uint16_t width, uint16_t height)
     PluginWithConfig::start(width, height);
 
     m_view.setFormatText(m_formatTextStored);
+    m_isUpdateRequired = true;
 
     if (FileMgrService::FILE_ID_INVALID != m_iconFileId)
     {
@@ -240,6 +228,21 @@ void IconTextPlugin::update(YAGfx& gfx)
     MutexGuard<MutexRecursive> guard(m_mutex);
 
     m_view.update(gfx);
+    m_isUpdateRequired = false;
+}
+
+uint32_t IconTextPlugin::getTimeToNextUpdate() const
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+    uint32_t                   timeToNextUpdate = UINT32_MAX;
+
+    if ((true == m_isUpdateRequired) ||
+        (true == m_view.isAnimated()))
+    {
+        timeToNextUpdate = 0U;
+    }
+
+    return timeToNextUpdate;
 }
 
 String IconTextPlugin::getText() const
@@ -257,6 +260,7 @@ void IconTextPlugin::setText(const String& formatText, bool storeFlag)
     if (m_view.getFormatText() != formatText)
     {
         m_view.setFormatText(formatText);
+        m_isUpdateRequired = true;
 
         if (true == storeFlag)
         {
@@ -264,7 +268,7 @@ void IconTextPlugin::setText(const String& formatText, bool storeFlag)
             requestStoreToPersistentMemory();
         }
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_TEXT);
     }
 }
 
@@ -276,8 +280,8 @@ bool IconTextPlugin::loadIcon(FileMgrService::FileId fileId, bool storeFlag)
 
     if (m_iconFileId != fileId)
     {
-        m_iconFileId      = fileId;
-        m_hasTopicChanged = true;
+        m_iconFileId = fileId;
+        notifyTopicChanged(TOPIC_TEXT);
 
         if (true == storeFlag)
         {
@@ -303,6 +307,8 @@ bool IconTextPlugin::loadIcon(FileMgrService::FileId fileId, bool storeFlag)
         isSuccessful = m_view.loadIcon(iconFullPath);
     }
 
+    m_isUpdateRequired = true;
+
     return isSuccessful;
 }
 
@@ -315,8 +321,10 @@ void IconTextPlugin::clearIcon(bool storeFlag)
         /* Clear icon first in the view (will close file). */
         m_view.clearIcon();
 
-        m_iconFileId      = FileMgrService::FILE_ID_INVALID;
-        m_hasTopicChanged = true;
+        m_iconFileId       = FileMgrService::FILE_ID_INVALID;
+        m_isUpdateRequired = true;
+
+        notifyTopicChanged(TOPIC_TEXT);
 
         if (true == storeFlag)
         {
@@ -388,14 +396,18 @@ bool IconTextPlugin::setActualConfiguration(const JsonObjectConst& jsonCfg)
                 }
             }
 
-            m_hasTopicChanged = true;
+            m_isUpdateRequired = true;
+
+            notifyTopicChanged(TOPIC_TEXT);
         }
 
         if (m_view.getFormatText() != newFormatText)
         {
             m_view.setFormatText(newFormatText);
 
-            m_hasTopicChanged = true;
+            m_isUpdateRequired = true;
+
+            notifyTopicChanged(TOPIC_TEXT);
         }
 
         status = true;
@@ -81,7 +81,7 @@ public:
         m_formatTextStored(),
         m_iconFileIdStored(FileMgrService::FILE_ID_INVALID),
         m_mutex(),
-        m_hasTopicChanged(false)
+        m_isUpdateRequired(true)
     {
         (void)m_mutex.create();
     }
@@ -218,17 +218,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -257,6 +246,15 @@ public:
      */
     void update(YAGfx& gfx) final;
 
+    /**
+     * Get the duration until the plugin requires the next update() call.
+     * A static icon and text don't require any further update, until the
+     * content changes.
+     *
+     * @return Duration in ms. 0 means update in the next display refresh cycle.
+     */
+    uint32_t getTimeToNextUpdate() const final;
+
     /**
      * Get text.
      *
@@ -306,7 +304,7 @@ private:
     String                 m_formatTextStored; /**< It contains the format text, which is persistent stored. */
     FileMgrService::FileId m_iconFileIdStored; /**< Icon file id, which is persistent stored. */
     mutable MutexRecursive m_mutex;            /**< Mutex to protect against concurrent access. */
-    bool                   m_hasTopicChanged;  /**< Has the topic content changed? Used to notify the TopicHandlerService about changes. */
+    bool                   m_isUpdateRequired; /**< Has the view content changed since the last update()? */
 
     /**
      * Get actual configuration in JSON.
@@ -80,6 +80,7 @@ void MqttApiTopicHandler::start()
 void MqttApiTopicHandler::stop()
 {
     m_haExtension.stop();
+    m_jsonDoc.release();
 
     m_isStarted = false;
 }
@@ -376,9 +377,8 @@ void MqttApiTopicHandler::publishTopicStatesOnDemand()
 
 void MqttApiTopicHandler::write(const String& deviceId, const String& entityId, const String& topic, const uint8_t* payload, size_t size, SetTopicFunc setTopicFunc, UploadReqFunc uploadReqFunc)
 {
-    const size_t         JSON_DOC_SIZE = 4096U;
-    DynamicJsonDocument  jsonDoc(JSON_DOC_SIZE);
-    DeserializationError error = deserializeJson(jsonDoc, payload, size);
+    DynamicJsonDocument& jsonDoc = m_jsonDoc.get();
+    DeserializationError error   = deserializeJson(jsonDoc, payload, size);
 
     if (DeserializationError::Ok != error)
     {
@@ -468,10 +468,9 @@ void MqttApiTopicHandler::publish(const String& deviceId, const String& entityId
 {
     if (nullptr != getTopicFunc)
     {
-        const size_t        JSON_DOC_SIZE = 4096U;
-        DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-        JsonObject          jsonObj       = jsonDoc.createNestedObject("data");
-        String              mqttTopicBase = getMqttBaseTopic(deviceId, entityId, topic);
+        DynamicJsonDocument& jsonDoc       = m_jsonDoc.get();
+        JsonObject           jsonObj       = jsonDoc.createNestedObject("data");
+        String               mqttTopicBase = getMqttBaseTopic(deviceId, entityId, topic);
 
         if (true == getTopicFunc(topic, jsonObj))
         {
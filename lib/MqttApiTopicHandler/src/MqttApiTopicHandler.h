@@ -47,6 +47,7 @@
 #include <stdint.h>
 #include <ITopicHandler.h>
 #include <vector>
+#include <ReusableJsonDocument.hpp>
 
 #include "HomeAssistantMqtt.h"
 
@@ -73,7 +74,8 @@ public:
         m_isStarted(false),
         m_listOfTopicStates(),
         m_isMqttConnected(false),
-        m_haExtension()
+        m_haExtension(),
+        m_jsonDoc()
     {
     }
 
@@ -167,6 +169,14 @@ private:
      */
     static const size_t MAX_FILE_SIZE   = 1024U;
 
+    /**
+     * Size of the JSON document used to exchange the topic content with the
+     * plugins. Received and published topic contents are both handled in
+     * the main loop and never nested, therefore a single JSON document is
+     * shared between them.
+     */
+    static const size_t JSON_DOC_SIZE   = 4096U;
+
     /** MQTT path endpoint for read access. */
     static const char*  MQTT_ENDPOINT_READ_ACCESS;
 
@@ -178,6 +188,9 @@ private:
     bool                m_isMqttConnected;      /**< Is the MQTT connection to the broker established? */
     HomeAssistantMqtt   m_haExtension;          /**< Home Assistant extension */
 
+    /** JSON document for the topic content, allocated on first use. */
+    ReusableJsonDocument<JSON_DOC_SIZE> m_jsonDoc;
+
     MqttApiTopicHandler(const MqttApiTopicHandler& adapter);
     MqttApiTopicHandler& operator=(const MqttApiTopicHandler& adapter);
 
@@ -38,6 +38,7 @@
 #include <Logging.h>
 #include <WiFiClient.h>
 #include <WiFiClientSecure.h>
+#include <algorithm>
 
 /******************************************************************************
  * Compiler Switches
@@ -96,7 +97,8 @@ bool MqttBrokerConnection::setupClient(bool useTls, const char* rootCaCert, cons
         m_wifiClient = nullptr;
     }
 
-    if (nullptr == m_wifiClient)
+    if ((nullptr == m_wifiClient) &&
+        ((true == m_mutex.isAllocated()) || (true == m_mutex.create())))
     {
         if (false == useTls)
         {
@@ -175,6 +177,8 @@ void MqttBrokerConnection::disconnect()
         (void)m_mqttClient.disconnect();
 
         m_state = MqttTypes::STATE_IDLE;
+
+        clearOutboundQueue();
     }
 }
 
@@ -192,9 +196,52 @@ bool MqttBrokerConnection::publish(const char* topic, const char* msg, bool reta
 {
     bool isSuccessful = false;
 
-    if (nullptr != m_wifiClient)
+    if ((nullptr != m_wifiClient) &&
+        (MqttTypes::STATE_CONNECTED == m_state) &&
+        (nullptr != topic) &&
+        (nullptr != msg))
     {
-        isSuccessful = m_mqttClient.publish(topic, msg, retained);
+        MutexGuard<Mutex>       guard(m_mutex);
+        size_t                  msgSize = strlen(msg);
+        OutboundQueue::iterator it;
+
+        /* A not yet published message for the same topic is outdated. */
+        for (it = m_outboundQueue.begin(); it != m_outboundQueue.end(); ++it)
+        {
+            if (0 == strcmp((*it).topic.c_str(), topic))
+            {
+                break;
+            }
+        }
+
+        if (m_outboundQueue.end() != it)
+        {
+            size_t queueSize = m_outboundQueueSize - (*it).msg.length() + msgSize;
+
+            if (MAX_OUTBOUND_QUEUE_SIZE >= queueSize)
+            {
+                (*it).msg           = msg;
+                (*it).retained      = retained;
+                m_outboundQueueSize = queueSize;
+                isSuccessful        = true;
+            }
+        }
+        else
+        {
+            size_t queueSize = m_outboundQueueSize + strlen(topic) + msgSize;
+
+            if (MAX_OUTBOUND_QUEUE_SIZE >= queueSize)
+            {
+                m_outboundQueue.emplace_back(topic, msg, retained);
+                m_outboundQueueSize = queueSize;
+                isSuccessful        = true;
+            }
+        }
+
+        if (false == isSuccessful)
+        {
+            LOG_WARNING("MQTT outbound queue full, message dropped: %s", topic);
+        }
     }
 
     return isSuccessful;
@@ -209,37 +256,45 @@ bool MqttBrokerConnection::subscribe(const char* topic, MqttTypes::TopicCallback
 {
     bool isSuccessful = false;
 
-    if ((nullptr != m_wifiClient) && (nullptr != topic))
+    /* Register a topic only once! */
+    if ((nullptr != m_wifiClient) &&
+        (nullptr != topic) &&
+        (nullptr == findSubscriber(topic)))
     {
-        SubscriberList::const_iterator it;
-
-        /* Register a topic only once! */
-        for (it = m_subscriberList.begin(); it != m_subscriberList.end(); ++it)
+        if (true == m_mqttClient.connected())
         {
-            if (0 == strcmp((*it).topic.c_str(), topic))
+            if (false == m_mqttClient.subscribe(topic))
             {
-                break;
+                LOG_WARNING("MQTT topic subscription not possible: %s", topic);
+            }
+            else
+            {
+                isSuccessful = true;
             }
         }
+        else
+        {
+            /* Subscription takes place after connection establishment. */
+            isSuccessful = true;
+        }
 
-        if (it == m_subscriberList.end())
+        if (true == isSuccessful)
         {
-            if (false == m_mqttClient.connected())
+            uint32_t hash = getTopicHash(topic);
+
+            if (true == hasWildcard(topic))
             {
-                m_subscriberList.emplace_back(topic, callback);
-                isSuccessful = true;
+                m_wildcardSubscriberList.emplace_back(topic, hash, callback);
             }
             else
             {
-                if (false == m_mqttClient.subscribe(topic))
-                {
-                    LOG_WARNING("MQTT topic subscription not possible: %s", topic);
-                }
-                else
-                {
-                    m_subscriberList.emplace_back(topic, callback);
-                    isSuccessful = true;
-                }
+                /* Keep the list sorted by the topic hash. */
+                SubscriberList::iterator it = std::upper_bound(m_subscriberList.begin(), m_subscriberList.end(), hash,
+                    [](uint32_t value, const Subscriber& subscriber) -> bool {
+                        return value < subscriber.hash;
+                    });
+
+                (void)m_subscriberList.emplace(it, topic, hash, callback);
             }
         }
     }
@@ -256,21 +311,16 @@ void MqttBrokerConnection::unsubscribe(const char* topic)
 {
     if ((nullptr != m_wifiClient) && (nullptr != topic))
     {
-        SubscriberList::iterator it = m_subscriberList.begin();
+        Subscriber* subscriber = findSubscriber(topic);
 
-        while (m_subscriberList.end() != it)
+        if (nullptr != subscriber)
         {
-            if (0 == strcmp((*it).topic.c_str(), topic))
-            {
-                (void)m_mqttClient.unsubscribe((*it).topic.c_str());
-
-                (void)m_subscriberList.erase(it);
+            SubscriberList& list = (true == hasWildcard(topic)) ? m_wildcardSubscriberList : m_subscriberList;
 
-                /* Only one subscriber per topic, therefore break. */
-                break;
-            }
+            (void)m_mqttClient.unsubscribe(topic);
 
-            ++it;
+            /* Only one subscriber per topic. */
+            (void)list.erase(list.begin() + (subscriber - list.data()));
         }
     }
 }
@@ -360,20 +410,47 @@ void MqttBrokerConnection::connectedState()
         /* Try to reconnect later. */
         m_reconnectTimer.restart();
     }
+    else
+    {
+        publishOutboundQueue();
+    }
 }
 
 void MqttBrokerConnection::rxCallback(char* topic, uint8_t* payload, uint32_t length)
 {
+    Subscriber*                    subscriber = findSubscriber(topic);
     SubscriberList::const_iterator it;
+    size_t                         idx;
+
+    /* A subscriber may subscribe or unsubscribe in its callback, which changes
+     * the subscriber lists. Therefore the matching callbacks are copied first
+     * and called afterwards. The list and the topic are members, which keep
+     * their memory for the next message. The callbacks are called by the
+     * MQTT client loop, which is never called again from a callback.
+     */
+    m_rxCallbacks.clear();
+    m_rxTopic = topic;
+
+    if (nullptr != subscriber)
+    {
+        m_rxCallbacks.push_back(subscriber->callback);
+    }
 
-    for (it = m_subscriberList.begin(); it != m_subscriberList.end(); ++it)
+    for (it = m_wildcardSubscriberList.begin(); it != m_wildcardSubscriberList.end(); ++it)
     {
-        if (0 == strcmp((*it).topic.c_str(), topic))
+        if (true == isTopicMatching((*it).topic.c_str(), topic))
         {
-            (*it).callback(topic, payload, length);
-            break;
+            m_rxCallbacks.push_back((*it).callback);
         }
     }
+
+    for (idx = 0U; idx < m_rxCallbacks.size(); ++idx)
+    {
+        m_rxCallbacks[idx](m_rxTopic, payload, length);
+    }
+
+    /* Release the captured state of the callbacks, but keep the list memory. */
+    m_rxCallbacks.clear();
 }
 
 void MqttBrokerConnection::resubscribe()
@@ -387,6 +464,189 @@ void MqttBrokerConnection::resubscribe()
             LOG_WARNING("MQTT topic subscription not possible: %s", (*it).topic.c_str());
         }
     }
+
+    for (it = m_wildcardSubscriberList.begin(); it != m_wildcardSubscriberList.end(); ++it)
+    {
+        if (false == m_mqttClient.subscribe((*it).topic.c_str()))
+        {
+            LOG_WARNING("MQTT topic subscription not possible: %s", (*it).topic.c_str());
+        }
+    }
+}
+
+MqttBrokerConnection::Subscriber* MqttBrokerConnection::findSubscriber(const char* topic)
+{
+    Subscriber* subscriber = nullptr;
+
+    if (true == hasWildcard(topic))
+    {
+        SubscriberList::iterator it;
+
+        for (it = m_wildcardSubscriberList.begin(); it != m_wildcardSubscriberList.end(); ++it)
+        {
+            if (0 == strcmp((*it).topic.c_str(), topic))
+            {
+                subscriber = &(*it);
+                break;
+            }
+        }
+    }
+    else
+    {
+        uint32_t                 hash = getTopicHash(topic);
+        SubscriberList::iterator it   = std::lower_bound(m_subscriberList.begin(), m_subscriberList.end(), hash,
+            [](const Subscriber& subscriber, uint32_t value) -> bool {
+                return subscriber.hash < value;
+            });
+
+        /* Different topics may have the same hash. */
+        while ((m_subscriberList.end() != it) && (hash == (*it).hash))
+        {
+            if (0 == strcmp((*it).topic.c_str(), topic))
+            {
+                subscriber = &(*it);
+                break;
+            }
+
+            ++it;
+        }
+    }
+
+    return subscriber;
+}
+
+uint32_t MqttBrokerConnection::getTopicHash(const char* topic)
+{
+    /* 32-bit FNV-1a */
+    const uint32_t FNV_OFFSET_BASIS = 2166136261U;
+    const uint32_t FNV_PRIME        = 16777619U;
+    uint32_t       hash             = FNV_OFFSET_BASIS;
+
+    while ('\0' != *topic)
+    {
+        hash ^= static_cast<uint8_t>(*topic);
+        hash *= FNV_PRIME;
+        ++topic;
+    }
+
+    return hash;
+}
+
+bool MqttBrokerConnection::hasWildcard(const char* topic)
+{
+    return (nullptr != strpbrk(topic, "+#"));
+}
+
+bool MqttBrokerConnection::isTopicMatching(const char* filter, const char* topic)
+{
+    bool isMatching = false;
+    bool isDone     = false;
+
+    /* Topics which start with '$' are not matched by a filter, which starts with a wildcard. */
+    if (('$' == topic[0]) &&
+        (('+' == filter[0]) || ('#' == filter[0])))
+    {
+        isDone = true;
+    }
+
+    while (false == isDone)
+    {
+        /* Multi-level wildcard matches all remaining levels. */
+        if ('#' == *filter)
+        {
+            isMatching = true;
+            isDone     = true;
+        }
+        /* Single-level wildcard matches exactly one level. */
+        else if ('+' == *filter)
+        {
+            while (('\0' != *topic) && ('/' != *topic))
+            {
+                ++topic;
+            }
+
+            ++filter;
+        }
+        else if ('\0' == *filter)
+        {
+            isMatching = ('\0' == *topic);
+            isDone     = true;
+        }
+        else if (*filter == *topic)
+        {
+            ++filter;
+            ++topic;
+        }
+        /* "a/#" matches "a" too. */
+        else if (('\0' == *topic) &&
+                 (0 == strcmp(filter, "/#")))
+        {
+            isMatching = true;
+            isDone     = true;
+        }
+        else
+        {
+            isDone = true;
+        }
+    }
+
+    return isMatching;
+}
+
+void MqttBrokerConnection::publishOutboundQueue()
+{
+    size_t publishedSize = 0U;
+    bool   isDone        = false;
+
+    while (false == isDone)
+    {
+        String topic;
+        String msg;
+        bool   retained = false;
+
+        /* The mutex is not hold during publishing, because it may block
+         * on the socket.
+         */
+        {
+            MutexGuard<Mutex> guard(m_mutex);
+
+            /* At least one message is published per call. */
+            if ((true == m_outboundQueue.empty()) ||
+                (MAX_PUBLISH_SIZE_PER_PROCESS <= publishedSize))
+            {
+                isDone = true;
+            }
+            else
+            {
+                OutboundMessage& outboundMsg = m_outboundQueue.front();
+
+                topic    = std::move(outboundMsg.topic);
+                msg      = std::move(outboundMsg.msg);
+                retained = outboundMsg.retained;
+
+                m_outboundQueueSize -= topic.length() + msg.length();
+                (void)m_outboundQueue.erase(m_outboundQueue.begin());
+            }
+        }
+
+        if (false == isDone)
+        {
+            if (false == m_mqttClient.publish(topic.c_str(), msg.c_str(), retained))
+            {
+                LOG_WARNING("Couldn't publish %s.", topic.c_str());
+            }
+
+            publishedSize += topic.length() + msg.length();
+        }
+    }
+}
+
+void MqttBrokerConnection::clearOutboundQueue()
+{
+    MutexGuard<Mutex> guard(m_mutex);
+
+    m_outboundQueue.clear();
+    m_outboundQueueSize = 0U;
 }
 
 void MqttBrokerConnection::logMqttClientState()
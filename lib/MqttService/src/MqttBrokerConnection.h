@@ -47,6 +47,7 @@
 #include <vector>
 #include <SimpleTimer.hpp>
 #include <WiFiClient.h>
+#include <Mutex.hpp>
 #include "MqttTypes.h"
 
 /******************************************************************************
@@ -64,7 +65,12 @@
 /**
  * The MQTT broker connection handler. It manages the connection to a MQTT broker.
  * Provides publish and subscribe functionality. The subscribe functionality
- * supports one subscriber per topic.
+ * supports one subscriber per topic filter. A topic filter may contain the
+ * MQTT wildcards '+' and '#'.
+ *
+ * Published messages are queued and sent paced in process(), to avoid that
+ * a burst of messages blocks the calling task. A queued message for the same
+ * topic is replaced by the newer one.
  */
 class MqttBrokerConnection
 {
@@ -86,8 +92,15 @@ public:
         m_mqttClient(),
         m_state(MqttTypes::STATE_IDLE),
         m_subscriberList(),
-        m_reconnectTimer()
+        m_wildcardSubscriberList(),
+        m_reconnectTimer(),
+        m_mutex(),
+        m_outboundQueue(),
+        m_outboundQueueSize(0U),
+        m_rxCallbacks(),
+        m_rxTopic()
     {
+        m_rxCallbacks.reserve(RX_CALLBACKS_RESERVED);
     }
 
     /**
@@ -165,23 +178,27 @@ public:
 
     /**
      * Publish a message for a topic.
+     * The message is queued and sent during process(). A not yet sent message
+     * for the same topic is replaced.
      *
      * @param[in] topic     Message topic
      * @param[in] msg       Message itself
      * @param[in] retained  Retained message? Default is false.
      *
-     * @return If successful published, it will return true otherwise false.
+     * @return If successful queued, it will return true otherwise false.
      */
     bool publish(const String& topic, const String& msg, bool retained = false);
 
     /**
      * Publish a message for a topic.
+     * The message is queued and sent during process(). A not yet sent message
+     * for the same topic is replaced.
      *
      * @param[in] topic     Message topic
      * @param[in] msg       Message itself
      * @param[in] retained  Retained message? Default is false.
      *
-     * @return If successful published, it will return true otherwise false.
+     * @return If successful queued, it will return true otherwise false.
      */
     bool publish(const char* topic, const char* msg, bool retained = false);
 
@@ -229,16 +246,19 @@ private:
     struct Subscriber
     {
         String                   topic;    /**< The subscriber topic */
+        uint32_t                 hash;     /**< The hash of the subscriber topic */
         MqttTypes::TopicCallback callback; /**< The subscriber callback */
 
         /**
          * Constructs the Subscriber instance.
          *
          * @param[in] topic     The subscriber topic.
+         * @param[in] hash      The hash of the subscriber topic.
          * @param[in] callback  The subscriber callback.
          */
-        Subscriber(const String& topic, MqttTypes::TopicCallback callback) :
+        Subscriber(const String& topic, uint32_t hash, MqttTypes::TopicCallback callback) :
             topic(topic),
+            hash(hash),
             callback(callback)
         {
         }
@@ -254,6 +274,45 @@ private:
      */
     typedef std::vector<Subscriber> SubscriberList;
 
+    /**
+     * A message, which is not published yet.
+     */
+    struct OutboundMessage
+    {
+        String topic;    /**< Message topic */
+        String msg;      /**< Message itself */
+        bool   retained; /**< Retained message? */
+
+        /**
+         * Constructs the OutboundMessage instance.
+         *
+         * @param[in] topic     Message topic
+         * @param[in] msg       Message itself
+         * @param[in] retained  Retained message?
+         */
+        OutboundMessage(const char* topic, const char* msg, bool retained) :
+            topic(topic),
+            msg(msg),
+            retained(retained)
+        {
+        }
+
+        /**
+         * Default constructor is not supported.
+         */
+        OutboundMessage() = delete;
+    };
+
+    /**
+     * This type defines a queue of outbound messages.
+     */
+    typedef std::vector<OutboundMessage> OutboundQueue;
+
+    /**
+     * List of topic callbacks.
+     */
+    typedef std::vector<MqttTypes::TopicCallback> CallbackList;
+
     /** MQTT port */
     static const uint16_t MQTT_PORT         = 1883U;
 
@@ -275,20 +334,45 @@ private:
      */
     static const size_t MAX_BUFFER_SIZE     = 2048U;
 
+    /**
+     * Max. size of all queued outbound messages (topic and message) in byte.
+     * If a message doesn't fit anymore, it will be rejected.
+     */
+    static const size_t MAX_OUTBOUND_QUEUE_SIZE = 8192U;
+
+    /**
+     * Max. size of the outbound messages in byte, which are published per
+     * process() call. At least one message is published per call.
+     */
+    static const size_t MAX_PUBLISH_SIZE_PER_PROCESS = MAX_BUFFER_SIZE;
 
-    String              m_clientId;        /**< MQTT client identifier */
-    String              m_url;             /**< URL of the MQTT broker */
-    String              m_user;            /**< MQTT authentication: user name */
-    String              m_password;        /**< MQTT authentication: password */
-    uint16_t            m_port;            /**< MQTT port */
-    String              m_willTopic;       /**< Will topic */
-    String              m_birthPayload;    /**< Birth payload */
-    String              m_lastWillPayload; /**< Last will payload */
-    WiFiClient*         m_wifiClient;      /**< WiFi client */
-    PubSubClient        m_mqttClient;      /**< MQTT client */
-    MqttTypes::State    m_state;           /**< Connection state */
-    SubscriberList      m_subscriberList;  /**< List of subscribers */
-    SimpleTimer         m_reconnectTimer;  /**< Timer used for periodically reconnecting. */
+    /**
+     * Number of callbacks, which are reserved for a received message.
+     * It covers the exact subscriber and some wildcard subscribers, so the
+     * list is not extended on the receive path.
+     */
+    static const size_t RX_CALLBACKS_RESERVED = 4U;
+
+
+    String              m_clientId;               /**< MQTT client identifier */
+    String              m_url;                    /**< URL of the MQTT broker */
+    String              m_user;                   /**< MQTT authentication: user name */
+    String              m_password;               /**< MQTT authentication: password */
+    uint16_t            m_port;                   /**< MQTT port */
+    String              m_willTopic;              /**< Will topic */
+    String              m_birthPayload;           /**< Birth payload */
+    String              m_lastWillPayload;        /**< Last will payload */
+    WiFiClient*         m_wifiClient;             /**< WiFi client */
+    PubSubClient        m_mqttClient;             /**< MQTT client */
+    MqttTypes::State    m_state;                  /**< Connection state */
+    SubscriberList      m_subscriberList;         /**< List of subscribers without wildcards, sorted by the topic hash. */
+    SubscriberList      m_wildcardSubscriberList; /**< List of subscribers with wildcards */
+    SimpleTimer         m_reconnectTimer;         /**< Timer used for periodically reconnecting. */
+    Mutex               m_mutex;                  /**< Mutex to protect the outbound queue. */
+    OutboundQueue       m_outboundQueue;          /**< Queue of messages, which are not published yet. */
+    size_t              m_outboundQueueSize;      /**< Size of all queued outbound messages in byte. */
+    CallbackList        m_rxCallbacks;            /**< Callbacks matching the received message, reused for every message. */
+    String              m_rxTopic;                /**< Topic of the received message, reused for every message. */
 
     /* An instance shall not be copied. */
     MqttBrokerConnection(const MqttBrokerConnection& service);
@@ -318,6 +402,54 @@ private:
      */
     void resubscribe();
 
+    /**
+     * Find the subscriber of the topic filter.
+     *
+     * @param[in] topic The topic filter.
+     *
+     * @return If found, it will return the subscriber otherwise nullptr.
+     */
+    Subscriber* findSubscriber(const char* topic);
+
+    /**
+     * Get the hash of a topic.
+     *
+     * @param[in] topic The topic.
+     *
+     * @return Topic hash
+     */
+    static uint32_t getTopicHash(const char* topic);
+
+    /**
+     * Does the topic filter contain a wildcard?
+     *
+     * @param[in] topic The topic filter.
+     *
+     * @return If it contains a wildcard, it will return true otherwise false.
+     */
+    static bool hasWildcard(const char* topic);
+
+    /**
+     * Does the topic match the topic filter, considering the MQTT wildcards?
+     *
+     * @param[in] filter    The topic filter.
+     * @param[in] topic     The topic of a received message.
+     *
+     * @return If the topic matches, it will return true otherwise false.
+     */
+    static bool isTopicMatching(const char* filter, const char* topic);
+
+    /**
+     * Publish the queued outbound messages, limited by
+     * MAX_PUBLISH_SIZE_PER_PROCESS.
+     */
+    void publishOutboundQueue();
+
+    /**
+     * Remove all queued outbound messages.
+     */
+    void clearOutboundQueue();
+
     /**
      * Log the current MQTT client state.
      */
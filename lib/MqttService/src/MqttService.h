@@ -107,25 +107,27 @@ public:
 
     /**
      * Publish a message for a topic.
+     * The message is queued and sent paced during process().
      *
      * @param[in] instance  MQTT instance index.
      * @param[in] topic     Message topic
      * @param[in] msg       Message itself
      * @param[in] retained  Retained message? Default is false.
      *
-     * @return If successful published, it will return true otherwise false.
+     * @return If successful queued, it will return true otherwise false.
      */
     bool publish(uint8_t instance, const String& topic, const String& msg, bool retained = false);
 
     /**
      * Publish a message for a topic.
+     * The message is queued and sent paced during process().
      *
      * @param[in] instance  MQTT instance index.
      * @param[in] topic     Message topic
      * @param[in] msg       Message itself
      * @param[in] retained  Retained message? Default is false.
      *
-     * @return If successful published, it will return true otherwise false.
+     * @return If successful queued, it will return true otherwise false.
      */
     bool publish(uint8_t instance, const char* topic, const char* msg, bool retained = false);
 
@@ -213,39 +213,6 @@ bool MultiIconPlugin::setTopic(const String& topic, const JsonObjectConst& value
     return isSuccessful;
 }
 
-bool MultiIconPlugin::hasTopicChanged(const String& topic)
-{
-    bool hasTopicChanged = false;
-
-    if (true == topic.startsWith(String(TOPIC_SLOT) + "/"))
-    {
-        uint8_t slotId = _MultiIconPlugin::View::MAX_ICON_SLOTS;
-        bool    status = getSlotIdFromTopic(slotId, topic);
-
-        if ((true == status) &&
-            (_MultiIconPlugin::View::MAX_ICON_SLOTS > slotId))
-        {
-            MutexGuard<MutexRecursive> guard(m_mutex);
-
-            hasTopicChanged                = m_slots[slotId].hasSlotChanged;
-            m_slots[slotId].hasSlotChanged = false;
-        }
-    }
-    else if (true == topic.equals(TOPIC_SLOTS))
-    {
-        MutexGuard<MutexRecursive> guard(m_mutex);
-
-        hasTopicChanged        = m_hasTopicSlotsChanged;
-        m_hasTopicSlotsChanged = false;
-    }
-    else
-    {
-        ;
-    }
-
-    return hasTopicChanged;
-}
-
 void MultiIconPlugin::start(uint16_t width, uint16_t height)
 {
     uint8_t                    slotId;
@@ -316,9 +283,10 @@ bool MultiIconPlugin::loadIcon(uint8_t slotId, FileMgrService::FileId fileId)
         IconSlot&                  iconSlot = m_slots[slotId];
         String                     iconFullPath;
 
-        iconSlot.fileId         = fileId;
-        iconSlot.hasSlotChanged = true;
-        m_hasTopicSlotsChanged  = true;
+        iconSlot.fileId = fileId;
+
+        notifyTopicChanged(String(TOPIC_SLOT) + "/" + slotId);
+        notifyTopicChanged(TOPIC_SLOTS);
 
         if (FileMgrService::FILE_ID_INVALID == iconSlot.fileId)
         {
@@ -351,9 +319,10 @@ void MultiIconPlugin::clearIcon(uint8_t slotId)
         MutexGuard<MutexRecursive> guard(m_mutex);
         IconSlot&                  iconSlot = m_slots[slotId];
 
-        iconSlot.fileId                     = FileMgrService::FILE_ID_INVALID;
-        iconSlot.hasSlotChanged             = true;
-        m_hasTopicSlotsChanged              = true;
+        iconSlot.fileId = FileMgrService::FILE_ID_INVALID;
+
+        notifyTopicChanged(String(TOPIC_SLOT) + "/" + slotId);
+        notifyTopicChanged(TOPIC_SLOTS);
 
         m_view.clearIcon(slotId);
     }
@@ -77,8 +77,7 @@ public:
         PluginWithConfig(name, uid, FILESYSTEM),
         m_view(),
         m_slots(),
-        m_mutex(),
-        m_hasTopicSlotsChanged(false)
+        m_mutex()
     {
         (void)m_mutex.create();
     }
@@ -186,17 +185,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -275,15 +263,13 @@ private:
      */
     struct IconSlot
     {
-        FileMgrService::FileId fileId;         /**< File id of the icon. */
-        bool                   hasSlotChanged; /**< Has slot changed since last time? */
+        FileMgrService::FileId fileId; /**< File id of the icon. */
 
         /**
          * Construct icon slot.
          */
         IconSlot() :
-            fileId(FileMgrService::FILE_ID_INVALID),
-            hasSlotChanged(false)
+            fileId(FileMgrService::FILE_ID_INVALID)
         {
         }
 
@@ -298,7 +284,6 @@ private:
     _MultiIconPlugin::View m_view;                                          /**< View with all widgets. */
     IconSlot               m_slots[_MultiIconPlugin::View::MAX_ICON_SLOTS]; /**< Icon slots. */
     mutable MutexRecursive m_mutex;                                         /**< Mutex to protect against concurrent access. */
-    bool                   m_hasTopicSlotsChanged;                          /**< Has the topic content changed? Used to notify the TopicHandlerService about changes. */
 
     /**
      * Get persistent configuration in JSON.
@@ -173,19 +173,6 @@ bool OpenMeteoPlugin::setTopic(const String& topic, const JsonObjectConst& value
     return isSuccessful;
 }
 
-bool OpenMeteoPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void OpenMeteoPlugin::setSlot(const ISlotPlugin* slotInterf)
 {
     m_slotInterf = slotInterf;
@@ -402,7 +389,7 @@ bool OpenMeteoPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         /* Force update on display */
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
 
         status            = true;
     }
@@ -412,53 +399,8 @@ bool OpenMeteoPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
 
 bool OpenMeteoPlugin::startHttpRequest()
 {
-    bool                            status = false;
-    RestService::PreProcessCallback preProcessCallback =
-        [this](const char* payload, size_t size, DynamicJsonDocument& doc) {
-            return this->preProcessAsyncWebResponse(payload, size, doc);
-        };
-
-    if ((false == m_latitude.isEmpty()) &&
-        (false == m_longitude.isEmpty()) &&
-        (false == m_temperatureUnit.isEmpty()) &&
-        (false == m_windUnit.isEmpty()))
-    {
-        String url       = OPEN_METEO_BASE_URI;
-
-        /* Documentation:
-         * https://open-meteo.com/en/docs#current=temperature_2m,relative_humidity_2m,is_day,weather_code,wind_speed_10m&hourly=&daily=weather_code,temperature_2m_max,temperature_2m_min,uv_index_max
-         */
-        url             += "/v1/forecast?latitude=";
-        url             += m_latitude;
-        url             += "&longitude=";
-        url             += m_longitude;
-        url             += "&current=temperature_2m,relative_humidity_2m,is_day,weather_code,wind_speed_10m,uv_index";
-        url             += "&daily=weather_code,temperature_2m_max,temperature_2m_min";
-        url             += "&timezone=auto";
-        url             += "&temperature_unit=";
-        url             += m_temperatureUnit;
-        url             += "&wind_speed_unit=";
-        url             += m_windUnit;
-
-        m_dynamicRestId  = RestService::getInstance().get(url, preProcessCallback);
-
-        if (RestService::INVALID_REST_ID == m_dynamicRestId)
-        {
-            LOG_WARNING("GET %s failed.", url.c_str());
-        }
-        else
-        {
-            status = true;
-        }
-    }
-
-    return status;
-}
-
-bool OpenMeteoPlugin::preProcessAsyncWebResponse(const char* payload, size_t payloadSize, DynamicJsonDocument& jsonDoc)
-{
-    bool                isSuccessful = false;
-    const size_t        FILTER_SIZE  = 640U;
+    bool                status      = false;
+    const size_t        FILTER_SIZE = 640U;
     DynamicJsonDocument jsonFilterDoc(FILTER_SIZE);
 
     /* Example:
@@ -553,26 +495,45 @@ bool OpenMeteoPlugin::preProcessAsyncWebResponse(const char* payload, size_t pay
     {
         LOG_ERROR("Less memory for filter available.");
     }
-    else if ((nullptr == payload) ||
-             (0U == payloadSize))
-    {
-        LOG_ERROR("No payload.");
-    }
-    else
+    else if ((false == m_latitude.isEmpty()) &&
+             (false == m_longitude.isEmpty()) &&
+             (false == m_temperatureUnit.isEmpty()) &&
+             (false == m_windUnit.isEmpty()))
     {
-        DeserializationError error = deserializeJson(jsonDoc, payload, payloadSize, DeserializationOption::Filter(jsonFilterDoc));
+        String url       = OPEN_METEO_BASE_URI;
 
-        if (DeserializationError::Ok != error.code())
+        /* Documentation:
+         * https://open-meteo.com/en/docs#current=temperature_2m,relative_humidity_2m,is_day,weather_code,wind_speed_10m&hourly=&daily=weather_code,temperature_2m_max,temperature_2m_min,uv_index_max
+         */
+        url             += "/v1/forecast?latitude=";
+        url             += m_latitude;
+        url             += "&longitude=";
+        url             += m_longitude;
+        url             += "&current=temperature_2m,relative_humidity_2m,is_day,weather_code,wind_speed_10m,uv_index";
+        url             += "&daily=weather_code,temperature_2m_max,temperature_2m_min";
+        url             += "&timezone=auto";
+        url             += "&temperature_unit=";
+        url             += m_temperatureUnit;
+        url             += "&wind_speed_unit=";
+        url             += m_windUnit;
+
+        m_dynamicRestId  = RestService::getInstance().get(url, jsonFilterDoc, getUID());
+
+        if (RestService::INVALID_REST_ID == m_dynamicRestId)
         {
-            LOG_WARNING("JSON parse error: %s", error.c_str());
+            LOG_WARNING("GET %s failed.", url.c_str());
         }
         else
         {
-            isSuccessful = true;
+            status = true;
         }
     }
+    else
+    {
+        ;
+    }
 
-    return isSuccessful;
+    return status;
 }
 
 void OpenMeteoPlugin::setViewUnits()
@@ -84,7 +84,6 @@ public:
         m_requestTimer(),
         m_mutex(),
         m_slotInterf(nullptr),
-        m_hasTopicChanged(false),
         m_dynamicRestId(RestService::INVALID_REST_ID),
         m_isAllowedToSend(true)
     {
@@ -218,17 +217,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Set the slot interface, which the plugin can used to request information
      * from the slot, it is plugged in.
@@ -335,7 +323,6 @@ private:
     SimpleTimer            m_requestTimer;    /**< Timer used for cyclic request of new data. */
     mutable MutexRecursive m_mutex;           /**< Mutex to protect against concurrent access. */
     const ISlotPlugin*     m_slotInterf;      /**< Slot interface */
-    bool                   m_hasTopicChanged; /**< Has the topic content changed? */
     uint32_t               m_dynamicRestId;   /**< Used to identify plugin when interacting with RestService. Id changes with every request. */
     bool                   m_isAllowedToSend; /**< Is allowed to send REST-Api request? */
 
@@ -369,18 +356,6 @@ private:
      */
     bool startHttpRequest();
 
-    /**
-     * Handle asynchronous web response from the server.
-     * This will be called in LwIP context! Don't modify any member here directly!
-     *
-     * @param[in] payload     Payload of the web response
-     * @param[in] payloadSize Size of the payload
-     * @param[out] jsonDoc    DynamicJsonDocument used to store result in.
-     *
-     * @return If successful it will return true otherwise false.
-     */
-    bool preProcessAsyncWebResponse(const char* payload, size_t payloadSize, DynamicJsonDocument& jsonDoc);
-
     /**
      * Set the view units for temperature and wind speed,
      * according to the configuration.
@@ -184,19 +184,6 @@ bool OpenWeatherPlugin::setTopic(const String& topic, const JsonObjectConst& val
     return isSuccessful;
 }
 
-bool OpenWeatherPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void OpenWeatherPlugin::setSlot(const ISlotPlugin* slotInterf)
 {
     m_slotInterf = slotInterf;
@@ -530,7 +517,7 @@ bool OpenWeatherPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         /* Force update on display */
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
 
         status            = true;
     }
@@ -540,11 +527,9 @@ bool OpenWeatherPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
 
 bool OpenWeatherPlugin::startHttpRequest(const IOpenWeatherGeneric* source)
 {
-    bool                            status = false;
-    RestService::PreProcessCallback preProcessCallback =
-        [this](const char* payload, size_t size, DynamicJsonDocument& doc) {
-            return this->preProcessAsyncWebResponse(payload, size, doc);
-        };
+    bool                            status      = false;
+    const size_t                    FILTER_SIZE = 640U;
+    StaticJsonDocument<FILTER_SIZE> jsonFilterDoc;
 
     if ((nullptr != source) &&
         (false == source->getApiKey().isEmpty()) &&
@@ -552,36 +537,6 @@ bool OpenWeatherPlugin::startHttpRequest(const IOpenWeatherGeneric* source)
         (false == source->getLongitude().isEmpty()) &&
         (false == source->getUnits().isEmpty()))
     {
-        String url = OPEN_WEATHER_BASE_URI;
-
-        source->getUrl(url);
-
-        m_dynamicRestId = RestService::getInstance().get(url, preProcessCallback);
-
-        if (RestService::INVALID_REST_ID == m_dynamicRestId)
-        {
-            LOG_WARNING("GET %s failed.", url.c_str());
-        }
-        else
-        {
-            status = true;
-        }
-    }
-
-    return status;
-}
-
-bool OpenWeatherPlugin::preProcessAsyncWebResponse(const char* payload, size_t payloadSize, DynamicJsonDocument& jsonDoc)
-{
-    bool                       isSuccessful = false;
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    const IOpenWeatherGeneric* source = getWeatherSourceByStatus();
-
-    if (nullptr != source)
-    {
-        const size_t                    FILTER_SIZE = 640U;
-        StaticJsonDocument<FILTER_SIZE> jsonFilterDoc;
-
         source->getFilter(jsonFilterDoc);
 
         if (true == jsonFilterDoc.overflowed())
@@ -590,20 +545,24 @@ bool OpenWeatherPlugin::preProcessAsyncWebResponse(const char* payload, size_t p
         }
         else
         {
-            DeserializationError error = deserializeJson(jsonDoc, payload, payloadSize, DeserializationOption::Filter(jsonFilterDoc));
+            String url = OPEN_WEATHER_BASE_URI;
+
+            source->getUrl(url);
 
-            if (DeserializationError::Ok != error.code())
+            m_dynamicRestId = RestService::getInstance().get(url, jsonFilterDoc, getUID());
+
+            if (RestService::INVALID_REST_ID == m_dynamicRestId)
             {
-                LOG_WARNING("JSON parse error: %s", error.c_str());
+                LOG_WARNING("GET %s failed.", url.c_str());
             }
             else
             {
-                isSuccessful = true;
+                status = true;
             }
         }
     }
 
-    return isSuccessful;
+    return status;
 }
 
 void OpenWeatherPlugin::handleWebResponse(const DynamicJsonDocument& jsonDoc)
@@ -166,6 +166,23 @@ public:
      */
     bool isRunning() const;
 
+    /**
+     * Notify the task, e.g. to wake it up while it waits in
+     * waitForNotification(). Can be called from any other task.
+     */
+    void notify();
+
+    /**
+     * Wait for a notification by notify() or until the timeout is over.
+     * This shall only be called by the task function or the process() method
+     * of the task itself.
+     *
+     * @param[in] timeout   Timeout in ms.
+     *
+     * @return If notified, it will return true otherwise false.
+     */
+    static bool waitForNotification(uint32_t timeout);
+
     /**
      * Default stack size in bytes.
      */
@@ -301,8 +318,9 @@ bool Task<T>::stop(uint32_t timeout)
 
     if (nullptr != m_taskHandle)
     {
-        /* Request the task to exit. */
+        /* Request the task to exit and wake it up, in case it waits for a notification. */
         m_reqExit = true;
+        (void)xTaskNotifyGive(m_taskHandle);
 
         /* Wait until the task has exited.
          * We don't care about the return value, because the task
@@ -338,6 +356,28 @@ bool Task<T>::isRunning() const
     return isRunning;
 }
 
+template <typename T>
+void Task<T>::notify()
+{
+    if (nullptr != m_taskHandle)
+    {
+        (void)xTaskNotifyGive(m_taskHandle);
+    }
+}
+
+template <typename T>
+bool Task<T>::waitForNotification(uint32_t timeout)
+{
+    bool isNotified = false;
+
+    if (0U < ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout)))
+    {
+        isNotified = true;
+    }
+
+    return isNotified;
+}
+
 template <typename T>
 void Task<T>::lowLevelTaskFunction(void* parameters)
 {
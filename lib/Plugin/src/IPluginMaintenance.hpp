@@ -49,6 +49,7 @@
 #include <ArduinoJson.h>
 #include <Fonts.h>
 #include "ISlotPlugin.hpp"
+#include "ITopicChangeListener.hpp"
 
 /******************************************************************************
  * Macros
@@ -205,15 +206,14 @@ public:
     virtual bool setTopic(const String& topic, const JsonObjectConst& value) = 0;
 
     /**
-     * Has the topic content changed since last time?
+     * Set the topic change listener, which the plugin shall notify about
+     * changed topic content.
      * Every readable volatile topic shall support this. Otherwise the topic
      * handlers might not be able to provide updated information.
      * 
-     * @param[in] topic The topic which to check.
-     * 
-     * @return If the topic content changed since last time, it will return true otherwise false.
+     * @param[in] listener  Topic change listener, may be nullptr.
      */
-    virtual bool hasTopicChanged(const String& topic) = 0;
+    virtual void setTopicChangeListener(ITopicChangeListener* listener) = 0;
 
     /**
      * Is a upload request accepted or rejected?
@@ -311,6 +311,19 @@ public:
      */
     virtual void update(YAGfx& gfx) = 0;
 
+    /**
+     * Get the duration until the plugin requires the next update() call,
+     * e.g. because of an animation or a scrolling text. The display manager
+     * may skip update() calls until then, as long as nothing else changes
+     * on the display.
+     *
+     * If the display content changed in any other way, e.g. by setTopic()
+     * or process(), it shall return 0 until the next update() call.
+     *
+     * @return Duration in ms. 0 means update in the next display refresh cycle.
+     */
+    virtual uint32_t getTimeToNextUpdate() const = 0;
+
 protected:
 
     /**
@@ -0,0 +1,99 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   ITopicChangeListener.hpp
+ * @brief  Topic change listener interface for plugins
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup PLUGIN
+ *
+ * @{
+ */
+
+#ifndef ITOPICCHANGELISTENER_HPP
+#define ITOPICCHANGELISTENER_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <WString.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+class IPluginMaintenance;
+
+/**
+ * The topic change listener interface, which is notified by the plugins
+ * about changed topic content.
+ */
+class ITopicChangeListener
+{
+public:
+
+    /**
+     * Destroys the interface.
+     */
+    virtual ~ITopicChangeListener()
+    {
+    }
+
+    /**
+     * Notifies about changed topic content.
+     * It may be called from any task context.
+     *
+     * @param[in] plugin    The plugin, which topic content changed.
+     * @param[in] topic     The topic, which content changed.
+     */
+    virtual void onTopicChanged(IPluginMaintenance* plugin, const String& topic) = 0;
+
+protected:
+
+    /**
+     * Constructs the interface.
+     */
+    ITopicChangeListener()
+    {
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* ITOPICCHANGELISTENER_HPP */
+
+/** @} */
\ No newline at end of file
@@ -236,18 +236,14 @@ public:
     }
 
     /**
-     * Has the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
+     * Set the topic change listener, which the plugin shall notify about
+     * changed topic content.
      * 
-     * @param[in] topic The topic which to check.
-     * 
-     * @return If the topic content changed since last time, it will return true otherwise false.
+     * @param[in] listener  Topic change listener, may be nullptr.
      */
-    bool hasTopicChanged(const String& topic) override
+    void setTopicChangeListener(ITopicChangeListener* listener) final
     {
-        PLUGIN_NOT_USED(topic);
-        return false;
+        m_topicChangeListener = listener;
     }
 
     /**
@@ -369,6 +365,20 @@ public:
     {
     }
 
+    /**
+     * Get the duration until the plugin requires the next update() call.
+     * Overwrite it if your plugin content is static for a while, to avoid
+     * unnecessary display updates.
+     *
+     * By default the plugin is updated in every display refresh cycle.
+     *
+     * @return Duration in ms. 0 means update in the next display refresh cycle.
+     */
+    uint32_t getTimeToNextUpdate() const override
+    {
+        return 0U;
+    }
+
     /**
      * Generate the full path for any plugin instance specific kind of configuration
      * file.
@@ -403,15 +413,33 @@ protected:
         m_isEnabled(false),
         m_uid(uid),
         m_alias(),
-        m_name(name)
+        m_name(name),
+        m_topicChangeListener(nullptr)
+    {
+    }
+
+    /**
+     * Notify the topic change listener about changed topic content.
+     * Every readable volatile topic shall call this, after its content changed.
+     * 
+     * @param[in] topic The topic, which content changed.
+     */
+    void notifyTopicChanged(const String& topic)
     {
+        ITopicChangeListener* listener = m_topicChangeListener;
+
+        if (nullptr != listener)
+        {
+            listener->onTopicChanged(this, topic);
+        }
     }
 
 private:
 
-    const uint16_t  m_uid;      /**< Unique id */
-    String          m_alias;    /**< Alias name */
-    const char*     m_name;     /**< Plugin name */
+    const uint16_t          m_uid;                  /**< Unique id */
+    String                  m_alias;                /**< Alias name */
+    const char*             m_name;                 /**< Plugin name */
+    ITopicChangeListener*   m_topicChangeListener;  /**< Topic change listener */
 
     Plugin();
     Plugin(const Plugin& plugin);
@@ -174,11 +174,10 @@ String RestApiTopicHandler::getUri(const String& entityId, const String& topic)
 
 void RestApiTopicHandler::webReqHandler(AsyncWebServerRequest* request, TopicMetaData* topicMetaData)
 {
-    String              content;
-    const size_t        JSON_DOC_SIZE = 4096U;
-    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
-    JsonObject          dataObj        = jsonDoc.createNestedObject("data");
-    uint32_t            httpStatusCode = HttpStatus::STATUS_CODE_OK;
+    String               content;
+    DynamicJsonDocument& jsonDoc        = m_jsonDocRsp.get();
+    JsonObject           dataObj        = jsonDoc.createNestedObject("data");
+    uint32_t             httpStatusCode = HttpStatus::STATUS_CODE_OK;
 
     if ((nullptr == request) ||
         (nullptr == topicMetaData))
@@ -234,8 +233,8 @@ void RestApiTopicHandler::webReqHandler(AsyncWebServerRequest* request, TopicMet
     else if ((HTTP_POST == request->method()) &&
              (nullptr != topicMetaData->setTopicFunc))
     {
-        DynamicJsonDocument jsonDocPar(JSON_DOC_SIZE);
-        JsonObjectConst     jsonValue;
+        DynamicJsonDocument& jsonDocPar = m_jsonDocPar.get();
+        JsonObjectConst      jsonValue;
 
         /* JSON in the body has higher priority than the HTTP parameters! */
         if (nullptr == request->_tempObject)
@@ -48,6 +48,7 @@
 #include <ITopicHandler.h>
 #include <vector>
 #include <ESPAsyncWebServer.h>
+#include <ReusableJsonDocument.hpp>
 
 /******************************************************************************
  * Macros
@@ -69,7 +70,9 @@ public:
      */
     RestApiTopicHandler() :
         ITopicHandler(),
-        m_listOfTopicMetaData()
+        m_listOfTopicMetaData(),
+        m_jsonDocPar(),
+        m_jsonDocRsp()
     {
     }
 
@@ -161,6 +164,13 @@ public:
 
 private:
 
+    /**
+     * Size of the JSON documents used for the request parameters and the
+     * response. They are allocated on first use and reused for every
+     * further request, because all requests are handled in the same task.
+     */
+    static const size_t JSON_DOC_SIZE = 4096U;
+
     /**
      * Topic meta data.
      */
@@ -199,6 +209,8 @@ private:
     typedef std::vector<TopicMetaData*> ListOfTopicMetaData;
 
     ListOfTopicMetaData                 m_listOfTopicMetaData; /**< List of topic meta data. */
+    ReusableJsonDocument<JSON_DOC_SIZE> m_jsonDocPar;          /**< JSON document for the request parameters. */
+    ReusableJsonDocument<JSON_DOC_SIZE> m_jsonDocRsp;          /**< JSON document for the response. */
 
     RestApiTopicHandler(const RestApiTopicHandler& adapter);
     RestApiTopicHandler& operator=(const RestApiTopicHandler& adapter);
@@ -70,25 +70,37 @@ bool RestService::start()
     }
     else
     {
-        AsyncHttpClient::OnResponse rspCallback = [this](const HttpResponse& rsp) {
-            handleAsyncWebResponse(rsp);
-        };
-        AsyncHttpClient::OnError errCallback = [this]() {
-            handleFailedWebRequest();
-        };
-        AsyncHttpClient::OnClosed closedCallback = [this]() {
-            m_isWaitingForResponse = false;
-        };
-
         if (false == m_mutex.create())
         {
             isSuccessful = false;
         }
         else
         {
-            m_client.regOnResponse(rspCallback);
-            m_client.regOnError(errCallback);
-            m_client.regOnClosed(closedCallback);
+            size_t index;
+
+            for (index = 0U; index < CONFIG_REST_SERVICE_CLIENT_POOL_SIZE; ++index)
+            {
+                Connection&                 connection  = m_pool[index];
+                AsyncHttpClient&            client      = connection.client;
+                AsyncHttpClient::OnResponse rspCallback = [this, index](const HttpResponse& rsp) {
+                    handleAsyncWebResponse(index, rsp);
+                };
+                AsyncHttpClient::OnError errCallback = [this, index]() {
+                    handleFailedWebRequest(index);
+                };
+                AsyncHttpClient::OnClosed closedCallback = [this, index]() {
+                    handleClosedConnection(index);
+                };
+
+                client.regOnResponse(rspCallback);
+                client.regOnError(errCallback);
+                client.regOnClosed(closedCallback);
+
+                if (false == connection.streamMutex.create())
+                {
+                    isSuccessful = false;
+                }
+            }
         }
     }
 
@@ -111,14 +123,26 @@ bool RestService::start()
 
 void RestService::stop()
 {
-    m_client.regOnResponse(nullptr);
-    m_client.regOnError(nullptr);
-    m_client.regOnClosed(nullptr);
+    size_t index;
+
+    for (index = 0U; index < CONFIG_REST_SERVICE_CLIENT_POOL_SIZE; ++index)
+    {
+        Connection& connection = m_pool[index];
+
+        connection.client.regOnResponse(nullptr);
+        connection.client.regOnError(nullptr);
+        connection.client.regOnClosed(nullptr);
+        connection.client.regOnBodyData(nullptr);
+        connection.client.end();
+        connection.state = CONNECTION_STATE_IDLE;
+        connection.host.clear();
+        releaseRequest(connection);
+        connection.streamMutex.destroy();
+    }
+
     m_requestQueue.clear();
-    m_client.end();
     m_responseQueue.clear();
-    m_activeRestId             = INVALID_REST_ID;
-    m_activePreProcessCallback = nullptr;
+    m_statistics.clear();
 
     m_mutex.destroy();
 
@@ -133,68 +157,25 @@ void RestService::process()
 {
     if (true == m_isRunning)
     {
-        MutexGuard<Mutex> guard(m_mutex);
-
-        if (false == m_isWaitingForResponse)
+        /* Protect against concurrent access. */
         {
-            bool    isError = false;
-            Request req;
-
-            if (false == m_requestQueue.empty())
-            {
-                m_isWaitingForResponse = true;
-
-                /* Take first request from queue. */
-                req                    = std::move(m_requestQueue.front());
-                m_requestQueue.erase(m_requestQueue.begin());
-                m_activeRestId             = req.restId;
-                m_activePreProcessCallback = req.preProcessCallback;
+            MutexGuard<Mutex> guard(m_mutex);
 
-                if (true == m_client.begin(String(req.url)))
-                {
-                    switch (req.id)
-                    {
-                    case REQUEST_ID_GET:
-                        if (false == m_client.GET())
-                        {
-                            isError = true;
-                        }
-                        break;
+            handleTimeouts();
+        }
 
-                    case REQUEST_ID_POST:
-                        if (false == m_client.POST(req.data.data, req.data.size))
-                        {
-                            isError = true;
-                        }
-                        break;
+        abortConnections();
 
-                    default:
-                        break;
-                    };
-                }
-                else
-                {
-                    LOG_ERROR("URL could not be parsed");
-                    isError = true;
-                }
-            }
+        /* Protect against concurrent access. */
+        {
+            MutexGuard<Mutex> guard(m_mutex);
 
-            if (true == isError)
-            {
-                Response rsp(0U);
-
-                rsp.restId = req.restId;
-                rsp.isRsp  = false;
-                m_responseQueue.push_back(std::move(rsp));
-                m_activeRestId             = INVALID_REST_ID;
-                m_activePreProcessCallback = nullptr;
-                m_isWaitingForResponse     = false;
-            }
+            dispatchRequests();
         }
     }
 }
 
-uint32_t RestService::get(const String& url, PreProcessCallback preProcessCallback)
+uint32_t RestService::get(const String& url, PreProcessCallback preProcessCallback, uint16_t uid)
 {
     uint32_t restId = INVALID_REST_ID;
 
@@ -206,6 +187,8 @@ uint32_t RestService::get(const String& url, PreProcessCallback preProcessCallba
         restId                 = getRestId();
         req.id                 = REQUEST_ID_GET;
         req.restId             = restId;
+        req.uid                = uid;
+        req.timestamp          = millis();
         req.preProcessCallback = preProcessCallback;
         req.url                = url;
 
@@ -215,7 +198,7 @@ uint32_t RestService::get(const String& url, PreProcessCallback preProcessCallba
     return restId;
 }
 
-uint32_t RestService::post(const String& url, PreProcessCallback preProcessCallback, const uint8_t* payload, size_t size)
+uint32_t RestService::post(const String& url, PreProcessCallback preProcessCallback, const uint8_t* payload, size_t size, uint16_t uid)
 {
     uint32_t restId = INVALID_REST_ID;
 
@@ -227,6 +210,8 @@ uint32_t RestService::post(const String& url, PreProcessCallback preProcessCallb
         restId                 = getRestId();
         req.id                 = REQUEST_ID_POST;
         req.restId             = restId;
+        req.uid                = uid;
+        req.timestamp          = millis();
         req.preProcessCallback = preProcessCallback;
         req.url                = url;
         req.data.data          = payload;
@@ -238,7 +223,7 @@ uint32_t RestService::post(const String& url, PreProcessCallback preProcessCallb
     return restId;
 }
 
-uint32_t RestService::post(const String& url, const String& payload, PreProcessCallback preProcessCallback)
+uint32_t RestService::post(const String& url, const String& payload, PreProcessCallback preProcessCallback, uint16_t uid)
 {
     uint32_t restId = INVALID_REST_ID;
 
@@ -250,6 +235,8 @@ uint32_t RestService::post(const String& url, const String& payload, PreProcessC
         restId                 = getRestId();
         req.id                 = REQUEST_ID_POST;
         req.restId             = restId;
+        req.uid                = uid;
+        req.timestamp          = millis();
         req.url                = url;
         req.preProcessCallback = preProcessCallback;
         req.data.data          = reinterpret_cast<const uint8_t*>(payload.c_str());
@@ -261,6 +248,56 @@ uint32_t RestService::post(const String& url, const String& payload, PreProcessC
     return restId;
 }
 
+uint32_t RestService::get(const String& url, const JsonDocument& filter, uint16_t uid)
+{
+    uint32_t restId = INVALID_REST_ID;
+
+    if (true == m_isRunning)
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+        Request           req;
+
+        restId        = getRestId();
+        req.id        = REQUEST_ID_GET;
+        req.restId    = restId;
+        req.uid       = uid;
+        req.timestamp = millis();
+        req.url       = url;
+
+        (void)serializeJson(filter, req.filter);
+
+        m_requestQueue.push_back(std::move(req));
+    }
+
+    return restId;
+}
+
+uint32_t RestService::post(const String& url, const JsonDocument& filter, const uint8_t* payload, size_t size, uint16_t uid)
+{
+    uint32_t restId = INVALID_REST_ID;
+
+    if (true == m_isRunning)
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+        Request           req;
+
+        restId        = getRestId();
+        req.id        = REQUEST_ID_POST;
+        req.restId    = restId;
+        req.uid       = uid;
+        req.timestamp = millis();
+        req.url       = url;
+        req.data.data = payload;
+        req.data.size = size;
+
+        (void)serializeJson(filter, req.filter);
+
+        m_requestQueue.push_back(std::move(req));
+    }
+
+    return restId;
+}
+
 bool RestService::getResponse(uint32_t restId, bool& isValidRsp, DynamicJsonDocument& payload)
 {
     bool isSuccessful = false;
@@ -307,6 +344,7 @@ void RestService::abortRequest(uint32_t restId)
         bool                    isRequestFound = false;
         RequestQueue::iterator  reqIterator    = m_requestQueue.begin();
         ResponseQueue::iterator rspIterator    = m_responseQueue.begin();
+        size_t                  index          = 0U;
 
         while ((false == isRequestFound) && (reqIterator != m_requestQueue.end()))
         {
@@ -321,13 +359,22 @@ void RestService::abortRequest(uint32_t restId)
             }
         }
 
-        if (m_activeRestId == restId)
+        /* A request in flight is aborted by the next process() call,
+         * because ending the HTTP client requires to release the mutex.
+         */
+        while ((false == isRequestFound) && (CONFIG_REST_SERVICE_CLIENT_POOL_SIZE > index))
         {
-            m_client.end();
-            m_activeRestId             = INVALID_REST_ID;
-            m_activePreProcessCallback = nullptr;
-            isRequestFound             = true;
-            m_isWaitingForResponse     = false;
+            Connection& connection = m_pool[index];
+
+            if ((CONNECTION_STATE_BUSY == connection.state) &&
+                (restId == connection.restId))
+            {
+                releaseRequest(connection);
+                connection.state = CONNECTION_STATE_ABORT;
+                isRequestFound   = true;
+            }
+
+            ++index;
         }
 
         while ((false == isRequestFound) && (rspIterator != m_responseQueue.end()))
@@ -345,6 +392,20 @@ void RestService::abortRequest(uint32_t restId)
     }
 }
 
+void RestService::getStatistics(std::vector<Statistics>& statistics)
+{
+    if (true == m_isRunning)
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        statistics = m_statistics;
+    }
+    else
+    {
+        statistics.clear();
+    }
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -353,85 +414,473 @@ void RestService::abortRequest(uint32_t restId)
  * Private Methods
  *****************************************************************************/
 
-void RestService::handleAsyncWebResponse(const HttpResponse& httpRsp)
+void RestService::handleAsyncWebResponse(size_t index, const HttpResponse& httpRsp)
 {
     MutexGuard<Mutex> guard(m_mutex);
-    Response          rsp;
-    bool              isError = false;
-
-    rsp.restId                = m_activeRestId;
+    Connection&       connection = m_pool[index];
 
-    if (HttpStatus::STATUS_CODE_OK == httpRsp.getStatusCode())
+    /* Responses of aborted requests are discarded. */
+    if (CONNECTION_STATE_BUSY == connection.state)
     {
-        size_t      payloadSize = 0U;
-        const void* vPayload    = httpRsp.getPayload(payloadSize);
-        const char* payload     = static_cast<const char*>(vPayload);
+        Response    rsp;
+        bool        isError    = false;
+        Statistics& statistics = getUserStatistics(connection.uid);
+        String      connHeader = httpRsp.getHeader("Connection");
+
+        rsp.restId             = connection.restId;
 
-        if ((nullptr == payload) ||
-            (0U == payloadSize))
+        if (HttpStatus::STATUS_CODE_OK == httpRsp.getStatusCode())
+        {
+            size_t      payloadSize = 0U;
+            const void* vPayload    = httpRsp.getPayload(payloadSize);
+            const char* payload     = static_cast<const char*>(vPayload);
+
+            /* The response body was already filtered while received. */
+            if (true == connection.isStreamed)
+            {
+                MutexGuard<Mutex> streamGuard(connection.streamMutex);
+
+                if (false == connection.streamFilter.finish())
+                {
+                    LOG_WARNING("JSON parse error.");
+                    isError = true;
+                }
+                else
+                {
+                    DeserializationError error = deserializeJson(rsp.jsonDocData, connection.streamFilter.getOutput());
+
+                    if (DeserializationError::Ok != error.code())
+                    {
+                        LOG_WARNING("JSON parse error: %s", error.c_str());
+                        isError = true;
+                    }
+                    else
+                    {
+                        rsp.isRsp = true;
+                        m_responseQueue.push_back(std::move(rsp));
+                    }
+                }
+            }
+            else if ((nullptr == payload) ||
+                     (0U == payloadSize))
+            {
+                LOG_ERROR("No payload.");
+                isError = true;
+            }
+
+            /* If a callback is found, it shall be applied. */
+            else if (nullptr != connection.preProcessCallback)
+            {
+                if (true == connection.preProcessCallback(payload, payloadSize, rsp.jsonDocData))
+                {
+                    rsp.isRsp = true;
+                    m_responseQueue.push_back(std::move(rsp));
+                }
+                else
+                {
+                    isError = true;
+                    LOG_ERROR("Error while preprocessing!");
+                }
+            }
+            else
+            {
+                DeserializationError error = deserializeJson(rsp.jsonDocData, payload, payloadSize);
+
+                if (DeserializationError::Ok != error.code())
+                {
+                    LOG_WARNING("JSON parse error: %s", error.c_str());
+                    isError = true;
+                }
+                else
+                {
+                    rsp.isRsp = true;
+                    m_responseQueue.push_back(std::move(rsp));
+                }
+            }
+        }
+        else
         {
-            LOG_ERROR("No payload.");
             isError = true;
+            LOG_ERROR("Http-Status not ok");
         }
 
-        /* If a callback is found, it shall be applied. */
-        else if (nullptr != m_activePreProcessCallback)
+        if (true == isError)
         {
-            if (true == m_activePreProcessCallback(payload, payloadSize, rsp.jsonDocData))
+            rsp.isRsp = false;
+            rsp.jsonDocData.clear();
+            m_responseQueue.push_back(std::move(rsp));
+            ++statistics.failed;
+        }
+
+        statistics.latency.update(millis() - connection.timestamp);
+
+        releaseRequest(connection);
+        connection.timestamp = millis();
+
+        /* If the server closes the connection after the response, it can not be reused. */
+        connHeader.toLowerCase();
+
+        if (0 <= connHeader.indexOf("close"))
+        {
+            connection.state = CONNECTION_STATE_CLOSING;
+        }
+        else
+        {
+            connection.state = CONNECTION_STATE_KEEP_ALIVE;
+        }
+    }
+}
+
+void RestService::handleBodyData(Connection& connection, const uint8_t* data, size_t size)
+{
+    MutexGuard<Mutex> guard(connection.streamMutex);
+
+    /* The data of a released request is discarded.
+     * A parse error is reported by the response handler.
+     */
+    if (true == connection.isStreamed)
+    {
+        (void)connection.streamFilter.parse(reinterpret_cast<const char*>(data), size);
+    }
+}
+
+void RestService::handleFailedWebRequest(size_t index)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+    Connection&       connection = m_pool[index];
+
+    if (CONNECTION_STATE_BUSY == connection.state)
+    {
+        failRequest(connection);
+    }
+
+    if ((CONNECTION_STATE_BUSY == connection.state) ||
+        (CONNECTION_STATE_KEEP_ALIVE == connection.state))
+    {
+        connection.state     = CONNECTION_STATE_CLOSING;
+        connection.timestamp = millis();
+    }
+}
+
+void RestService::handleClosedConnection(size_t index)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+    Connection&       connection = m_pool[index];
+
+    /* Connection closed without any response? */
+    if (CONNECTION_STATE_BUSY == connection.state)
+    {
+        failRequest(connection);
+    }
+
+    /* A connection, which shall be aborted, is handled by the process() call. */
+    if (CONNECTION_STATE_ABORT != connection.state)
+    {
+        connection.state = CONNECTION_STATE_IDLE;
+        connection.host.clear();
+    }
+}
+
+void RestService::failRequest(Connection& connection)
+{
+    Response rsp(0U);
+
+    rsp.restId = connection.restId;
+    rsp.isRsp  = false;
+    m_responseQueue.push_back(std::move(rsp));
+
+    ++getUserStatistics(connection.uid).failed;
+
+    releaseRequest(connection);
+}
+
+void RestService::releaseRequest(Connection& connection)
+{
+    MutexGuard<Mutex> guard(connection.streamMutex);
+
+    connection.restId             = INVALID_REST_ID;
+    connection.preProcessCallback = nullptr;
+    connection.isStreamed         = false;
+
+    /* Release the memory of the filtered response. */
+    connection.streamFilter.reset();
+}
+
+void RestService::abortConnections()
+{
+    size_t index;
+
+    for (index = 0U; index < CONFIG_REST_SERVICE_CLIENT_POOL_SIZE; ++index)
+    {
+        Connection& connection = m_pool[index];
+        bool        isAbort    = false;
+
+        /* Protect against concurrent access. */
+        {
+            MutexGuard<Mutex> guard(m_mutex);
+
+            isAbort = (CONNECTION_STATE_ABORT == connection.state);
+        }
+
+        /* Only the process() call changes a connection, which shall be aborted.
+         * Therefore the HTTP client can be ended without holding the mutex,
+         * which would otherwise deadlock with its callbacks.
+         */
+        if (true == isAbort)
+        {
+            connection.client.end();
+
+            /* Protect against concurrent access. */
             {
-                rsp.isRsp = true;
-                m_responseQueue.push_back(std::move(rsp));
+                MutexGuard<Mutex> guard(m_mutex);
+
+                connection.state = CONNECTION_STATE_IDLE;
+                connection.host.clear();
             }
-            else
+        }
+    }
+}
+
+void RestService::handleTimeouts()
+{
+    uint32_t now = millis();
+    size_t   index;
+
+    for (index = 0U; index < CONFIG_REST_SERVICE_CLIENT_POOL_SIZE; ++index)
+    {
+        Connection& connection = m_pool[index];
+        uint32_t    duration   = now - connection.timestamp;
+
+        switch (connection.state)
+        {
+        case CONNECTION_STATE_BUSY:
+            if (CONFIG_REST_SERVICE_REQUEST_TIMEOUT <= duration)
             {
-                isError = true;
-                LOG_ERROR("Error while preprocessing!");
+                LOG_WARNING("Request to %s timed out.", connection.host.c_str());
+
+                ++getUserStatistics(connection.uid).timeouts;
+                failRequest(connection);
+                connection.state = CONNECTION_STATE_ABORT;
             }
+            break;
+
+        case CONNECTION_STATE_KEEP_ALIVE:
+            if (CONFIG_REST_SERVICE_KEEP_ALIVE_TIMEOUT <= duration)
+            {
+                connection.state = CONNECTION_STATE_ABORT;
+            }
+            break;
+
+        case CONNECTION_STATE_CLOSING:
+            if (CONFIG_REST_SERVICE_REQUEST_TIMEOUT <= duration)
+            {
+                connection.state = CONNECTION_STATE_ABORT;
+            }
+            break;
+
+        default:
+            break;
         }
-        else
+    }
+}
+
+void RestService::dispatchRequests()
+{
+    bool isBlocked = false;
+
+    /* The requests are dispatched in order. If the first one can not be sent
+     * yet, all others wait, so no request starves.
+     */
+    while ((false == isBlocked) && (false == m_requestQueue.empty()))
+    {
+        uint32_t    now         = millis();
+        String      host        = getHost(m_requestQueue.front().url);
+        Connection* connection  = nullptr;
+        Connection* idle        = nullptr;
+        Connection* oldest      = nullptr;
+        size_t      connections = 0U;
+        size_t      index;
+
+        for (index = 0U; index < CONFIG_REST_SERVICE_CLIENT_POOL_SIZE; ++index)
         {
-            DeserializationError error = deserializeJson(rsp.jsonDocData, payload, payloadSize);
+            Connection& candidate = m_pool[index];
 
-            if (DeserializationError::Ok != error.code())
+            if (CONNECTION_STATE_IDLE == candidate.state)
             {
-                LOG_WARNING("JSON parse error: %s", error.c_str());
-                isError = true;
+                if (nullptr == idle)
+                {
+                    idle = &candidate;
+                }
             }
             else
             {
-                rsp.isRsp = true;
-                m_responseQueue.push_back(std::move(rsp));
+                ++connections;
+
+                if (CONNECTION_STATE_KEEP_ALIVE == candidate.state)
+                {
+                    /* Prefer a kept alive connection to the same host. */
+                    if (host == candidate.host)
+                    {
+                        if (nullptr == connection)
+                        {
+                            connection = &candidate;
+                        }
+                    }
+                    else if ((nullptr == oldest) ||
+                             ((now - oldest->timestamp) < (now - candidate.timestamp)))
+                    {
+                        oldest = &candidate;
+                    }
+                    else
+                    {
+                        ;
+                    }
+                }
+            }
+        }
+
+        if ((nullptr == connection) &&
+            (nullptr != idle) &&
+            (MAX_CONNECTIONS > connections))
+        {
+            connection = idle;
+        }
+
+        if (nullptr == connection)
+        {
+            /* Close the oldest idle connection to another host, to make room for the request. */
+            if (nullptr != oldest)
+            {
+                oldest->state = CONNECTION_STATE_ABORT;
             }
+
+            isBlocked = true;
+        }
+        else
+        {
+            Request     req        = std::move(m_requestQueue.front());
+            Statistics& statistics = getUserStatistics(req.uid);
+
+            m_requestQueue.erase(m_requestQueue.begin());
+
+            ++statistics.requests;
+            statistics.queueWait.update(now - req.timestamp);
+
+            if (false == sendRequest(*connection, req))
+            {
+                failRequest(*connection);
+                connection->state = CONNECTION_STATE_ABORT;
+            }
+        }
+    }
+}
+
+bool RestService::sendRequest(Connection& connection, const Request& req)
+{
+    bool isSuccessful  = false;
+    bool isFilterValid = true;
+
+    connection.state              = CONNECTION_STATE_BUSY;
+    connection.host               = getHost(req.url);
+    connection.restId             = req.restId;
+    connection.uid                = req.uid;
+    connection.timestamp          = millis();
+    connection.preProcessCallback = req.preProcessCallback;
+
+    /* The server may reject it, which is handled by the client. */
+    connection.client.setKeepAlive(true);
+
+    if (true == req.filter.isEmpty())
+    {
+        connection.client.regOnBodyData(nullptr);
+    }
+    else
+    {
+        AsyncHttpClient::OnBodyData bodyDataCallback = [this, &connection](const uint8_t* data, size_t size) {
+            handleBodyData(connection, data, size);
+        };
+
+        /* Protect against concurrent access. */
+        {
+            MutexGuard<Mutex> guard(connection.streamMutex);
+
+            connection.isStreamed = true;
+            isFilterValid         = connection.streamFilter.setFilter(req.filter);
         }
+
+        /* Not registered with the stream mutex held, because the HTTP client
+         * takes its receive mutex, which it holds while calling the callback.
+         */
+        connection.client.regOnBodyData(bodyDataCallback);
+    }
+
+    if (false == isFilterValid)
+    {
+        LOG_ERROR("Invalid response filter.");
+    }
+    else if (false == connection.client.begin(req.url))
+    {
+        LOG_ERROR("URL could not be parsed");
     }
     else
     {
-        isError = true;
-        LOG_ERROR("Http-Status not ok");
+        switch (req.id)
+        {
+        case REQUEST_ID_GET:
+            isSuccessful = connection.client.GET();
+            break;
+
+        case REQUEST_ID_POST:
+            isSuccessful = connection.client.POST(req.data.data, req.data.size);
+            break;
+
+        default:
+            break;
+        };
     }
 
-    if (true == isError)
+    return isSuccessful;
+}
+
+String RestService::getHost(const String& url)
+{
+    String host;
+    int    index = url.indexOf("://");
+
+    if (0 <= index)
     {
-        rsp.isRsp = false;
-        rsp.jsonDocData.clear();
-        m_responseQueue.push_back(std::move(rsp));
+        /* Overstep '://' too. */
+        index = url.indexOf('/', index + 3);
+
+        if (0 > index)
+        {
+            host = url;
+        }
+        else
+        {
+            host = url.substring(0, index);
+        }
     }
 
-    m_activeRestId             = INVALID_REST_ID;
-    m_activePreProcessCallback = nullptr;
+    return host;
 }
 
-void RestService::handleFailedWebRequest()
+RestService::Statistics& RestService::getUserStatistics(uint16_t uid)
 {
-    MutexGuard<Mutex> guard(m_mutex);
-    Response          rsp(0U);
+    StatisticsList::iterator it = m_statistics.begin();
 
-    rsp.restId = m_activeRestId;
-    rsp.isRsp  = false;
-    m_responseQueue.push_back(std::move(rsp));
+    while ((it != m_statistics.end()) && (uid != it->uid))
+    {
+        ++it;
+    }
+
+    if (it == m_statistics.end())
+    {
+        m_statistics.push_back(Statistics(uid));
+        it = m_statistics.end() - 1;
+    }
 
-    m_activeRestId             = INVALID_REST_ID;
-    m_activePreProcessCallback = nullptr;
+    return *it;
 }
 
 uint32_t RestService::getRestId()
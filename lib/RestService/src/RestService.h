@@ -37,6 +37,25 @@
 #ifndef REST_SERVICE_H
 #define REST_SERVICE_H
 
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_REST_SERVICE_CLIENT_POOL_SIZE
+/** Number of HTTP clients, which are used to process the requests concurrently. */
+#define CONFIG_REST_SERVICE_CLIENT_POOL_SIZE 2U
+#endif /* CONFIG_REST_SERVICE_CLIENT_POOL_SIZE */
+
+#ifndef CONFIG_REST_SERVICE_REQUEST_TIMEOUT
+/** Max. duration in ms of a request, after it was sent. */
+#define CONFIG_REST_SERVICE_REQUEST_TIMEOUT 10000U
+#endif /* CONFIG_REST_SERVICE_REQUEST_TIMEOUT */
+
+#ifndef CONFIG_REST_SERVICE_KEEP_ALIVE_TIMEOUT
+/** Duration in ms, how long an idle connection is kept alive for the next request to the same host. */
+#define CONFIG_REST_SERVICE_KEEP_ALIVE_TIMEOUT 5000U
+#endif /* CONFIG_REST_SERVICE_KEEP_ALIVE_TIMEOUT */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -49,10 +68,8 @@
 #include <Logging.h>
 #include <vector>
 #include <utility>
-
-/******************************************************************************
- * Compiler Switches
- *****************************************************************************/
+#include <StatisticValue.hpp>
+#include <JsonStreamFilter.h>
 
 /******************************************************************************
  * Macros
@@ -64,6 +81,11 @@
 
 /**
  * The REST service handles outgoing REST-API calls and their responses.
+ *
+ * The requests are processed by a small pool of HTTP clients. A client keeps
+ * the connection to its host alive after a response, so the next request to
+ * the same host can reuse it. The number of requests in flight is limited by
+ * the pool size and the max. number of connections of the HTTP clients.
  */
 class RestService : public IService
 {
@@ -74,6 +96,39 @@ public:
      */
     typedef std::function<bool(const char*, size_t, DynamicJsonDocument&)> PreProcessCallback;
 
+    /**
+     * Statistic value type, used for the durations in ms.
+     */
+    typedef StatisticValue<uint32_t, 0U, 8U> Duration;
+
+    /**
+     * Request statistics of a single user, identified by its UID.
+     */
+    struct Statistics
+    {
+        uint16_t uid;       /**< UID of the user, e.g. the plugin UID. */
+        uint32_t requests;  /**< Number of sent requests. */
+        uint32_t failed;    /**< Number of failed requests, including the timeouts. */
+        uint32_t timeouts;  /**< Number of timed out requests. */
+        Duration queueWait; /**< Duration in ms, how long the requests waited in the queue. */
+        Duration latency;   /**< Duration in ms, from sending a request until its response. */
+
+        /**
+         * Constructs the statistics of a user.
+         *
+         * @param[in] userUid   UID of the user
+         */
+        explicit Statistics(uint16_t userUid) :
+            uid(userUid),
+            requests(0U),
+            failed(0U),
+            timeouts(0U),
+            queueWait(),
+            latency()
+        {
+        }
+    };
+
     /**
      * Get the REST service instance.
      *
@@ -108,10 +163,11 @@ public:
      *
      * @param[in] url                 URL
      * @param[in] preProcessCallback  PreProcessCallback which will be called by the RestService to filter the received date.
+     * @param[in] uid                 UID of the user, e.g. the plugin UID. Used for the statistics.
      *
      * @return If request is successful sent, it will return a valid restId otherwise it will return INVALID_REST_ID.
      */
-    uint32_t get(const String& url, PreProcessCallback preProcessCallback);
+    uint32_t get(const String& url, PreProcessCallback preProcessCallback, uint16_t uid = UNKNOWN_UID);
 
     /**
      * Send POST request to host.
@@ -120,10 +176,37 @@ public:
      * @param[in] preProcessCallback  PreProcessCallback which will be called by the RestService to filter the received date.
      * @param[in] payload             Payload, which must be kept alive until response is available!
      * @param[in] size                Payload size in byte
+     * @param[in] uid                 UID of the user, e.g. the plugin UID. Used for the statistics.
      *
      * @return If request is successful sent, it will return a valid restId otherwise it will return INVALID_REST_ID.
      */
-    uint32_t post(const String& url, PreProcessCallback preProcessCallback, const uint8_t* payload = nullptr, size_t size = 0U);
+    uint32_t post(const String& url, PreProcessCallback preProcessCallback, const uint8_t* payload = nullptr, size_t size = 0U, uint16_t uid = UNKNOWN_UID);
+
+    /**
+     * Send GET request to host. The response body is filtered while it is received,
+     * so only the declared values are kept in memory.
+     *
+     * @param[in] url     URL
+     * @param[in] filter  Filter, which declares the values to keep. See ArduinoJson filter.
+     * @param[in] uid     UID of the user, e.g. the plugin UID. Used for the statistics.
+     *
+     * @return If request is successful sent, it will return a valid restId otherwise it will return INVALID_REST_ID.
+     */
+    uint32_t get(const String& url, const JsonDocument& filter, uint16_t uid = UNKNOWN_UID);
+
+    /**
+     * Send POST request to host. The response body is filtered while it is received,
+     * so only the declared values are kept in memory.
+     *
+     * @param[in] url     URL
+     * @param[in] filter  Filter, which declares the values to keep. See ArduinoJson filter.
+     * @param[in] payload Payload, which must be kept alive until response is available!
+     * @param[in] size    Payload size in byte
+     * @param[in] uid     UID of the user, e.g. the plugin UID. Used for the statistics.
+     *
+     * @return If request is successful sent, it will return a valid restId otherwise it will return INVALID_REST_ID.
+     */
+    uint32_t post(const String& url, const JsonDocument& filter, const uint8_t* payload = nullptr, size_t size = 0U, uint16_t uid = UNKNOWN_UID);
 
     /**
      * Send POST request to host.
@@ -131,10 +214,11 @@ public:
      * @param[in] url                 URL
      * @param[in] payload             Payload, which must be kept alive until response is available!
      * @param[in] preProcessCallback  PreProcessCallback which will be called by the RestService to filter the received date.
+     * @param[in] uid                 UID of the user, e.g. the plugin UID. Used for the statistics.
      *
      * @return If request is successful sent, it will return a valid restId otherwise it will return INVALID_REST_ID.
      */
-    uint32_t post(const String& url, const String& payload, PreProcessCallback preProcessCallback);
+    uint32_t post(const String& url, const String& payload, PreProcessCallback preProcessCallback, uint16_t uid = UNKNOWN_UID);
 
     /**
      * Get response to a previously started request.
@@ -154,11 +238,23 @@ public:
      */
     void abortRequest(uint32_t restId);
 
+    /**
+     * Get the request statistics of all users.
+     *
+     * @param[out] statistics  Request statistics, one element per user.
+     */
+    void getStatistics(std::vector<Statistics>& statistics);
+
     /**
      *  Used to indicate that HTTP request could not be started.
      */
     static constexpr uint32_t INVALID_REST_ID = 0U;
 
+    /**
+     * Used for requests of an unknown user.
+     */
+    static constexpr uint16_t UNKNOWN_UID = UINT16_MAX;
+
 private:
 
     /**
@@ -209,8 +305,11 @@ private:
     {
         RequestId          id;                 /**< The request id identifies the kind of request. */
         uint32_t           restId;             /**< Used to identify plugin in RestService. */
+        uint16_t           uid;                /**< UID of the user, used for the statistics. */
+        uint32_t           timestamp;          /**< Timestamp in ms, when the request was queued. */
         PreProcessCallback preProcessCallback; /**< Individual callback called when response arrives. */
         String             url;                /**< URL to be called. */
+        String             filter;             /**< Response filter in JSON format. If empty, the response is not filtered while received. */
 
         /**
          * Data parameters, only valid for REQUEST_ID_POST.
@@ -227,8 +326,11 @@ private:
         Request() :
             id(),
             restId(INVALID_REST_ID),
+            uid(UNKNOWN_UID),
+            timestamp(0U),
             preProcessCallback(nullptr),
             url(),
+            filter(),
             data{ nullptr, 0U }
         {
         }
@@ -258,8 +360,11 @@ private:
             :
             id(other.id),
             restId(other.restId),
+            uid(other.uid),
+            timestamp(other.timestamp),
             preProcessCallback(other.preProcessCallback),
             url(std::move(other.url)),
+            filter(std::move(other.filter)),
             data{ other.data.data, other.data.size }
         {
             other.data.data = nullptr;
@@ -279,8 +384,11 @@ private:
             {
                 id                 = other.id;
                 restId             = other.restId;
+                uid                = other.uid;
+                timestamp          = other.timestamp;
                 preProcessCallback = std::move(other.preProcessCallback);
                 url                = std::move(other.url);
+                filter             = std::move(other.filter);
                 data               = other.data;
 
                 other.data.data    = nullptr;
@@ -290,35 +398,85 @@ private:
         }
     };
 
+    /**
+     * The state of a pooled HTTP client connection.
+     */
+    enum ConnectionState
+    {
+        CONNECTION_STATE_IDLE = 0,   /**< No connection, ready for a request to any host. */
+        CONNECTION_STATE_BUSY,       /**< Request in flight. */
+        CONNECTION_STATE_KEEP_ALIVE, /**< Connection kept alive, ready for a request to the same host. */
+        CONNECTION_STATE_CLOSING,    /**< Waiting until the connection is closed. */
+        CONNECTION_STATE_ABORT       /**< Connection shall be aborted by the process() call. */
+    };
+
+    /**
+     * A pooled HTTP client with its connection state and the request in flight.
+     */
+    struct Connection
+    {
+        AsyncHttpClient    client;             /**< Asynchronous HTTP client. */
+        ConnectionState    state;              /**< Connection state. */
+        String             host;               /**< Protocol, host and port of the connection. */
+        uint32_t           restId;             /**< The restId of the request in flight. */
+        uint16_t           uid;                /**< UID of the user of the request in flight. */
+        uint32_t           timestamp;          /**< Timestamp in ms of the last state change. */
+        PreProcessCallback preProcessCallback; /**< Callback of the request in flight. */
+        bool               isStreamed;         /**< Is the response body filtered while received? Protected by the stream mutex. */
+        JsonStreamFilter   streamFilter;       /**< Filters the response body of the request in flight. Protected by the stream mutex. */
+        Mutex              streamMutex;        /**< Protects the stream filter, which is fed in the TCP client context. */
+
+        /**
+         * Constructs an idle connection.
+         */
+        Connection() :
+            client(),
+            state(CONNECTION_STATE_IDLE),
+            host(),
+            restId(INVALID_REST_ID),
+            uid(UNKNOWN_UID),
+            timestamp(0U),
+            preProcessCallback(nullptr),
+            isStreamed(false),
+            streamFilter(),
+            streamMutex()
+        {
+        }
+    };
+
     /** Request Queue */
     typedef std::vector<Request> RequestQueue;
 
     /** Response Queue */
     typedef std::vector<Response> ResponseQueue;
 
-    AsyncHttpClient               m_client;                   /**< Asynchronous HTTP client. */
-    RequestQueue                  m_requestQueue;             /**< Stores requests for sequential execution. */
-    ResponseQueue                 m_responseQueue;            /**< Saves responses to outgoing requests. */
-    bool                          m_isRunning;                /**< Signals the status of the service. True means it is running, false means it is stopped. */
-    uint32_t                      m_restIdCounter;            /**< Used to generate restIds. */
-    bool                          m_isWaitingForResponse;     /**< Is RestService still waiiting for a response to a request? */
-    uint32_t                      m_activeRestId;             /**< Saves the  restId of a request until the callback triggered by the corresponding response is finished. */
-    PreProcessCallback            m_activePreProcessCallback; /**< Saves the callback sent by a request until it is called when the response arrives. */
-    Mutex                         m_mutex;                    /**< Mutex to protect against concurrent access. */
+    /** Request statistics of all users */
+    typedef std::vector<Statistics> StatisticsList;
+
+    /**
+     * Max. number of connections of the pooled HTTP clients at the same time.
+     */
+    static const size_t MAX_CONNECTIONS = (CONFIG_REST_SERVICE_CLIENT_POOL_SIZE < CONFIG_ASYNC_HTTP_CLIENT_MAX_CONNECTIONS) ? CONFIG_REST_SERVICE_CLIENT_POOL_SIZE : CONFIG_ASYNC_HTTP_CLIENT_MAX_CONNECTIONS;
+
+    Connection     m_pool[CONFIG_REST_SERVICE_CLIENT_POOL_SIZE]; /**< Pool of HTTP clients. */
+    RequestQueue   m_requestQueue;                               /**< Stores requests until a HTTP client is available. */
+    ResponseQueue  m_responseQueue;                              /**< Saves responses to outgoing requests. */
+    StatisticsList m_statistics;                                 /**< Request statistics per user. */
+    bool           m_isRunning;                                  /**< Signals the status of the service. True means it is running, false means it is stopped. */
+    uint32_t       m_restIdCounter;                              /**< Used to generate restIds. */
+    Mutex          m_mutex;                                      /**< Mutex to protect against concurrent access. */
 
     /**
      * Constructs the service instance.
      */
     RestService() :
         IService(),
-        m_client(),
+        m_pool(),
         m_requestQueue(),
         m_responseQueue(),
+        m_statistics(),
         m_isRunning(false),
         m_restIdCounter(INVALID_REST_ID),
-        m_isWaitingForResponse(false),
-        m_activeRestId(INVALID_REST_ID),
-        m_activePreProcessCallback(),
         m_mutex()
     {
     }
@@ -337,17 +495,105 @@ private:
 
     /**
      * Handles asynchronous web responses from the server. Filtering is delegated to plugin-callbacks.
-     * This will be called in LwIP context! Don't modify any member here directly!
+     * This will be called in the HTTP client context! Don't use the HTTP client here!
      *
+     * @param[in] index   Index of the connection in the pool
      * @param[in] rsp     Web Response
      */
-    void handleAsyncWebResponse(const HttpResponse& rsp);
+    void handleAsyncWebResponse(size_t index, const HttpResponse& rsp);
+
+    /**
+     * Handles received response body data of a request with response filter.
+     * This will be called in the TCP client context with the receive mutex of
+     * the HTTP client held! Don't use the HTTP client here! Only the stream
+     * mutex of the connection is taken, because the service mutex is held
+     * while the HTTP client is used.
+     *
+     * @param[in] connection  Connection, which received the data
+     * @param[in] data        Body data
+     * @param[in] size        Body data size in byte
+     */
+    void handleBodyData(Connection& connection, const uint8_t* data, size_t size);
 
     /**
      * Handles failed web requests.
-     * This will be called in LwIP context! Don't modify any member here directly!
+     * This will be called in the HTTP client context! Don't use the HTTP client here!
+     *
+     * @param[in] index   Index of the connection in the pool
+     */
+    void handleFailedWebRequest(size_t index);
+
+    /**
+     * Handles a closed connection.
+     * This will be called in the HTTP client context! Don't use the HTTP client here!
+     *
+     * @param[in] index   Index of the connection in the pool
+     */
+    void handleClosedConnection(size_t index);
+
+    /**
+     * Finish the request in flight of a connection with a failed response.
+     * The mutex must be taken by the caller.
+     *
+     * @param[in] connection  Connection with a request in flight
+     */
+    void failRequest(Connection& connection);
+
+    /**
+     * Release the request in flight of a connection.
+     * The mutex must be taken by the caller.
+     *
+     * @param[in] connection  Connection with a request in flight
+     */
+    void releaseRequest(Connection& connection);
+
+    /**
+     * Abort connections, which are marked for abort. The HTTP client is ended
+     * without holding the mutex, because its callbacks take the mutex.
+     */
+    void abortConnections();
+
+    /**
+     * Check the request in flight and the kept alive connections for timeouts.
+     * The mutex must be taken by the caller.
+     */
+    void handleTimeouts();
+
+    /**
+     * Dispatch the queued requests to the pooled HTTP clients.
+     * The mutex must be taken by the caller.
+     */
+    void dispatchRequests();
+
+    /**
+     * Send a request via the given connection.
+     * The mutex must be taken by the caller.
+     *
+     * @param[in] connection  Connection, which to use
+     * @param[in] req         Request, which to send
+     *
+     * @return If successful sent, it will return true otherwise false.
+     */
+    bool sendRequest(Connection& connection, const Request& req);
+
+    /**
+     * Get protocol, host and port of the URL, e.g. "https://example.com:8080".
+     *
+     * @param[in] url URL
+     *
+     * @return Protocol, host and port
+     */
+    static String getHost(const String& url);
+
+    /**
+     * Get the statistics of a user. If not available, they will be created.
+     * The mutex must be taken by the caller.
+     *
+     * @param[in] uid UID of the user
+     *
+     * @return Statistics of the user
      */
-    void handleFailedWebRequest();
+    Statistics& getUserStatistics(uint16_t uid);
 
     /**
      * Generates a valid restId.
@@ -140,19 +140,6 @@ bool SensorPlugin::setTopic(const String& topic, const JsonObjectConst& value)
     return isSuccessful;
 }
 
-bool SensorPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive>  guard(m_mutex);
-    bool                        hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void SensorPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -234,7 +221,7 @@ bool SensorPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         m_channelIdx    = jsonChannelIndex.as<uint8_t>();
         m_sensorChannel = getChannel(m_sensorIdx, m_channelIdx);
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
 
         status = true;
     }
@@ -80,8 +80,7 @@ public:
         m_mutex(),
         m_sensorIdx(0U),
         m_channelIdx(0U),
-        m_sensorChannel(nullptr),
-        m_hasTopicChanged(false)
+        m_sensorChannel(nullptr)
     {
         (void)m_mutex.create();
     }
@@ -213,17 +212,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     * 
-     * @param[in] topic The topic which to check.
-     * 
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-    
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -278,7 +266,6 @@ private:
     uint8_t                 m_channelIdx;       /**< Index of selected channel. */
     ISensorChannel*         m_sensorChannel;    /**< Values of this channel will be shown. */
     SimpleTimer             m_updateTimer;      /**< Sensor value update timer. */
-    bool                    m_hasTopicChanged;  /**< Has the topic content changed? */
 
     /**
      * Get configuration in JSON.
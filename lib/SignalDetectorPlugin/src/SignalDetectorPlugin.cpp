@@ -194,19 +194,6 @@ bool SignalDetectorPlugin::setTopic(const String& topic, const JsonObjectConst&
     return isSuccessful;
 }
 
-bool SignalDetectorPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void SignalDetectorPlugin::setSlot(const ISlotPlugin* slotInterf)
 {
     m_slotInterf = slotInterf;
@@ -439,7 +426,7 @@ bool SignalDetectorPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         m_view.setFormatText(jsonText.as<String>());
         m_pushUrl         = jsonPushUrl.as<const char*>();
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
     }
 
     return status;
@@ -484,7 +471,7 @@ bool SignalDetectorPlugin::startHttpRequest()
 
         if (false == isGet)
         {
-            m_dynamicRestId = RestService::getInstance().post(url, preProcessCallback);
+            m_dynamicRestId = RestService::getInstance().post(url, preProcessCallback, nullptr, 0U, getUID());
 
             if (RestService::INVALID_REST_ID == m_dynamicRestId)
             {
@@ -497,7 +484,7 @@ bool SignalDetectorPlugin::startHttpRequest()
         }
         else
         {
-            m_dynamicRestId = RestService::getInstance().get(url, preProcessCallback);
+            m_dynamicRestId = RestService::getInstance().get(url, preProcessCallback, getUID());
 
             if (RestService::INVALID_REST_ID == m_dynamicRestId)
             {
@@ -83,7 +83,6 @@ public:
         m_pushUrl(),
         m_timer(),
         m_slotInterf(nullptr),
-        m_hasTopicChanged(false),
         m_dynamicRestId(RestService::INVALID_REST_ID),
         m_isAllowedToSend(true)
     {
@@ -224,17 +223,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Set the slot interface, which the plugin can used to request information
      * from the slot, it is plugged in.
@@ -313,7 +301,6 @@ private:
     String                      m_pushUrl;         /**< Push URL which will be triggered if signal is detected. */
     SimpleTimer                 m_timer;           /**< Timer used for slot duration timeout detection in case deactivate() is not called. */
     const ISlotPlugin*          m_slotInterf;      /**< Slot interface */
-    bool                        m_hasTopicChanged; /**< Has the topic content changed? */
     uint32_t                    m_dynamicRestId;   /**< Used to identify plugin when interacting with RestService. Id changes with every request. */
     bool                        m_isAllowedToSend; /**< Is allowed to send REST-Api request? */
 
@@ -148,19 +148,6 @@ bool SoundReactivePlugin::setTopic(const String& topic, const JsonObjectConst& v
     return isSuccessful;
 }
 
-bool SoundReactivePlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive>  guard(m_mutex);
-    bool                        hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void SoundReactivePlugin::start(uint16_t width, uint16_t height)
 {
     SpectrumAnalyzer*           spectrumAnalyzer = AudioService::getInstance().getSpectrumAnalyzer();
@@ -309,7 +296,7 @@ bool SoundReactivePlugin::setConfiguration(const JsonObjectConst& jsonCfg)
 
             m_numOfFreqBands = numOfBands;
 
-            m_hasTopicChanged = true;
+            notifyTopicChanged(TOPIC_CONFIG);
 
             status = true;
         }
@@ -83,8 +83,7 @@ public:
         m_maxHeight(0U),
         m_freqBins(nullptr),
         m_corrFactors(),
-        m_peak(INMP441_MAX_SPL),
-        m_hasTopicChanged(false)
+        m_peak(INMP441_MAX_SPL)
     {
         uint8_t bandIdx = 0U;
 
@@ -204,17 +203,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     * 
-     * @param[in] topic The topic which to check.
-     * 
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -354,7 +342,6 @@ private:
     float*                  m_freqBins;                     /**< List of frequency bins, calculated from the spectrum analyzer results. On the heap to avoid stack overflow. */
     float                   m_corrFactors[MAX_FREQ_BANDS];  /**< Correction factors per frequency band. The factors are calculated if the signal average is lower than the microphone noise floor. */
     float                   m_peak;                         /**< Determined signal peak over all frequency bands in dB SPL, used for AGC. */
-    bool                    m_hasTopicChanged;              /**< Has the topic content changed? */
 
     /**
      * Get configuration in JSON.
@@ -152,19 +152,6 @@ bool SunrisePlugin::setTopic(const String& topic, const JsonObjectConst& value)
     return isSuccessful;
 }
 
-bool SunrisePlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void SunrisePlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -326,7 +313,7 @@ bool SunrisePlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         /* Force update on display */
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
 
         status            = true;
     }
@@ -336,36 +323,8 @@ bool SunrisePlugin::setConfiguration(const JsonObjectConst& jsonCfg)
 
 bool SunrisePlugin::startHttpRequest()
 {
-    bool                            status = false;
-    RestService::PreProcessCallback preProcessCallback =
-        [this](const char* payload, size_t size, DynamicJsonDocument& doc) {
-            return this->preProcessAsyncWebResponse(payload, size, doc);
-        };
-
-    if ((false == m_latitude.isEmpty()) &&
-        (false == m_longitude.isEmpty()))
-    {
-        String url      = String(BASE_URI) + "/json?lat=" + m_latitude + "&lng=" + m_longitude + "&formatted=0";
-
-        m_dynamicRestId = RestService::getInstance().get(url, preProcessCallback);
-
-        if (RestService::INVALID_REST_ID == m_dynamicRestId)
-        {
-            LOG_WARNING("GET %s failed.", url.c_str());
-        }
-        else
-        {
-            status = true;
-        }
-    }
-
-    return status;
-}
-
-bool SunrisePlugin::preProcessAsyncWebResponse(const char* payload, size_t payloadSize, DynamicJsonDocument& jsonDoc)
-{
-    bool                            isSuccessful = false;
-    const size_t                    FILTER_SIZE  = 128U;
+    bool                            status      = false;
+    const size_t                    FILTER_SIZE = 128U;
     StaticJsonDocument<FILTER_SIZE> jsonFilterDoc;
 
     /* Example:
@@ -394,21 +353,28 @@ bool SunrisePlugin::preProcessAsyncWebResponse(const char* payload, size_t paylo
     {
         LOG_ERROR("Less memory for filter available.");
     }
-    else
+    else if ((false == m_latitude.isEmpty()) &&
+             (false == m_longitude.isEmpty()))
     {
-        DeserializationError error = deserializeJson(jsonDoc, payload, payloadSize, DeserializationOption::Filter(jsonFilterDoc));
+        String url      = String(BASE_URI) + "/json?lat=" + m_latitude + "&lng=" + m_longitude + "&formatted=0";
 
-        if (DeserializationError::Ok != error.code())
+        m_dynamicRestId = RestService::getInstance().get(url, jsonFilterDoc, getUID());
+
+        if (RestService::INVALID_REST_ID == m_dynamicRestId)
         {
-            LOG_ERROR("Invalid JSON message received: %s", error.c_str());
+            LOG_WARNING("GET %s failed.", url.c_str());
         }
         else
         {
-            isSuccessful = true;
+            status = true;
         }
     }
+    else
+    {
+        ;
+    }
 
-    return isSuccessful;
+    return status;
 }
 
 void SunrisePlugin::handleWebResponse(const DynamicJsonDocument& jsonDoc)
@@ -39,6 +39,8 @@
 #include <Logging.h>
 #include <FileSystem.h>
 #include <JsonFile.h>
+#include <algorithm>
+#include <functional>
 
 /******************************************************************************
  * Compiler Switches
@@ -69,23 +71,39 @@ const char* TopicHandlerService::DEFAULT_ACCESS = "rw";
 
 bool TopicHandlerService::start()
 {
-    startAllHandlers();
+    bool isSuccessful = true;
 
-    m_onChangeTimer.start(ON_CHANGE_PERIOD);
-    m_isStarted = true;
+    if (false == m_mutex.create())
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        startAllHandlers();
+
+        m_onChangeTimer.start(ON_CHANGE_PERIOD);
+        m_isStarted = true;
 
-    LOG_INFO("Topic handler service started.");
+        LOG_INFO("Topic handler service started.");
+    }
 
-    return true;
+    return isSuccessful;
 }
 
 void TopicHandlerService::stop()
 {
-    m_isStarted = false;
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        m_isStarted = false;
+    }
+
     m_onChangeTimer.stop();
 
     stopAllHandlers();
 
+    m_mutex.destroy();
+
     LOG_INFO("Topic handler service stopped.");
 }
 
@@ -202,16 +220,12 @@ void TopicHandlerService::registerTopics(const String& deviceId, const String& e
                         registerTopic(deviceId, entityId, topicName, extraFileName.c_str(), getTopicFunc, nullptr, setTopicFunc, uploadReqFunc);
                     }
 
-                    addToTopicMetaDataList(deviceId, entityId, plugin, topicName, nullptr);
-
                     /* A plugin can be registered by UID and by alias for the same topic.
-                     * This raises the problem that the plugin is added twice to the topic meta data list.
-                     * During processing on change, the plugin will be asked twice whether there is any change.
-                     * But the first call will reset the change flag, so the second call will not recognize any change.
-                     * To avoid this, the plugin will be added only once to the plugin list and just asked once,
-                     * but the topic handlers will be notified for every registration.
+                     * The plugin topic is added only once to the plugin list, but with
+                     * every registration. If the plugin notifies about a topic change,
+                     * the topic handlers will be notified for every registration.
                      */
-                    addToPluginList(plugin, topicName);
+                    addToPluginList(deviceId, entityId, plugin, topicName);
                 }
             }
         }
@@ -262,8 +276,7 @@ void TopicHandlerService::unregisterTopics(const String& deviceId, const String&
                 {
                     unregisterTopic(deviceId, entityId, topicName, purge);
 
-                    removeFromTopicMetaDataList(deviceId, entityId, topicName);
-                    removeFromPluginList(plugin, topicName);
+                    removeFromPluginList(deviceId, entityId, plugin, topicName);
                 }
             }
         }
@@ -316,7 +329,7 @@ void TopicHandlerService::registerTopic(const String& deviceId, const String& en
             if ((true == isReadAccess) &&
                 (nullptr != hasChangedFunc))
             {
-                addToTopicMetaDataList(deviceId, entityId, nullptr, topic, hasChangedFunc);
+                addToTopicMetaDataList(deviceId, entityId, topic, hasChangedFunc);
             }
         }
     }
@@ -374,6 +387,29 @@ void TopicHandlerService::unregisterTopic(const String& deviceId, const String&
     }
 }
 
+void TopicHandlerService::onTopicChanged(IPluginMaintenance* plugin, const String& topic)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+
+    if ((true == m_isStarted) &&
+        (nullptr != plugin))
+    {
+        PluginMetaDataList::iterator pluginMetaDataIt = findInPluginList(plugin, topic, getTopicHash(topic));
+
+        if (m_pluginMetaDataList.end() != pluginMetaDataIt)
+        {
+            PluginMetaData* pluginMetaData = *pluginMetaDataIt;
+
+            /* Multiple changes until the next on change processing, will notify only once. */
+            if (false == pluginMetaData->isChanged)
+            {
+                pluginMetaData->isChanged = true;
+                m_changedList.push_back(pluginMetaData);
+            }
+        }
+    }
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -428,7 +464,7 @@ void TopicHandlerService::strToAccess(IPluginMaintenance* plugin, const String&
     }
 }
 
-void TopicHandlerService::addToTopicMetaDataList(const String& deviceId, const String& entityId, IPluginMaintenance* plugin, const String& topic, HasChangedFunc hasChangedFunc)
+void TopicHandlerService::addToTopicMetaDataList(const String& deviceId, const String& entityId, const String& topic, HasChangedFunc hasChangedFunc)
 {
     if ((false == deviceId.isEmpty()) &&
         (false == topic.isEmpty()))
@@ -439,7 +475,6 @@ void TopicHandlerService::addToTopicMetaDataList(const String& deviceId, const S
         {
             topicMetaData->deviceId       = deviceId;
             topicMetaData->entityId       = entityId;
-            topicMetaData->plugin         = plugin;
             topicMetaData->topic          = topic;
             topicMetaData->hasChangedFunc = hasChangedFunc;
 
@@ -473,88 +508,196 @@ void TopicHandlerService::removeFromTopicMetaDataList(const String& deviceId, co
     }
 }
 
-void TopicHandlerService::addToPluginList(IPluginMaintenance* plugin, const String& topic)
+void TopicHandlerService::addToPluginList(const String& deviceId, const String& entityId, IPluginMaintenance* plugin, const String& topic)
 {
-    if ((nullptr != plugin) &&
+    if ((false == deviceId.isEmpty()) &&
+        (nullptr != plugin) &&
         (false == topic.isEmpty()))
     {
-        PluginMetaDataList::iterator pluginMetaDataIt = m_pluginMetaDataList.begin();
-        bool                         found            = false;
+        uint32_t                     hash             = getTopicHash(topic);
+        PluginMetaDataList::iterator pluginMetaDataIt = findInPluginList(plugin, topic, hash);
+        PluginMetaData*              pluginMetaData   = nullptr;
+        TopicMetaData*               topicMetaData    = new (std::nothrow) TopicMetaData();
 
         /* Check whether the plugin is already added with its topic. */
-        while (m_pluginMetaDataList.end() != pluginMetaDataIt)
+        if (m_pluginMetaDataList.end() != pluginMetaDataIt)
         {
-            PluginMetaData* pluginMetaData = *pluginMetaDataIt;
-
-            /* Found? */
-            if ((plugin == pluginMetaData->plugin) &&
-                (topic == pluginMetaData->topic))
-            {
-                ++pluginMetaData->count;
-                found = true;
-                break;
-            }
-
-            ++pluginMetaDataIt;
+            pluginMetaData = *pluginMetaDataIt;
         }
 
+        if (nullptr == topicMetaData)
+        {
+            LOG_ERROR("Not enough heap space available.");
+        }
         /* If plugin and its topic is not found, it will be added to the list. */
-        if (false == found)
+        else if (nullptr == pluginMetaData)
         {
-            PluginMetaData* pluginMetaData = new (std::nothrow) PluginMetaData();
+            pluginMetaData = new (std::nothrow) PluginMetaData();
 
-            if (nullptr != pluginMetaData)
+            if (nullptr == pluginMetaData)
             {
+                LOG_ERROR("Not enough heap space available.");
+
+                delete topicMetaData;
+                topicMetaData = nullptr;
+            }
+            else
+            {
+                MutexGuard<Mutex> guard(m_mutex);
+
                 pluginMetaData->plugin = plugin;
                 pluginMetaData->topic  = topic;
-                pluginMetaData->count  = 1U;
+                pluginMetaData->hash   = hash;
 
-                m_pluginMetaDataList.push_back(pluginMetaData);
+                /* Keep the list sorted by plugin and topic hash. */
+                (void)m_pluginMetaDataList.insert(getPluginListPos(plugin, hash), pluginMetaData);
             }
         }
+        else
+        {
+            ;
+        }
+
+        if (nullptr != topicMetaData)
+        {
+            MutexGuard<Mutex> guard(m_mutex);
+
+            topicMetaData->deviceId = deviceId;
+            topicMetaData->entityId = entityId;
+            topicMetaData->topic    = topic;
+
+            pluginMetaData->registrations.push_back(topicMetaData);
+
+            /* The plugin pushes its topic changes from now on. */
+            plugin->setTopicChangeListener(this);
+        }
     }
 }
 
-void TopicHandlerService::removeFromPluginList(IPluginMaintenance* plugin, const String& topic)
+void TopicHandlerService::removeFromPluginList(const String& deviceId, const String& entityId, IPluginMaintenance* plugin, const String& topic)
 {
     if ((nullptr != plugin) &&
         (false == topic.isEmpty()))
     {
-        PluginMetaDataList::iterator pluginMetaDataIt = m_pluginMetaDataList.begin();
+        PluginMetaDataList::iterator pluginMetaDataIt = findInPluginList(plugin, topic, getTopicHash(topic));
 
-        /* Find the plugin with its topic in the list. */
-        while (m_pluginMetaDataList.end() != pluginMetaDataIt)
+        /* Found? */
+        if (m_pluginMetaDataList.end() != pluginMetaDataIt)
         {
-            PluginMetaData* pluginMetaData = *pluginMetaDataIt;
+            MutexGuard<Mutex>           guard(m_mutex);
+            PluginMetaData*             pluginMetaData  = *pluginMetaDataIt;
+            TopicMetaDataList::iterator topicMetaDataIt = pluginMetaData->registrations.begin();
 
-            /* Found? */
-            if ((plugin == pluginMetaData->plugin) &&
-                (topic == pluginMetaData->topic))
+            /* Remove the registration. */
+            while (pluginMetaData->registrations.end() != topicMetaDataIt)
             {
-                if (0U < pluginMetaData->count)
-                {
-                    --pluginMetaData->count;
-                }
+                TopicMetaData* topicMetaData = *topicMetaDataIt;
 
-                /* If its the last registration, the entry will be removed. */
-                if (0U == pluginMetaData->count)
+                if ((deviceId == topicMetaData->deviceId) &&
+                    (entityId == topicMetaData->entityId))
                 {
-                    pluginMetaDataIt = m_pluginMetaDataList.erase(pluginMetaDataIt);
+                    topicMetaDataIt = pluginMetaData->registrations.erase(topicMetaDataIt);
 
-                    delete pluginMetaData;
-                    pluginMetaData = nullptr;
+                    delete topicMetaData;
+                    topicMetaData = nullptr;
                 }
                 else
                 {
-                    ++pluginMetaDataIt;
+                    ++topicMetaDataIt;
                 }
             }
-            else
+
+            /* If its the last registration, the entry will be removed. */
+            if (true == pluginMetaData->registrations.empty())
             {
-                ++pluginMetaDataIt;
+                PluginMetaDataList::iterator changedIt = m_changedList.begin();
+
+                while (m_changedList.end() != changedIt)
+                {
+                    if (pluginMetaData == *changedIt)
+                    {
+                        changedIt = m_changedList.erase(changedIt);
+                    }
+                    else
+                    {
+                        ++changedIt;
+                    }
+                }
+
+                (void)m_pluginMetaDataList.erase(pluginMetaDataIt);
+
+                delete pluginMetaData;
+                pluginMetaData = nullptr;
             }
         }
+
+        /* No topic of the plugin is registered anymore? */
+        if (false == isPluginInList(plugin))
+        {
+            plugin->setTopicChangeListener(nullptr);
+        }
+    }
+}
+
+bool TopicHandlerService::isPluginInList(const IPluginMaintenance* plugin)
+{
+    /* The topics of a plugin are in sequence, starting with the lowest topic hash. */
+    PluginMetaDataList::iterator pluginMetaDataIt = getPluginListPos(plugin, 0U);
+
+    return (m_pluginMetaDataList.end() != pluginMetaDataIt) &&
+           (plugin == (*pluginMetaDataIt)->plugin);
+}
+
+TopicHandlerService::PluginMetaDataList::iterator TopicHandlerService::findInPluginList(const IPluginMaintenance* plugin, const String& topic, uint32_t hash)
+{
+    PluginMetaDataList::iterator pluginMetaDataIt = getPluginListPos(plugin, hash);
+    PluginMetaDataList::iterator foundIt          = m_pluginMetaDataList.end();
+
+    /* Different topics may have the same hash. */
+    while ((m_pluginMetaDataList.end() == foundIt) &&
+           (m_pluginMetaDataList.end() != pluginMetaDataIt) &&
+           (plugin == (*pluginMetaDataIt)->plugin) &&
+           (hash == (*pluginMetaDataIt)->hash))
+    {
+        if (topic == (*pluginMetaDataIt)->topic)
+        {
+            foundIt = pluginMetaDataIt;
+        }
+
+        ++pluginMetaDataIt;
+    }
+
+    return foundIt;
+}
+
+TopicHandlerService::PluginMetaDataList::iterator TopicHandlerService::getPluginListPos(const IPluginMaintenance* plugin, uint32_t hash)
+{
+    return std::lower_bound(m_pluginMetaDataList.begin(), m_pluginMetaDataList.end(), hash,
+        [plugin](const PluginMetaData* pluginMetaData, uint32_t value) -> bool {
+            /* Pointers of different objects are only totally ordered by std::less. */
+            std::less<const IPluginMaintenance*> isLess;
+
+            return (true == isLess(pluginMetaData->plugin, plugin)) ||
+                   ((plugin == pluginMetaData->plugin) && (pluginMetaData->hash < value));
+        });
+}
+
+uint32_t TopicHandlerService::getTopicHash(const String& topic)
+{
+    /* 32-bit FNV-1a */
+    const uint32_t FNV_OFFSET_BASIS = 2166136261U;
+    const uint32_t FNV_PRIME        = 16777619U;
+    uint32_t       hash             = FNV_OFFSET_BASIS;
+    const char*    str              = topic.c_str();
+
+    while ('\0' != *str)
+    {
+        hash ^= static_cast<uint8_t>(*str);
+        hash *= FNV_PRIME;
+        ++str;
     }
+
+    return hash;
 }
 
 void TopicHandlerService::processOnChange(bool forceUpdate)
@@ -565,41 +708,50 @@ void TopicHandlerService::processOnChange(bool forceUpdate)
 
 void TopicHandlerService::processPluginsOnChange(bool forceUpdate)
 {
-    PluginMetaDataList::iterator pluginMetaDataListIt = m_pluginMetaDataList.begin();
-
-    /* Process all topics which are related to plugins. */
-    while (m_pluginMetaDataList.end() != pluginMetaDataListIt)
+    PluginMetaDataList changedList;
+
+    /* Take over the plugin topics, which changed since last time.
+     * The lists are only modified in the service context, therefore they
+     * can be processed afterwards without holding the mutex. This avoids
+     * a deadlock, because the topic handlers will read the plugin topic
+     * content, while a plugin might notify about a topic change.
+     */
     {
-        PluginMetaData* pluginMetaData = *pluginMetaDataListIt;
+        MutexGuard<Mutex>            guard(m_mutex);
+        PluginMetaDataList::iterator changedIt = m_changedList.begin();
 
-        if ((nullptr != pluginMetaData) &&
-            (nullptr != pluginMetaData->plugin))
+        while (m_changedList.end() != changedIt)
         {
-            bool hasTopicChanged = pluginMetaData->plugin->hasTopicChanged(pluginMetaData->topic);
+            (*changedIt)->isChanged = false;
+            ++changedIt;
+        }
 
-            if ((true == hasTopicChanged) ||
-                (true == forceUpdate))
-            {
-                TopicMetaDataList::iterator topicMetaDataListIt = m_topicMetaDataList.begin();
+        changedList.swap(m_changedList);
+    }
 
-                /* Notify all handlers, which are interested in this topic. */
-                while (m_topicMetaDataList.end() != topicMetaDataListIt)
-                {
-                    TopicMetaData* topicMetaData = *topicMetaDataListIt;
+    if (true == forceUpdate)
+    {
+        PluginMetaDataList::const_iterator pluginMetaDataListIt = m_pluginMetaDataList.begin();
 
-                    if ((nullptr != topicMetaData) &&
-                        (pluginMetaData->plugin == topicMetaData->plugin) &&
-                        (pluginMetaData->topic == topicMetaData->topic))
-                    {
-                        notifyAllHandlers(topicMetaData->deviceId, topicMetaData->entityId, topicMetaData->topic);
-                    }
+        /* Notify all handlers about all topics which are related to plugins. */
+        while (m_pluginMetaDataList.end() != pluginMetaDataListIt)
+        {
+            notifyAllHandlers(**pluginMetaDataListIt);
 
-                    ++topicMetaDataListIt;
-                }
-            }
+            ++pluginMetaDataListIt;
         }
+    }
+    else
+    {
+        PluginMetaDataList::const_iterator changedIt = changedList.begin();
 
-        ++pluginMetaDataListIt;
+        /* Notify all handlers only about the changed topics. */
+        while (changedList.end() != changedIt)
+        {
+            notifyAllHandlers(**changedIt);
+
+            ++changedIt;
+        }
     }
 }
 
@@ -711,6 +863,20 @@ void TopicHandlerService::notifyAllHandlers(const String& deviceId, const String
     }
 }
 
+void TopicHandlerService::notifyAllHandlers(const PluginMetaData& pluginMetaData)
+{
+    TopicMetaDataList::const_iterator topicMetaDataIt = pluginMetaData.registrations.begin();
+
+    while (pluginMetaData.registrations.end() != topicMetaDataIt)
+    {
+        const TopicMetaData* topicMetaData = *topicMetaDataIt;
+
+        notifyAllHandlers(topicMetaData->deviceId, topicMetaData->entityId, topicMetaData->topic);
+
+        ++topicMetaDataIt;
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -45,6 +45,7 @@
 #include <ITopicHandler.h>
 #include <IPluginMaintenance.hpp>
 #include <SimpleTimer.hpp>
+#include <Mutex.hpp>
 #include <vector>
 
 /******************************************************************************
@@ -61,8 +62,12 @@
 
 /**
  * The topic handler service manages all topic handlers.
+ *
+ * The plugins push their topic changes via the topic change listener
+ * interface. The changes are collected and the interested topic handlers
+ * are notified in the service process context.
  */
-class TopicHandlerService : public IService
+class TopicHandlerService : public IService, public ITopicChangeListener
 {
 public:
 
@@ -161,6 +166,16 @@ public:
      */
     void unregisterTopic(const String& deviceId, const String& entityId, const String& topic, bool purge = false);
 
+    /**
+     * Notifies about changed plugin topic content.
+     * It may be called from any task context. The topic handlers will be
+     * notified in the next on change processing period.
+     *
+     * @param[in] plugin    The plugin, which topic content changed.
+     * @param[in] topic     The topic, which content changed.
+     */
+    void onTopicChanged(IPluginMaintenance* plugin, const String& topic) final;
+
 private:
 
     /** Default topic accessibility. */
@@ -185,7 +200,6 @@ private:
     {
         String              deviceId;       /**< Id of the device this data is related to. */
         String              entityId;       /**< Id of the entity this data is related to. */
-        IPluginMaintenance* plugin;         /**< Plugin this data is related to. */
         String              topic;          /**< The topic this data is related to. */
         HasChangedFunc      hasChangedFunc; /**< Function to check whether the topic content has changed. */
 
@@ -195,7 +209,6 @@ private:
         TopicMetaData() :
             deviceId(),
             entityId(),
-            plugin(nullptr),
             topic(),
             hasChangedFunc(nullptr)
         {
@@ -209,12 +222,16 @@ private:
 
     /**
      * Plugin meta data, used for automatic publishing.
+     * It is the precomputed index from a plugin topic to all its registrations,
+     * which is updated on every topic registration and unregistration.
      */
     struct PluginMetaData
     {
-        IPluginMaintenance* plugin; /**< Plugin */
-        String              topic;  /**< Topic */
-        uint8_t             count;  /**< Number of topic registrations */
+        IPluginMaintenance* plugin;        /**< Plugin */
+        String              topic;         /**< Topic */
+        uint32_t            hash;          /**< Topic hash */
+        TopicMetaDataList   registrations; /**< Topic registrations, e.g. by plugin UID and by plugin alias. */
+        bool                isChanged;     /**< Is the topic content changed and the handlers not notified yet? */
 
         /**
          * Construct plugin meta data instance.
@@ -222,7 +239,9 @@ private:
         PluginMetaData() :
             plugin(nullptr),
             topic(),
-            count(0U)
+            hash(0U),
+            registrations(),
+            isChanged(false)
         {
         }
     };
@@ -233,8 +252,10 @@ private:
     typedef std::vector<PluginMetaData*> PluginMetaDataList;
 
     bool                                 m_isStarted;          /**< Is the service started? */
-    TopicMetaDataList                    m_topicMetaDataList;  /**< List of readable topics and the required meta data. */
-    PluginMetaDataList                   m_pluginMetaDataList; /**< List of plugins which have at least one topic registered. */
+    Mutex                                m_mutex;              /**< Mutex to protect the plugin list and the changed list against concurrent access. */
+    TopicMetaDataList                    m_topicMetaDataList;  /**< List of readable topics, which are not related to plugins, and the required meta data. */
+    PluginMetaDataList                   m_pluginMetaDataList; /**< List of plugins which have at least one topic registered, sorted by plugin and topic hash. */
+    PluginMetaDataList                   m_changedList;        /**< List of plugin topics, which changed since last on change processing. */
     SimpleTimer                          m_onChangeTimer;      /**< Timer for on change processing period. */
     uint8_t                              m_updateCounter;      /**< If counter is 0, a topic content will be updated indepdendent its changed. */
 
@@ -244,8 +265,10 @@ private:
     TopicHandlerService() :
         IService(),
         m_isStarted(false),
+        m_mutex(),
         m_topicMetaDataList(),
         m_pluginMetaDataList(),
+        m_changedList(),
         m_onChangeTimer(),
         m_updateCounter(UPDATE_COUNTER_VALUE)
     {
@@ -279,11 +302,10 @@ private:
      *
      * @param[in] deviceId          The device id which represents the physical device.
      * @param[in] entityId          The entity id which represents the entity of the device.
-     * @param[in] plugin            The plugin, which is related to the topic.
      * @param[in] topic             The topic name.
      * @param[in] hasChangedFunc    Function to retrieve whether the topic changes since last time.
      */
-    void addToTopicMetaDataList(const String& deviceId, const String& entityId, IPluginMaintenance* plugin, const String& topic, HasChangedFunc hasChangedFunc);
+    void addToTopicMetaDataList(const String& deviceId, const String& entityId, const String& topic, HasChangedFunc hasChangedFunc);
 
     /**
      * Remove topic meta data from list of automatic publishing on change.
@@ -295,21 +317,67 @@ private:
     void removeFromTopicMetaDataList(const String& deviceId, const String& entityId, const String& topic);
 
     /**
-     * Add a plugin to the list of plugins, which have at least one topic registered.
-     * If a plugin is already in the list with the same topic, nothing will be done.
+     * Add a plugin topic registration to the list of plugins, which have at least one topic registered.
+     * If a plugin is already in the list with the same topic, only the registration will be added.
+     *
+     * @param[in] deviceId  The device id which represents the physical device.
+     * @param[in] entityId  The entity id which represents the entity of the device.
+     * @param[in] plugin    The plugin, which is related to the topic.
+     * @param[in] topic     The topic name.
+     */
+    void addToPluginList(const String& deviceId, const String& entityId, IPluginMaintenance* plugin, const String& topic);
+
+    /**
+     * Remove a plugin topic registration from the list of plugins, which have at least one topic registered.
+     * If it was the last registration of the plugin topic, the plugin topic will be removed.
      *
+     * @param[in] deviceId  The device id which represents the physical device.
+     * @param[in] entityId  The entity id which represents the entity of the device.
      * @param[in] plugin    The plugin, which is related to the topic.
      * @param[in] topic     The topic name.
      */
-    void addToPluginList(IPluginMaintenance* plugin, const String& topic);
+    void removeFromPluginList(const String& deviceId, const String& entityId, IPluginMaintenance* plugin, const String& topic);
+
+    /**
+     * Is any topic of the plugin registered?
+     *
+     * @param[in] plugin    The plugin, which to check.
+     *
+     * @return If at least one topic is registered, it will return true otherwise false.
+     */
+    bool isPluginInList(const IPluginMaintenance* plugin);
 
     /**
-     * Remove a plugin from the list of plugins, which have at least one topic registered.
+     * Find a plugin topic in the list of plugins, which have at least one topic registered.
+     * The list is sorted by plugin and topic hash, therefore it is a binary search.
      *
      * @param[in] plugin    The plugin, which is related to the topic.
      * @param[in] topic     The topic name.
+     * @param[in] hash      The topic hash.
+     *
+     * @return If found, it will return the iterator to the plugin topic, otherwise the end of the list.
+     */
+    PluginMetaDataList::iterator findInPluginList(const IPluginMaintenance* plugin, const String& topic, uint32_t hash);
+
+    /**
+     * Get the first position in the list of plugins, which is not ordered
+     * before the given plugin and topic hash.
+     *
+     * @param[in] plugin    The plugin.
+     * @param[in] hash      The topic hash.
+     *
+     * @return Iterator to the position in the list.
      */
-    void removeFromPluginList(IPluginMaintenance* plugin, const String& topic);
+    PluginMetaDataList::iterator getPluginListPos(const IPluginMaintenance* plugin, uint32_t hash);
+
+    /**
+     * Get the hash of a topic.
+     *
+     * @param[in] topic The topic.
+     *
+     * @return Topic hash
+     */
+    static uint32_t getTopicHash(const String& topic);
 
     /**
      * Process all topics to check which one has changed.
@@ -320,7 +388,7 @@ private:
     void processOnChange(bool forceUpdate);
 
     /**
-     * Process all plugin topics to check which one has changed.
+     * Process all plugin topics, which changed since last time.
      * For every changed one, notify the handlers about.
      * 
      * @param[in] forceUpdate  If true, the topic content will be updated independent its changed.
@@ -358,6 +426,13 @@ private:
      * @param[in] topic     The topic name.
      */
     void notifyAllHandlers(const String& deviceId, const String& entityId, const String& topic);
+
+    /**
+     * Notify all topic handlers about changed plugin topic for every its registrations.
+     *
+     * @param[in] pluginMetaData    The plugin topic meta data.
+     */
+    void notifyAllHandlers(const PluginMetaData& pluginMetaData);
 };
 
 /******************************************************************************
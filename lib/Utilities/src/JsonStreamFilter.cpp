@@ -0,0 +1,1377 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   JsonStreamFilter.cpp
+ * @brief  Incremental JSON filter
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "JsonStreamFilter.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static bool isLiteralChar(char c);
+static bool isEscapeChar(char c);
+static void skipWhitespace(const char*& str);
+static bool getHex4(const char* str, uint32_t& value);
+static void appendUtf8(String& str, uint32_t codePoint);
+static bool unescapeKey(const char* str, size_t length, String& key);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+JsonStreamFilter::JsonStreamFilter() :
+    m_nodes(),
+    m_state(STATE_VALUE),
+    m_stack(),
+    m_depth(0U),
+    m_valueFilter(NODE_ROOT),
+    m_isValueEmitted(false),
+    m_literal(),
+    m_key(),
+    m_isKeyOverflow(false),
+    m_output()
+{
+    (void)addNode(NODE_TYPE_NONE, "");
+    (void)addNode(NODE_TYPE_ALL, "");
+    (void)addNode(NODE_TYPE_ALL, "");
+}
+
+bool JsonStreamFilter::setFilter(const String& filter)
+{
+    bool        isValid = false;
+    const char* str     = filter.c_str();
+
+    m_nodes.clear();
+    (void)addNode(NODE_TYPE_NONE, "");
+    (void)addNode(NODE_TYPE_ALL, "");
+
+    if (NODE_ROOT == parseFilterValue(str, "", 0U))
+    {
+        skipWhitespace(str);
+
+        isValid = ('\0' == *str);
+    }
+
+    /* An invalid filter skips the whole JSON document. */
+    if (false == isValid)
+    {
+        m_nodes.resize(NODE_ROOT);
+        (void)addNode(NODE_TYPE_NONE, "");
+    }
+
+    reset();
+
+    return isValid;
+}
+
+void JsonStreamFilter::reset()
+{
+    m_state          = STATE_VALUE;
+    m_depth          = 0U;
+    m_valueFilter    = NODE_ROOT;
+    m_isValueEmitted = false;
+    m_isKeyOverflow  = false;
+
+    /* Release the memory. */
+    m_key            = String();
+    m_output         = String();
+}
+
+bool JsonStreamFilter::parse(const char* data, size_t size)
+{
+    size_t index = 0U;
+
+    if (nullptr != data)
+    {
+        while ((size > index) && (STATE_ERROR != m_state))
+        {
+            if (true == processChar(data[index]))
+            {
+                ++index;
+            }
+        }
+    }
+
+    return (STATE_ERROR != m_state);
+}
+
+bool JsonStreamFilter::finish()
+{
+    /* A literal at top level ends with the JSON document. */
+    if (STATE_LITERAL == m_state)
+    {
+        if (true == m_literal.isComplete())
+        {
+            endValue();
+        }
+        else
+        {
+            m_state = STATE_ERROR;
+        }
+    }
+
+    return (STATE_DONE == m_state);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+size_t JsonStreamFilter::addNode(NodeType type, const String& key)
+{
+    Node node;
+
+    node.type        = type;
+    node.key         = key;
+    node.firstChild  = NO_NODE;
+    node.nextSibling = NO_NODE;
+
+    m_nodes.push_back(node);
+
+    return m_nodes.size() - 1U;
+}
+
+size_t JsonStreamFilter::parseFilterValue(const char*& filter, const String& key, size_t depth)
+{
+    size_t index   = NO_NODE;
+    bool   isValid = true;
+
+    skipWhitespace(filter);
+
+    if (MAX_DEPTH <= depth)
+    {
+        isValid = false;
+    }
+    else if ('{' == *filter)
+    {
+        size_t lastChild = NO_NODE;
+        bool   isEnd     = false;
+
+        index            = addNode(NODE_TYPE_OBJECT, key);
+        ++filter;
+        skipWhitespace(filter);
+
+        if ('}' == *filter)
+        {
+            ++filter;
+            isEnd = true;
+        }
+
+        while ((true == isValid) && (false == isEnd))
+        {
+            String childKey;
+            size_t child = NO_NODE;
+
+            skipWhitespace(filter);
+
+            if ('"' != *filter)
+            {
+                isValid = false;
+            }
+            else
+            {
+                const char* keyBegin = ++filter;
+
+                while (('"' != *filter) && ('\0' != *filter))
+                {
+                    if (('\\' == *filter) && ('\0' != filter[1]))
+                    {
+                        ++filter;
+                    }
+
+                    ++filter;
+                }
+
+                /* The key is compared decoded with the keys in the JSON document. */
+                if (('"' != *filter) ||
+                    (false == unescapeKey(keyBegin, filter - keyBegin, childKey)))
+                {
+                    isValid = false;
+                }
+                else
+                {
+                    ++filter;
+                    skipWhitespace(filter);
+
+                    if (':' != *filter)
+                    {
+                        isValid = false;
+                    }
+                    else
+                    {
+                        ++filter;
+                        child = parseFilterValue(filter, childKey, depth + 1U);
+                    }
+                }
+            }
+
+            if (NO_NODE == child)
+            {
+                isValid = false;
+            }
+            else
+            {
+                if (NO_NODE == lastChild)
+                {
+                    m_nodes[index].firstChild = child;
+                }
+                else
+                {
+                    m_nodes[lastChild].nextSibling = child;
+                }
+
+                lastChild = child;
+
+                skipWhitespace(filter);
+
+                if (',' == *filter)
+                {
+                    ++filter;
+                }
+                else if ('}' == *filter)
+                {
+                    ++filter;
+                    isEnd = true;
+                }
+                else
+                {
+                    isValid = false;
+                }
+            }
+        }
+    }
+    else if ('[' == *filter)
+    {
+        bool isEnd = false;
+
+        index      = addNode(NODE_TYPE_ARRAY, key);
+        ++filter;
+        skipWhitespace(filter);
+
+        if (']' == *filter)
+        {
+            ++filter;
+            isEnd = true;
+        }
+
+        while ((true == isValid) && (false == isEnd))
+        {
+            size_t child = parseFilterValue(filter, "", depth + 1U);
+
+            if (NO_NODE == child)
+            {
+                isValid = false;
+            }
+            else
+            {
+                /* Only the first element is used as element filter. */
+                if (NO_NODE == m_nodes[index].firstChild)
+                {
+                    m_nodes[index].firstChild = child;
+                }
+
+                skipWhitespace(filter);
+
+                if (',' == *filter)
+                {
+                    ++filter;
+                }
+                else if (']' == *filter)
+                {
+                    ++filter;
+                    isEnd = true;
+                }
+                else
+                {
+                    isValid = false;
+                }
+            }
+        }
+    }
+    else if (true == isLiteralChar(*filter))
+    {
+        LiteralValidator validator;
+
+        while ((true == isValid) && (true == isLiteralChar(*filter)))
+        {
+            isValid = validator.append(*filter);
+            ++filter;
+        }
+
+        if ((true == isValid) &&
+            (false == validator.isComplete()))
+        {
+            isValid = false;
+        }
+        /* Like the ArduinoJson filter, true and a non-zero number keep the value. */
+        else if (true == validator.isTruthy())
+        {
+            index = addNode(NODE_TYPE_ALL, key);
+        }
+        else
+        {
+            index = addNode(NODE_TYPE_NONE, key);
+        }
+    }
+    /* Like the ArduinoJson filter, a string keeps the value. */
+    else if ('"' == *filter)
+    {
+        ++filter;
+
+        while (('"' != *filter) && ('\0' != *filter))
+        {
+            if (('\\' == *filter) && ('\0' != filter[1]))
+            {
+                ++filter;
+            }
+
+            ++filter;
+        }
+
+        if ('"' != *filter)
+        {
+            isValid = false;
+        }
+        else
+        {
+            ++filter;
+            index = addNode(NODE_TYPE_ALL, key);
+        }
+    }
+    else
+    {
+        isValid = false;
+    }
+
+    if (false == isValid)
+    {
+        index = NO_NODE;
+    }
+
+    return index;
+}
+
+bool JsonStreamFilter::processChar(char c)
+{
+    bool isConsumed = true;
+
+    switch (m_state)
+    {
+    case STATE_VALUE:
+        if (true == isWhitespace(c))
+        {
+            ;
+        }
+        else if ('{' == c)
+        {
+            beginContainer(true);
+        }
+        else if ('[' == c)
+        {
+            beginContainer(false);
+        }
+        else if ('"' == c)
+        {
+            beginScalar(true);
+        }
+        else if (true == isLiteralChar(c))
+        {
+            beginScalar(false);
+            isConsumed = false;
+        }
+        else
+        {
+            m_state = STATE_ERROR;
+        }
+        break;
+
+    case STATE_OBJECT_BEGIN:
+        if (true == isWhitespace(c))
+        {
+            ;
+        }
+        else if ('}' == c)
+        {
+            endContainer();
+        }
+        else
+        {
+            m_state    = STATE_KEY_BEGIN;
+            isConsumed = false;
+        }
+        break;
+
+    case STATE_KEY_BEGIN:
+        if (true == isWhitespace(c))
+        {
+            ;
+        }
+        else if ('"' == c)
+        {
+            m_key.clear();
+            m_isKeyOverflow = false;
+            m_state         = STATE_KEY;
+        }
+        else
+        {
+            m_state = STATE_ERROR;
+        }
+        break;
+
+    case STATE_KEY:
+        if ('"' == c)
+        {
+            m_state = STATE_COLON;
+        }
+        else
+        {
+            if ('\\' == c)
+            {
+                m_state = STATE_KEY_ESCAPE;
+            }
+
+            appendKey(c);
+        }
+        break;
+
+    case STATE_KEY_ESCAPE:
+        if (false == isEscapeChar(c))
+        {
+            m_state = STATE_ERROR;
+        }
+        else
+        {
+            appendKey(c);
+            m_state = STATE_KEY;
+        }
+        break;
+
+    case STATE_COLON:
+        if (true == isWhitespace(c))
+        {
+            ;
+        }
+        else if (':' == c)
+        {
+            Frame& frame  = m_stack[m_depth - 1U];
+
+            m_valueFilter = getMemberFilter();
+
+            if (NODE_NONE != m_valueFilter)
+            {
+                if (true == frame.hasItems)
+                {
+                    m_output += ',';
+                }
+
+                m_output += '"';
+                m_output += m_key;
+                m_output += "\":";
+                frame.hasItems = true;
+            }
+
+            m_state = STATE_VALUE;
+        }
+        else
+        {
+            m_state = STATE_ERROR;
+        }
+        break;
+
+    case STATE_MEMBER_END:
+        if (true == isWhitespace(c))
+        {
+            ;
+        }
+        else if (',' == c)
+        {
+            m_state = STATE_KEY_BEGIN;
+        }
+        else if ('}' == c)
+        {
+            endContainer();
+        }
+        else
+        {
+            m_state = STATE_ERROR;
+        }
+        break;
+
+    case STATE_ARRAY_BEGIN:
+        if (true == isWhitespace(c))
+        {
+            ;
+        }
+        else if (']' == c)
+        {
+            endContainer();
+        }
+        else
+        {
+            m_valueFilter = getElementFilter();
+            m_state       = STATE_VALUE;
+            isConsumed    = false;
+        }
+        break;
+
+    case STATE_ELEMENT_END:
+        if (true == isWhitespace(c))
+        {
+            ;
+        }
+        else if (',' == c)
+        {
+            m_valueFilter = getElementFilter();
+            m_state       = STATE_VALUE;
+        }
+        else if (']' == c)
+        {
+            endContainer();
+        }
+        else
+        {
+            m_state = STATE_ERROR;
+        }
+        break;
+
+    case STATE_STRING:
+        if (true == m_isValueEmitted)
+        {
+            m_output += c;
+        }
+
+        if ('\\' == c)
+        {
+            m_state = STATE_STRING_ESCAPE;
+        }
+        else if ('"' == c)
+        {
+            endValue();
+        }
+        else
+        {
+            ;
+        }
+        break;
+
+    case STATE_STRING_ESCAPE:
+        if (false == isEscapeChar(c))
+        {
+            m_state = STATE_ERROR;
+        }
+        else
+        {
+            if (true == m_isValueEmitted)
+            {
+                m_output += c;
+            }
+
+            m_state = STATE_STRING;
+        }
+        break;
+
+    case STATE_LITERAL:
+        if (true == isLiteralChar(c))
+        {
+            if (false == m_literal.append(c))
+            {
+                m_state = STATE_ERROR;
+            }
+            else if (true == m_isValueEmitted)
+            {
+                m_output += c;
+            }
+            else
+            {
+                ;
+            }
+        }
+        else if (true == m_literal.isComplete())
+        {
+            endValue();
+            isConsumed = false;
+        }
+        else
+        {
+            m_state = STATE_ERROR;
+        }
+        break;
+
+    case STATE_DONE:
+        if (false == isWhitespace(c))
+        {
+            m_state = STATE_ERROR;
+        }
+        break;
+
+    case STATE_ERROR:
+        /* fallthrough */
+    default:
+        break;
+    }
+
+    return isConsumed;
+}
+
+void JsonStreamFilter::beginContainer(bool isObject)
+{
+    if (MAX_DEPTH <= m_depth)
+    {
+        m_state = STATE_ERROR;
+    }
+    else
+    {
+        Frame&   frame = m_stack[m_depth];
+        NodeType type  = m_nodes[m_valueFilter].type;
+
+        emitElementSeparator();
+
+        frame.isObject = isObject;
+        frame.hasItems = false;
+
+        if ((NODE_TYPE_ALL == type) ||
+            ((NODE_TYPE_OBJECT == type) && (true == isObject)) ||
+            ((NODE_TYPE_ARRAY == type) && (false == isObject)))
+        {
+            frame.filter    = m_valueFilter;
+            frame.isEmitted = true;
+            m_output       += (true == isObject) ? '{' : '[';
+        }
+        else
+        {
+            /* A value, which doesn't match to its filter, is replaced with null. */
+            if (NODE_TYPE_NONE != type)
+            {
+                m_output += "null";
+            }
+
+            frame.filter    = NODE_NONE;
+            frame.isEmitted = false;
+        }
+
+        ++m_depth;
+        m_state = (true == isObject) ? STATE_OBJECT_BEGIN : STATE_ARRAY_BEGIN;
+    }
+}
+
+void JsonStreamFilter::endContainer()
+{
+    const Frame& frame = m_stack[m_depth - 1U];
+
+    if (true == frame.isEmitted)
+    {
+        m_output += (true == frame.isObject) ? '}' : ']';
+    }
+
+    --m_depth;
+    endValue();
+}
+
+void JsonStreamFilter::beginScalar(bool isString)
+{
+    NodeType type = m_nodes[m_valueFilter].type;
+
+    emitElementSeparator();
+
+    if (NODE_TYPE_ALL == type)
+    {
+        m_isValueEmitted = true;
+
+        if (true == isString)
+        {
+            m_output += '"';
+        }
+    }
+    else
+    {
+        /* A value, which doesn't match to its filter, is replaced with null. */
+        if (NODE_TYPE_NONE != type)
+        {
+            m_output += "null";
+        }
+
+        m_isValueEmitted = false;
+    }
+
+    if (true == isString)
+    {
+        m_state = STATE_STRING;
+    }
+    else
+    {
+        m_literal.reset();
+        m_state = STATE_LITERAL;
+    }
+}
+
+void JsonStreamFilter::endValue()
+{
+    if (0U == m_depth)
+    {
+        m_state = STATE_DONE;
+    }
+    else if (true == m_stack[m_depth - 1U].isObject)
+    {
+        m_state = STATE_MEMBER_END;
+    }
+    else
+    {
+        m_state = STATE_ELEMENT_END;
+    }
+}
+
+void JsonStreamFilter::emitElementSeparator()
+{
+    if ((0U < m_depth) &&
+        (NODE_NONE != m_valueFilter))
+    {
+        Frame& frame = m_stack[m_depth - 1U];
+
+        if (false == frame.isObject)
+        {
+            if (true == frame.hasItems)
+            {
+                m_output += ',';
+            }
+
+            frame.hasItems = true;
+        }
+    }
+}
+
+void JsonStreamFilter::appendKey(char c)
+{
+    NodeType type = m_nodes[m_stack[m_depth - 1U].filter].type;
+
+    /* A kept object needs the whole key, otherwise its only compared with the filter. */
+    if (NODE_TYPE_ALL == type)
+    {
+        m_key += c;
+    }
+    else if (NODE_TYPE_OBJECT == type)
+    {
+        if (MAX_KEY_SIZE > m_key.length())
+        {
+            m_key += c;
+        }
+        else
+        {
+            m_isKeyOverflow = true;
+        }
+    }
+    else
+    {
+        ;
+    }
+}
+
+size_t JsonStreamFilter::getMemberFilter() const
+{
+    size_t      filter = NODE_NONE;
+    const Node& parent = m_nodes[m_stack[m_depth - 1U].filter];
+
+    if (NODE_TYPE_ALL == parent.type)
+    {
+        filter = NODE_ALL;
+    }
+    else if (NODE_TYPE_OBJECT == parent.type)
+    {
+        size_t        child     = parent.firstChild;
+        size_t        wildcard  = NODE_NONE;
+        const String* key       = &m_key;
+        String        decoded;
+        bool          isDecoded = true;
+
+        /* The key is kept escaped for the output, but compared decoded. */
+        if (0 <= m_key.indexOf('\\', 0U))
+        {
+            isDecoded = unescapeKey(m_key.c_str(), m_key.length(), decoded);
+            key       = &decoded;
+        }
+
+        while ((NODE_NONE == filter) && (NO_NODE != child))
+        {
+            const Node& node = m_nodes[child];
+
+            if ((false == m_isKeyOverflow) &&
+                (true == isDecoded) &&
+                (node.key == *key))
+            {
+                filter = child;
+            }
+            else if (node.key == "*")
+            {
+                wildcard = child;
+            }
+            else
+            {
+                ;
+            }
+
+            child = node.nextSibling;
+        }
+
+        if (NODE_NONE == filter)
+        {
+            filter = wildcard;
+        }
+
+        /* An overflowed key can not be written completely to the output. */
+        if ((true == m_isKeyOverflow) &&
+            (NODE_NONE != filter))
+        {
+            filter = NODE_NONE;
+        }
+    }
+    else
+    {
+        ;
+    }
+
+    /* A member filter, which skips its value, is equal to the NONE node. */
+    if (NODE_TYPE_NONE == m_nodes[filter].type)
+    {
+        filter = NODE_NONE;
+    }
+
+    return filter;
+}
+
+size_t JsonStreamFilter::getElementFilter() const
+{
+    size_t      filter = NODE_NONE;
+    const Node& parent = m_nodes[m_stack[m_depth - 1U].filter];
+
+    if (NODE_TYPE_ALL == parent.type)
+    {
+        filter = NODE_ALL;
+    }
+    else if ((NODE_TYPE_ARRAY == parent.type) &&
+             (NO_NODE != parent.firstChild) &&
+             (NODE_TYPE_NONE != m_nodes[parent.firstChild].type))
+    {
+        filter = parent.firstChild;
+    }
+    else
+    {
+        ;
+    }
+
+    return filter;
+}
+
+bool JsonStreamFilter::isWhitespace(char c)
+{
+    return ((' ' == c) || ('\t' == c) || ('\r' == c) || ('\n' == c));
+}
+
+void JsonStreamFilter::LiteralValidator::reset()
+{
+    m_part         = PART_BEGIN;
+    m_keyword      = nullptr;
+    m_keywordIndex = 0U;
+    m_isNonZero    = false;
+}
+
+bool JsonStreamFilter::LiteralValidator::append(char c)
+{
+    bool isValid = true;
+    bool isDigit = (('0' <= c) && ('9' >= c));
+
+    switch (m_part)
+    {
+    case PART_BEGIN:
+        if ('t' == c)
+        {
+            m_keyword = "true";
+        }
+        else if ('f' == c)
+        {
+            m_keyword = "false";
+        }
+        else if ('n' == c)
+        {
+            m_keyword = "null";
+        }
+        else
+        {
+            m_keyword = nullptr;
+        }
+
+        if (nullptr != m_keyword)
+        {
+            m_keywordIndex = 1U;
+            m_part         = PART_KEYWORD;
+        }
+        else if ('-' == c)
+        {
+            m_part = PART_MINUS;
+        }
+        else if ('0' == c)
+        {
+            m_part = PART_ZERO;
+        }
+        else if (true == isDigit)
+        {
+            m_part = PART_INTEGER;
+        }
+        else
+        {
+            isValid = false;
+        }
+        break;
+
+    case PART_KEYWORD:
+        /* The keyword end never matches, because c is a literal character. */
+        if (m_keyword[m_keywordIndex] == c)
+        {
+            ++m_keywordIndex;
+        }
+        else
+        {
+            isValid = false;
+        }
+        break;
+
+    case PART_MINUS:
+        if ('0' == c)
+        {
+            m_part = PART_ZERO;
+        }
+        else if (true == isDigit)
+        {
+            m_part = PART_INTEGER;
+        }
+        else
+        {
+            isValid = false;
+        }
+        break;
+
+    case PART_ZERO:
+        /* fallthrough */
+    case PART_INTEGER:
+        if ((PART_INTEGER == m_part) &&
+            (true == isDigit))
+        {
+            ;
+        }
+        else if ('.' == c)
+        {
+            m_part = PART_POINT;
+        }
+        else if (('e' == c) || ('E' == c))
+        {
+            m_part = PART_EXPONENT_BEGIN;
+        }
+        else
+        {
+            isValid = false;
+        }
+        break;
+
+    case PART_POINT:
+        if (true == isDigit)
+        {
+            m_part = PART_FRACTION;
+        }
+        else
+        {
+            isValid = false;
+        }
+        break;
+
+    case PART_FRACTION:
+        if (true == isDigit)
+        {
+            ;
+        }
+        else if (('e' == c) || ('E' == c))
+        {
+            m_part = PART_EXPONENT_BEGIN;
+        }
+        else
+        {
+            isValid = false;
+        }
+        break;
+
+    case PART_EXPONENT_BEGIN:
+        if (('+' == c) || ('-' == c))
+        {
+            m_part = PART_EXPONENT_SIGN;
+        }
+        else if (true == isDigit)
+        {
+            m_part = PART_EXPONENT;
+        }
+        else
+        {
+            isValid = false;
+        }
+        break;
+
+    case PART_EXPONENT_SIGN:
+        /* fallthrough */
+    case PART_EXPONENT:
+        if (true == isDigit)
+        {
+            m_part = PART_EXPONENT;
+        }
+        else
+        {
+            isValid = false;
+        }
+        break;
+
+    default:
+        isValid = false;
+        break;
+    }
+
+    /* Only the digits of the integer and fraction part decide about zero. */
+    if ((true == isValid) &&
+        ('1' <= c) &&
+        ('9' >= c) &&
+        ((PART_INTEGER == m_part) || (PART_FRACTION == m_part)))
+    {
+        m_isNonZero = true;
+    }
+
+    return isValid;
+}
+
+bool JsonStreamFilter::LiteralValidator::isComplete() const
+{
+    bool isComplete = false;
+
+    switch (m_part)
+    {
+    case PART_KEYWORD:
+        isComplete = ('\0' == m_keyword[m_keywordIndex]);
+        break;
+
+    case PART_ZERO:
+        /* fallthrough */
+    case PART_INTEGER:
+        /* fallthrough */
+    case PART_FRACTION:
+        /* fallthrough */
+    case PART_EXPONENT:
+        isComplete = true;
+        break;
+
+    default:
+        break;
+    }
+
+    return isComplete;
+}
+
+bool JsonStreamFilter::LiteralValidator::isTruthy() const
+{
+    bool isTruthy = false;
+
+    if (true == isComplete())
+    {
+        if (PART_KEYWORD == m_part)
+        {
+            isTruthy = ('t' == m_keyword[0]);
+        }
+        else
+        {
+            isTruthy = m_isNonZero;
+        }
+    }
+
+    return isTruthy;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Is the character part of a number, true, false or null?
+ *
+ * @param[in] c Character
+ *
+ * @return If its part of a literal, it will return true otherwise false.
+ */
+static bool isLiteralChar(char c)
+{
+    return ((('0' <= c) && ('9' >= c)) ||
+            (('a' <= c) && ('z' >= c)) ||
+            (('A' <= c) && ('Z' >= c)) ||
+            ('-' == c) ||
+            ('+' == c) ||
+            ('.' == c));
+}
+
+/**
+ * Is the character allowed after a backslash in a string?
+ *
+ * @param[in] c Character
+ *
+ * @return If allowed, it will return true otherwise false.
+ */
+static bool isEscapeChar(char c)
+{
+    return (('"' == c) ||
+            ('\\' == c) ||
+            ('/' == c) ||
+            ('b' == c) ||
+            ('f' == c) ||
+            ('n' == c) ||
+            ('r' == c) ||
+            ('t' == c) ||
+            ('u' == c));
+}
+
+/**
+ * Skip whitespace characters.
+ *
+ * @param[in, out] str  String, which will be moved behind the whitespaces.
+ */
+static void skipWhitespace(const char*& str)
+{
+    while ((' ' == *str) || ('\t' == *str) || ('\r' == *str) || ('\n' == *str))
+    {
+        ++str;
+    }
+}
+
+/**
+ * Get the value of 4 hexadecimal digits.
+ *
+ * @param[in]  str      String with the hexadecimal digits.
+ * @param[out] value    Value
+ *
+ * @return If 4 hexadecimal digits are available, it will return true otherwise false.
+ */
+static bool getHex4(const char* str, uint32_t& value)
+{
+    bool   isValid = true;
+    size_t index   = 0U;
+
+    value = 0U;
+
+    while ((true == isValid) && (4U > index))
+    {
+        char c = str[index];
+
+        value <<= 4U;
+
+        if (('0' <= c) && ('9' >= c))
+        {
+            value |= static_cast<uint32_t>(c - '0');
+        }
+        else if (('a' <= c) && ('f' >= c))
+        {
+            value |= static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (('A' <= c) && ('F' >= c))
+        {
+            value |= static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            isValid = false;
+        }
+
+        ++index;
+    }
+
+    return isValid;
+}
+
+/**
+ * Append a unicode code point UTF-8 encoded to the string.
+ *
+ * @param[in, out] str          String
+ * @param[in]      codePoint    Unicode code point
+ */
+static void appendUtf8(String& str, uint32_t codePoint)
+{
+    if (0x80U > codePoint)
+    {
+        str += static_cast<char>(codePoint);
+    }
+    else if (0x800U > codePoint)
+    {
+        str += static_cast<char>(0xC0U | (codePoint >> 6U));
+        str += static_cast<char>(0x80U | (codePoint & 0x3FU));
+    }
+    else if (0x10000U > codePoint)
+    {
+        str += static_cast<char>(0xE0U | (codePoint >> 12U));
+        str += static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU));
+        str += static_cast<char>(0x80U | (codePoint & 0x3FU));
+    }
+    else
+    {
+        str += static_cast<char>(0xF0U | (codePoint >> 18U));
+        str += static_cast<char>(0x80U | ((codePoint >> 12U) & 0x3FU));
+        str += static_cast<char>(0x80U | ((codePoint >> 6U) & 0x3FU));
+        str += static_cast<char>(0x80U | (codePoint & 0x3FU));
+    }
+}
+
+/**
+ * Decode the escaped characters of a key.
+ *
+ * @param[in]  str      Escaped key, without the quotation marks.
+ * @param[in]  length   Length of the escaped key in byte.
+ * @param[out] key      Decoded key
+ *
+ * @return If the key is valid, it will return true otherwise false.
+ */
+static bool unescapeKey(const char* str, size_t length, String& key)
+{
+    bool   isValid = true;
+    size_t index   = 0U;
+
+    key.clear();
+
+    while ((true == isValid) && (length > index))
+    {
+        char     c            = str[index];
+        uint32_t codePoint    = 0U;
+        uint32_t lowSurrogate = 0U;
+
+        ++index;
+
+        if ('\\' != c)
+        {
+            key += c;
+        }
+        else if (length <= index)
+        {
+            isValid = false;
+        }
+        else
+        {
+            c = str[index];
+            ++index;
+
+            switch (c)
+            {
+            case 'b':
+                key += '\b';
+                break;
+
+            case 'f':
+                key += '\f';
+                break;
+
+            case 'n':
+                key += '\n';
+                break;
+
+            case 'r':
+                key += '\r';
+                break;
+
+            case 't':
+                key += '\t';
+                break;
+
+            case 'u':
+                if ((length < (index + 4U)) ||
+                    (false == getHex4(&str[index], codePoint)))
+                {
+                    isValid = false;
+                }
+                else
+                {
+                    index += 4U;
+
+                    /* A high surrogate is combined with the following low surrogate. */
+                    if ((0xD800U <= codePoint) &&
+                        (0xDBFFU >= codePoint) &&
+                        (length >= (index + 6U)) &&
+                        ('\\' == str[index]) &&
+                        ('u' == str[index + 1U]) &&
+                        (true == getHex4(&str[index + 2U], lowSurrogate)) &&
+                        (0xDC00U <= lowSurrogate) &&
+                        (0xDFFFU >= lowSurrogate))
+                    {
+                        codePoint  = 0x10000U + ((codePoint - 0xD800U) << 10U) + (lowSurrogate - 0xDC00U);
+                        index     += 6U;
+                    }
+
+                    appendUtf8(key, codePoint);
+                }
+                break;
+
+            default:
+                if (true == isEscapeChar(c))
+                {
+                    key += c;
+                }
+                else
+                {
+                    isValid = false;
+                }
+                break;
+            }
+        }
+    }
+
+    return isValid;
+}
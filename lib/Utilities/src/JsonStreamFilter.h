@@ -0,0 +1,401 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   JsonStreamFilter.h
+ * @brief  Incremental JSON filter
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup UTILITIES
+ *
+ * @{
+ */
+
+#ifndef JSON_STREAM_FILTER_H
+#define JSON_STREAM_FILTER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include <WString.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Incremental JSON filter, which parses a JSON document chunk by chunk and
+ * keeps only the declared values. The kept values are written as minified
+ * JSON text to the output, which can be deserialized afterwards.
+ *
+ * Therefore the required memory depends only on the declared values and
+ * not on the size of the whole JSON document.
+ *
+ * The filter uses the same notation like the ArduinoJson filter:
+ * - true, a non-zero number or a string keeps the value.
+ * - false, null or zero skips the value.
+ * - An object keeps only the members with the given keys. The key "*"
+ *   matches every member.
+ * - An array applies its first element to all elements.
+ *
+ * Escaped characters in keys are decoded before they are compared, e.g. the
+ * key "\u0061" matches the filter key "a".
+ *
+ * Example: {"list":[{"main":{"temp":true}}],"city":{"name":true}}
+ */
+class JsonStreamFilter
+{
+public:
+
+    /**
+     * Constructs the filter, which keeps the whole JSON document.
+     */
+    JsonStreamFilter();
+
+    /**
+     * Destroys the filter.
+     */
+    ~JsonStreamFilter()
+    {
+    }
+
+    /**
+     * Set the filter and reset the parser.
+     *
+     * @param[in] filter    Filter in JSON format.
+     *
+     * @return If the filter is valid, it will return true otherwise false.
+     */
+    bool setFilter(const String& filter);
+
+    /**
+     * Reset the parser and clear the output to start with the next JSON
+     * document. The filter is kept.
+     */
+    void reset();
+
+    /**
+     * Parse the next chunk of the JSON document.
+     *
+     * @param[in] data  Chunk data
+     * @param[in] size  Chunk size in byte
+     *
+     * @return If the chunk is valid so far, it will return true otherwise false.
+     */
+    bool parse(const char* data, size_t size);
+
+    /**
+     * Finish parsing after the last chunk.
+     *
+     * @return If a complete JSON document was parsed, it will return true otherwise false.
+     */
+    bool finish();
+
+    /**
+     * Get the filtered JSON document in minified JSON format.
+     * Its only complete after finish() returned true. If the filter skips
+     * the whole document, it is empty.
+     *
+     * @return Filtered JSON document
+     */
+    const String& getOutput() const
+    {
+        return m_output;
+    }
+
+    /**
+     * Max. nesting depth of the JSON document.
+     */
+    static const size_t MAX_DEPTH    = 16U;
+
+    /**
+     * Max. length of a key, which is compared with the filter.
+     * Members with longer keys are skipped, except inside a kept object.
+     */
+    static const size_t MAX_KEY_SIZE = 64U;
+
+private:
+
+    /**
+     * Filter node types.
+     */
+    enum NodeType
+    {
+        NODE_TYPE_NONE = 0, /**< Skip the value. */
+        NODE_TYPE_ALL,      /**< Keep the whole value. */
+        NODE_TYPE_OBJECT,   /**< Keep the object members with matching keys. */
+        NODE_TYPE_ARRAY     /**< Apply the element filter to all elements. */
+    };
+
+    /**
+     * A node of the filter tree.
+     */
+    struct Node
+    {
+        NodeType type;        /**< Node type */
+        String   key;         /**< Key of the object member, which the node filters. */
+        size_t   firstChild;  /**< Index of the first child node or NO_NODE. */
+        size_t   nextSibling; /**< Index of the next sibling node or NO_NODE. */
+    };
+
+    /**
+     * Parser states.
+     */
+    enum State
+    {
+        STATE_VALUE = 0,      /**< Wait for a value. */
+        STATE_OBJECT_BEGIN,   /**< Wait for the first key or the object end. */
+        STATE_KEY_BEGIN,      /**< Wait for the next key. */
+        STATE_KEY,            /**< Inside a key. */
+        STATE_KEY_ESCAPE,     /**< Escaped character inside a key. */
+        STATE_COLON,          /**< Wait for the colon after a key. */
+        STATE_MEMBER_END,     /**< Wait for the next member or the object end. */
+        STATE_ARRAY_BEGIN,    /**< Wait for the first element or the array end. */
+        STATE_ELEMENT_END,    /**< Wait for the next element or the array end. */
+        STATE_STRING,         /**< Inside a string value. */
+        STATE_STRING_ESCAPE,  /**< Escaped character inside a string value. */
+        STATE_LITERAL,        /**< Inside a number, true, false or null. */
+        STATE_DONE,           /**< JSON document completely parsed. */
+        STATE_ERROR           /**< Invalid JSON document. */
+    };
+
+    /**
+     * A nested object or array.
+     */
+    struct Frame
+    {
+        size_t filter;    /**< Index of the filter node. */
+        bool   isObject;  /**< Object (true) or array (false) */
+        bool   isEmitted; /**< Is the container written to the output? */
+        bool   hasItems;  /**< Are already members/elements written to the output? */
+    };
+
+    /**
+     * Validates a literal character by character, which is a number,
+     * true, false or null.
+     */
+    class LiteralValidator
+    {
+    public:
+
+        /**
+         * Constructs the validator, which waits for the first character.
+         */
+        LiteralValidator() :
+            m_part(PART_BEGIN),
+            m_keyword(nullptr),
+            m_keywordIndex(0U),
+            m_isNonZero(false)
+        {
+        }
+
+        /**
+         * Reset the validator to start with the next literal.
+         */
+        void reset();
+
+        /**
+         * Validate the next character of the literal.
+         *
+         * @param[in] c Character
+         *
+         * @return If the literal is valid so far, it will return true otherwise false.
+         */
+        bool append(char c);
+
+        /**
+         * Is the literal complete?
+         *
+         * @return If complete, it will return true otherwise false.
+         */
+        bool isComplete() const;
+
+        /**
+         * Is the literal complete and true or a non-zero number?
+         *
+         * @return If truthy, it will return true otherwise false.
+         */
+        bool isTruthy() const;
+
+    private:
+
+        /**
+         * Literal parts, see RFC 8259 chapter 3 and 6.
+         */
+        enum Part
+        {
+            PART_BEGIN = 0,      /**< Wait for the first character. */
+            PART_KEYWORD,        /**< Inside true, false or null. */
+            PART_MINUS,          /**< After the minus sign of a number. */
+            PART_ZERO,           /**< After the leading zero of the integer part. */
+            PART_INTEGER,        /**< Inside the integer part. */
+            PART_POINT,          /**< After the decimal point. */
+            PART_FRACTION,       /**< Inside the fraction part. */
+            PART_EXPONENT_BEGIN, /**< After the exponent marker. */
+            PART_EXPONENT_SIGN,  /**< After the sign of the exponent. */
+            PART_EXPONENT        /**< Inside the exponent. */
+        };
+
+        Part        m_part;         /**< Current part of the literal */
+        const char* m_keyword;      /**< Expected keyword or nullptr for a number */
+        size_t      m_keywordIndex; /**< Index of the next expected keyword character */
+        bool        m_isNonZero;    /**< Has the number a non-zero integer or fraction digit? */
+    };
+
+    /** Used to mark a missing node. */
+    static const size_t NO_NODE   = SIZE_MAX;
+
+    /** Index of the node, which skips a value. */
+    static const size_t NODE_NONE = 0U;
+
+    /** Index of the node, which keeps a value. */
+    static const size_t NODE_ALL  = 1U;
+
+    /** Index of the filter root node. */
+    static const size_t NODE_ROOT = 2U;
+
+    std::vector<Node> m_nodes;            /**< Filter tree */
+    State             m_state;            /**< Parser state */
+    Frame             m_stack[MAX_DEPTH]; /**< Nested objects and arrays */
+    size_t            m_depth;            /**< Current nesting depth */
+    size_t            m_valueFilter;      /**< Index of the filter node of the next value. */
+    bool              m_isValueEmitted;   /**< Is the current string or literal written to the output? */
+    LiteralValidator  m_literal;          /**< Validates the current literal. */
+    String            m_key;              /**< Current key */
+    bool              m_isKeyOverflow;    /**< Is the current key longer than MAX_KEY_SIZE? */
+    String            m_output;           /**< Filtered JSON document */
+
+    JsonStreamFilter(const JsonStreamFilter& filter);
+    JsonStreamFilter& operator=(const JsonStreamFilter& filter);
+
+    /**
+     * Add a node to the filter tree.
+     *
+     * @param[in] type  Node type
+     * @param[in] key   Key of the object member
+     *
+     * @return Node index
+     */
+    size_t addNode(NodeType type, const String& key);
+
+    /**
+     * Parse a filter value and add it with all its children to the filter tree.
+     *
+     * @param[in, out]  filter  Filter in JSON format, it will be moved behind the parsed value.
+     * @param[in]       key     Key of the object member, which the value filters.
+     * @param[in]       depth   Nesting depth
+     *
+     * @return Node index or NO_NODE in case of an invalid filter.
+     */
+    size_t parseFilterValue(const char*& filter, const String& key, size_t depth);
+
+    /**
+     * Process a single character of the JSON document.
+     *
+     * @param[in] c Character
+     *
+     * @return If the character is consumed, it will return true. Otherwise it must be processed again.
+     */
+    bool processChar(char c);
+
+    /**
+     * Handle the begin of a object or array value.
+     *
+     * @param[in] isObject  Object (true) or array (false)
+     */
+    void beginContainer(bool isObject);
+
+    /**
+     * Handle the end of the current object or array.
+     */
+    void endContainer();
+
+    /**
+     * Handle the begin of a string or literal value.
+     *
+     * @param[in] isString  String (true) or literal (false)
+     */
+    void beginScalar(bool isString);
+
+    /**
+     * Handle the end of a value.
+     */
+    void endValue();
+
+    /**
+     * Write the element separator, if the next value is a kept array element.
+     */
+    void emitElementSeparator();
+
+    /**
+     * Add a character to the current key.
+     *
+     * @param[in] c Character
+     */
+    void appendKey(char c);
+
+    /**
+     * Get the filter of the member with the current key.
+     *
+     * @return Index of the filter node
+     */
+    size_t getMemberFilter() const;
+
+    /**
+     * Get the filter of the next array element.
+     *
+     * @return Index of the filter node
+     */
+    size_t getElementFilter() const;
+
+    /**
+     * Is the character a JSON whitespace?
+     *
+     * @param[in] c Character
+     *
+     * @return If whitespace, it will return true otherwise false.
+     */
+    static bool isWhitespace(char c);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* JSON_STREAM_FILTER_H */
+
+/** @} */
@@ -0,0 +1,131 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   ReusableJsonDocument.hpp
+ * @brief  Reusable JSON document
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup UTILITIES
+ *
+ * @{
+ */
+
+#ifndef REUSABLE_JSON_DOCUMENT_HPP
+#define REUSABLE_JSON_DOCUMENT_HPP
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stddef.h>
+#include <ArduinoJson.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A JSON document, which memory is allocated on first use and reused for
+ * every further use. Compared to a temporary JSON document per request, the
+ * memory is allocated only once, which avoids the heap fragmentation on
+ * long-running devices.
+ *
+ * It shall only be used by a single task and not nested.
+ *
+ * @tparam capacity Capacity of the JSON document in byte.
+ */
+template < size_t capacity >
+class ReusableJsonDocument
+{
+public:
+
+    /**
+     * Constructs the reusable JSON document, without allocating memory.
+     */
+    ReusableJsonDocument() :
+        m_jsonDoc(0U)
+    {
+    }
+
+    /**
+     * Destroys the reusable JSON document.
+     */
+    ~ReusableJsonDocument()
+    {
+    }
+
+    /**
+     * Get the empty JSON document.
+     * If its memory couldn't be allocated, the JSON document will have no
+     * capacity and every modification will overflow it.
+     *
+     * @return JSON document
+     */
+    DynamicJsonDocument& get()
+    {
+        if (capacity > m_jsonDoc.capacity())
+        {
+            m_jsonDoc = DynamicJsonDocument(capacity);
+        }
+        else
+        {
+            m_jsonDoc.clear();
+        }
+
+        return m_jsonDoc;
+    }
+
+    /**
+     * Release the memory of the JSON document.
+     */
+    void release()
+    {
+        m_jsonDoc = DynamicJsonDocument(0U);
+    }
+
+private:
+
+    DynamicJsonDocument m_jsonDoc; /**< JSON document */
+
+    ReusableJsonDocument(const ReusableJsonDocument& doc);
+    ReusableJsonDocument& operator=(const ReusableJsonDocument& doc);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* REUSABLE_JSON_DOCUMENT_HPP */
+
+/** @} */
\ No newline at end of file
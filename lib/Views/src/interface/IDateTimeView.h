@@ -112,6 +112,14 @@ public:
      */
     virtual void update(YAGfx& gfx)                                                            = 0;
 
+    /**
+     * Is the view animated, e.g. by a scrolling text?
+     * As long as it is animated, it shall be updated periodically.
+     *
+     * @return If animated, it will return true otherwise false.
+     */
+    virtual bool isAnimated() const                                                            = 0;
+
     /**
      * Get text (non-formatted).
      *
@@ -172,6 +172,16 @@ public:
         }
     }
 
+    /**
+     * Is the view animated, e.g. by a scrolling text?
+     *
+     * @return If animated, it will return true otherwise false.
+     */
+    bool isAnimated() const override
+    {
+        return m_textWidget.isAnimated();
+    }
+
     /**
      * Get text (non-formatted).
      *
@@ -92,6 +92,9 @@ public:
         m_bitmapWidget.setHorizontalAlignment(Alignment::Horizontal::HORIZONTAL_CENTER);
 
         m_textWidget.setVerticalAlignment(Alignment::Vertical::VERTICAL_CENTER);
+
+        /* Scrolling text is copied from a pre-rendered strip. */
+        m_textWidget.enableScrollStrip();
     }
 
     /**
@@ -148,6 +151,16 @@ public:
         m_textWidget.update(gfx);
     }
 
+    /**
+     * Is the view animated, e.g. by a scrolling text or an animated icon?
+     *
+     * @return If animated, it will return true otherwise false.
+     */
+    bool isAnimated() const override
+    {
+        return (true == m_bitmapWidget.isAnimated()) || (true == m_textWidget.isAnimated());
+    }
+
     /**
      * Get text (non-formatted).
      *
@@ -155,6 +155,16 @@ public:
         m_textWidget.update(gfx);
     }
 
+    /**
+     * Is the view animated, e.g. by a scrolling text or an animated icon?
+     *
+     * @return If animated, it will return true otherwise false.
+     */
+    bool isAnimated() const override
+    {
+        return (true == m_bitmapWidget.isAnimated()) || (true == m_textWidget.isAnimated());
+    }
+
     /**
      * Get text (non-formatted).
      *
@@ -77,6 +77,8 @@ public:
         m_bitmapWidget(BITMAP_WIDTH, BITMAP_HEIGHT, BITMAP_X, BITMAP_Y),
         m_textWidget(TEXT_WIDTH_FULL, TEXT_HEIGHT, TEXT_X_FULL, TEXT_Y) /* Use full width. */
     {
+        /* Scrolling text is copied from a pre-rendered strip. */
+        m_textWidget.enableScrollStrip();
     }
 
     /**
@@ -133,6 +135,16 @@ public:
         m_textWidget.update(gfx);
     }
 
+    /**
+     * Is the view animated, e.g. by a scrolling text or an animated icon?
+     *
+     * @return If animated, it will return true otherwise false.
+     */
+    bool isAnimated() const override
+    {
+        return (true == m_bitmapWidget.isAnimated()) || (true == m_textWidget.isAnimated());
+    }
+
     /**
      * Get text (non-formatted).
      *
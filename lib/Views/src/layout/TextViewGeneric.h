@@ -74,6 +74,8 @@ public:
         m_fontType(Fonts::FONT_TYPE_DEFAULT),
         m_textWidget(TEXT_WIDTH, TEXT_HEIGHT, TEXT_X, TEXT_Y)
     {
+        /* Scrolling text is copied from a pre-rendered strip. */
+        m_textWidget.enableScrollStrip();
     }
 
     /**
@@ -128,19 +128,6 @@ bool VolumioPlugin::setTopic(const String& topic, const JsonObjectConst& value)
     return isSuccessful;
 }
 
-bool VolumioPlugin::hasTopicChanged(const String& topic)
-{
-    MutexGuard<MutexRecursive> guard(m_mutex);
-    bool                       hasTopicChanged = m_hasTopicChanged;
-
-    /* Only a single topic, therefore its not necessary to check. */
-    PLUGIN_NOT_USED(topic);
-
-    m_hasTopicChanged = false;
-
-    return hasTopicChanged;
-}
-
 void VolumioPlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
@@ -314,7 +301,7 @@ bool VolumioPlugin::setConfiguration(const JsonObjectConst& jsonCfg)
         /* Force update on display */
         m_requestTimer.start(UPDATE_PERIOD_SHORT);
 
-        m_hasTopicChanged = true;
+        notifyTopicChanged(TOPIC_CONFIG);
 
         status            = true;
     }
@@ -353,35 +340,8 @@ void VolumioPlugin::changeState(VolumioState state)
 
 bool VolumioPlugin::startHttpRequest()
 {
-    bool                            status = false;
-    RestService::PreProcessCallback preProcessCallback =
-        [this](const char* payload, size_t size, DynamicJsonDocument& doc) {
-            return this->preProcessAsyncWebResponse(payload, size, doc);
-        };
-
-    if (false == m_volumioHost.isEmpty())
-    {
-        String url      = String("http://") + m_volumioHost + "/api/v1/getState";
-
-        m_dynamicRestId = RestService::getInstance().get(url, preProcessCallback);
-
-        if (RestService::INVALID_REST_ID == m_dynamicRestId)
-        {
-            LOG_WARNING("GET %s failed.", url.c_str());
-        }
-        else
-        {
-            status = true;
-        }
-    }
-
-    return status;
-}
-
-bool VolumioPlugin::preProcessAsyncWebResponse(const char* payload, size_t payloadSize, DynamicJsonDocument& jsonDoc)
-{
-    bool                            isSuccessful = false;
-    const size_t                    FILTER_SIZE  = 128U;
+    bool                            status      = false;
+    const size_t                    FILTER_SIZE = 128U;
     StaticJsonDocument<FILTER_SIZE> jsonFilterDoc;
 
     jsonFilterDoc["artist"]   = true;
@@ -395,21 +355,27 @@ bool VolumioPlugin::preProcessAsyncWebResponse(const char* payload, size_t paylo
     {
         LOG_ERROR("Less memory for filter available.");
     }
-    else
+    else if (false == m_volumioHost.isEmpty())
     {
-        DeserializationError error = deserializeJson(jsonDoc, payload, payloadSize, DeserializationOption::Filter(jsonFilterDoc));
+        String url      = String("http://") + m_volumioHost + "/api/v1/getState";
 
-        if (DeserializationError::Ok != error.code())
+        m_dynamicRestId = RestService::getInstance().get(url, jsonFilterDoc, getUID());
+
+        if (RestService::INVALID_REST_ID == m_dynamicRestId)
         {
-            LOG_WARNING("JSON parse error: %s", error.c_str());
+            LOG_WARNING("GET %s failed.", url.c_str());
         }
         else
         {
-            isSuccessful = true;
+            status = true;
         }
     }
+    else
+    {
+        ;
+    }
 
-    return isSuccessful;
+    return status;
 }
 
 void VolumioPlugin::handleWebResponse(const DynamicJsonDocument& jsonDoc)
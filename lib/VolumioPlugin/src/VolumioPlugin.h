@@ -87,7 +87,6 @@ public:
         m_lastSeekValue(0U),
         m_pos(0U),
         m_state(STATE_UNKNOWN),
-        m_hasTopicChanged(false),
         m_dynamicRestId(RestService::INVALID_REST_ID),
         m_isAllowedToSend(true)
     {
@@ -197,17 +196,6 @@ public:
      */
     bool setTopic(const String& topic, const JsonObjectConst& value) final;
 
-    /**
-     * Is the topic content changed since last time?
-     * Every readable volatile topic shall support this. Otherwise the topic
-     * handlers might not be able to provide updated information.
-     *
-     * @param[in] topic The topic which to check.
-     *
-     * @return If the topic content changed since last time, it will return true otherwise false.
-     */
-    bool hasTopicChanged(const String& topic) final;
-
     /**
      * Start the plugin. This is called only once during plugin lifetime.
      * It can be used as deferred initialization (after the constructor)
@@ -307,7 +295,6 @@ private:
     uint32_t               m_lastSeekValue;   /**< Last seek value, retrieved from VOLUMIO. Used to cross-check the provided status. */
     uint8_t                m_pos;             /**< Current music position in percent. */
     VolumioState           m_state;           /**< Volumio player state */
-    bool                   m_hasTopicChanged; /**< Has the topic content changed? */
     uint32_t               m_dynamicRestId;   /**< Used to identify plugin when interacting with RestService. Id changes with every request. */
     bool                   m_isAllowedToSend; /**< Is allowed to send REST-Api request? */
 
@@ -342,18 +329,6 @@ private:
      */
     bool startHttpRequest(void);
 
-    /**
-     * Handle asynchronous web response from the server.
-     * This will be called in LwIP context! Don't modify any member here directly!
-     *
-     * @param[in] payload     Payload of the web response
-     * @param[in] payloadSize Size of the payload
-     * @param[out] jsonDoc    DynamicJsonDocument used to store result in.
-     *
-     * @return If successful it will return true otherwise false.
-     */
-    bool preProcessAsyncWebResponse(const char* payload, size_t payloadSize, DynamicJsonDocument& jsonDoc);
-
     /**
      * Handle a web response from the server.
      *
@@ -484,7 +484,6 @@ void WormPlugin::drawWorm(uint8_t wormId, YAGfx& gfx)
     {
         size_t      wormPos         = wormPosInArray(wormId);
         size_t      idx             = 1U; /* 0 is the head, body starts at 1. */
-        Color       bodyColor       = m_wormBodyColor[wormId];
         uint8_t     brightnessDelta = UINT8_MAX / (m_wormLen[wormId] - 1U); /* Consider only the body without head. */
 
         /* Draw worm head */
@@ -493,6 +492,8 @@ void WormPlugin::drawWorm(uint8_t wormId, YAGfx& gfx)
         /* Draw worm body */
         while(m_wormLen[wormId] > idx)
         {
+            Color bodyColor = m_wormBodyColor[wormId];
+
             /* The body gets darker till the end. */
             bodyColor.setIntensity(UINT8_MAX - brightnessDelta * (idx - 1U));
 
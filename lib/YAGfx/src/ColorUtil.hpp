@@ -208,6 +208,32 @@ static inline uint32_t to888(uint16_t rgb565)
     return to888(RED8, GREEN8, BLUE8);
 }
 
+/**
+ * Scale the red, green and blue channel of a RGB888 color value by the
+ * intensity, which results in (channel * intensity) / 255 per channel.
+ *
+ * Red and blue are scaled together with a single multiplication, because
+ * they are placed in separate 16-bit lanes of a 32-bit word. The division
+ * by 255 is replaced by an exact add and shift sequence for products of
+ * two 8-bit values.
+ *
+ * @param[in] rgb888    RGB888 color value
+ * @param[in] intensity Intensity [0; 255]
+ *
+ * @return Scaled RGB888 color value
+ */
+static inline uint32_t scaleRgb888(uint32_t rgb888, uint8_t intensity)
+{
+    const uint32_t LANE_MASK = 0x00ff00ffU;
+    uint32_t       redBlue   = (rgb888 & LANE_MASK) * intensity;
+    uint32_t       green     = ((rgb888 >> 8U) & 0xffU) * intensity;
+
+    redBlue = ((redBlue + 0x00010001U + ((redBlue >> 8U) & LANE_MASK)) >> 8U) & LANE_MASK;
+    green   = ((green + 1U + (green >> 8U)) >> 8U) & 0xffU;
+
+    return redBlue | (green << 8U);
+}
+
 }; /* namespace ColorUtil */
 
 #endif /* COLOR_UTIL_HPP */
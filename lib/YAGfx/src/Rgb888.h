@@ -198,7 +198,7 @@ public:
      */
     operator uint32_t() const
     {
-        return ColorUtil::to888(getRed(), getGreen(), getBlue());
+        return applyIntensity(ColorUtil::to888(m_red, m_green, m_blue));
     }
 
     /**
@@ -210,9 +210,11 @@ public:
      */
     void get(uint8_t& red, uint8_t& green, uint8_t& blue) const
     {
-        red   = applyIntensity(m_red);
-        green = applyIntensity(m_green);
-        blue  = applyIntensity(m_blue);
+        uint32_t rgb888 = applyIntensity(ColorUtil::to888(m_red, m_green, m_blue));
+
+        red   = ColorUtil::rgb888Red(rgb888);
+        green = ColorUtil::rgb888Green(rgb888);
+        blue  = ColorUtil::rgb888Blue(rgb888);
     }
 
     /**
@@ -388,6 +390,26 @@ private:
         return (static_cast<uint16_t>(baseColor) * static_cast<uint16_t>(m_intensity)) / MAX_BRIGHT;
     }
 
+    /**
+     * Calculate all base colors at once with respect to the current intensity.
+     * A color with max. intensity is returned unchanged.
+     *
+     * @param[in] rgb888    RGB888 color value
+     *
+     * @return RGB888 color value with considered intensity.
+     */
+    inline uint32_t applyIntensity(uint32_t rgb888) const
+    {
+        uint32_t result = rgb888;
+
+        if (MAX_BRIGHT != m_intensity)
+        {
+            result = ColorUtil::scaleRgb888(rgb888, m_intensity);
+        }
+
+        return result;
+    }
+
 };
 
 /******************************************************************************
@@ -52,6 +52,8 @@
 
 #if (CONFIG_COLOR_DEPTH == 32)
 #include <Rgb888.h>
+#elif (CONFIG_COLOR_DEPTH == 24)
+#include <Rgb888Packed.h>
 #elif (CONFIG_COLOR_DEPTH == 16)
 #include <Rgb565.h>
 #endif /* CONFIG_COLOR_DEPTH */
@@ -73,6 +75,14 @@
  */
 typedef Rgb888 Color;
 
+#elif (CONFIG_COLOR_DEPTH == 24)
+
+/**
+ * Defines the general color to packed RGB888 format, which saves one byte
+ * per pixel by applying the intensity immediately.
+ */
+typedef Rgb888Packed Color;
+
 #elif (CONFIG_COLOR_DEPTH == 16)
 
 /**
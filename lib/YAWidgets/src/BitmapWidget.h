@@ -219,6 +219,17 @@ public:
         return IMG_TYPE_NO_IMAGE == m_imgType;
     }
 
+    /**
+     * Is the image animated?
+     * Only a GIF image can be animated, as long as it is not finished playing.
+     *
+     * @return If animated, it will return true otherwise false.
+     */
+    bool isAnimated() const
+    {
+        return (IMG_TYPE_GIF == m_imgType) && (false == m_gifPlayer.isFinished());
+    }
+
     /** Widget type string */
     static const char* WIDGET_TYPE;
 
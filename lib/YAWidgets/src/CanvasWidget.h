@@ -214,6 +214,19 @@ public:
         m_bitmap.drawPixel(x, y, color);
     }
 
+    /**
+     * Mark a rectangular region as changed.
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Region width in pixel
+     * @param[in] height    Region height in pixel
+     */
+    void markDirty(int16_t x, int16_t y, uint16_t width, uint16_t height) final
+    {
+        m_bitmap.markDirty(x, y, width, height);
+    }
+
     /**
      * Get the address inside the framebuffer at certain coordinates.
      * If the requested length is not available, it will return nullptr.
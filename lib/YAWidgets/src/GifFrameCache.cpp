@@ -0,0 +1,295 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   GifFrameCache.cpp
+ * @brief  Cache for decoded GIF animation frames
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GifFrameCache.h"
+#include <stdlib.h>
+#include <esp32-hal-psram.h>
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void GifFrameCache::startRecording()
+{
+    if ((STATE_IDLE == m_state) &&
+        (0U < m_budget))
+    {
+        m_state = STATE_RECORDING;
+    }
+}
+
+void GifFrameCache::addFrame(const YAGfxBitmap& bitmap, uint32_t delay)
+{
+    if (STATE_RECORDING == m_state)
+    {
+        size_t runCount  = encode(bitmap, nullptr);
+        size_t frameSize = sizeof(Frame) + runCount * sizeof(Run);
+        Frame* frame     = nullptr;
+
+        if (m_budget >= (m_size + frameSize))
+        {
+            /* Intentionally PSRAM only. Without PSRAM the scenes shall not
+             * compete with the rest of the system for the heap.
+             */
+            frame = static_cast<Frame*>(ps_malloc(frameSize));
+        }
+
+        if (nullptr == frame)
+        {
+            LOG_DEBUG("GIF frame cache disabled, %u bytes used.", m_size + frameSize);
+
+            releaseFrames();
+            m_state = STATE_DISABLED;
+        }
+        else
+        {
+            frame->next     = nullptr;
+            frame->delay    = delay;
+            frame->runCount = encode(bitmap, getRuns(frame));
+
+            if (nullptr == m_tail)
+            {
+                m_head = frame;
+            }
+            else
+            {
+                m_tail->next = frame;
+            }
+
+            m_tail  = frame;
+            m_size += frameSize;
+        }
+    }
+}
+
+void GifFrameCache::finishRecording()
+{
+    if (STATE_RECORDING == m_state)
+    {
+        if (nullptr == m_head)
+        {
+            m_state = STATE_DISABLED;
+        }
+        else
+        {
+            m_current = m_head;
+            m_state   = STATE_COMPLETE;
+        }
+    }
+}
+
+bool GifFrameCache::getNextFrame(YAGfxBitmap& bitmap, uint32_t& delay)
+{
+    bool isAvailable = false;
+
+    if (STATE_COMPLETE == m_state)
+    {
+        /* End of the animation loop? */
+        if (nullptr == m_current)
+        {
+            m_current = m_head;
+        }
+        else
+        {
+            decode(m_current, bitmap);
+
+            delay       = m_current->delay;
+            m_current   = m_current->next;
+            isAvailable = true;
+        }
+    }
+
+    return isAvailable;
+}
+
+void GifFrameCache::clear()
+{
+    releaseFrames();
+    m_state = STATE_IDLE;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void GifFrameCache::releaseFrames()
+{
+    while (nullptr != m_head)
+    {
+        Frame* next = m_head->next;
+
+        free(m_head);
+        m_head = next;
+    }
+
+    m_tail    = nullptr;
+    m_current = nullptr;
+    m_size    = 0U;
+}
+
+size_t GifFrameCache::encode(const YAGfxBitmap& bitmap, Run* runs)
+{
+    size_t   runCount = 0U;
+    Run      countRun = { 0U, 0U, 0U, 0U };
+    Run*     run      = nullptr;
+    uint16_t width    = bitmap.getWidth();
+    uint16_t height   = bitmap.getHeight();
+    int16_t  y;
+
+    for (y = 0; y < static_cast<int16_t>(height); ++y)
+    {
+        uint16_t     offset = 0U;
+        const Color* pixel  = bitmap.getFrameBufferXAddr(0, y, width, offset);
+
+        if (nullptr != pixel)
+        {
+            uint16_t x;
+
+            for (x = 0U; x < width; ++x)
+            {
+                uint8_t red   = pixel->getRed();
+                uint8_t green = pixel->getGreen();
+                uint8_t blue  = pixel->getBlue();
+
+                /* Continue the current run? */
+                if ((nullptr != run) &&
+                    (UINT8_MAX > run->length) &&
+                    (red == run->red) &&
+                    (green == run->green) &&
+                    (blue == run->blue))
+                {
+                    ++run->length;
+                }
+                else
+                {
+                    /* Only counting? A local run is used for the comparison. */
+                    if (nullptr == runs)
+                    {
+                        run = &countRun;
+                    }
+                    else
+                    {
+                        run = &runs[runCount];
+                    }
+
+                    run->length = 1U;
+                    run->red    = red;
+                    run->green  = green;
+                    run->blue   = blue;
+
+                    ++runCount;
+                }
+
+                pixel += offset;
+            }
+        }
+    }
+
+    return runCount;
+}
+
+void GifFrameCache::decode(Frame* frame, YAGfxBitmap& bitmap)
+{
+    const Run* run       = getRuns(frame);
+    const Run* runEnd    = run + frame->runCount;
+    uint8_t    remaining = (runEnd != run) ? run->length : 0U;
+    uint16_t   width     = bitmap.getWidth();
+    uint16_t   height    = bitmap.getHeight();
+    int16_t    y;
+
+    for (y = 0; (y < static_cast<int16_t>(height)) && (runEnd != run); ++y)
+    {
+        uint16_t offset = 0U;
+        Color*   pixel  = bitmap.getFrameBufferXAddr(0, y, width, offset);
+
+        if (nullptr != pixel)
+        {
+            uint16_t x;
+
+            for (x = 0U; (x < width) && (runEnd != run); ++x)
+            {
+                *pixel = Color(run->red, run->green, run->blue);
+                pixel += offset;
+
+                --remaining;
+
+                if (0U == remaining)
+                {
+                    ++run;
+
+                    if (runEnd != run)
+                    {
+                        remaining = run->length;
+                    }
+                }
+            }
+        }
+    }
+
+    bitmap.markAllDirty();
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
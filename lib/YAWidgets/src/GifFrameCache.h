@@ -0,0 +1,290 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   GifFrameCache.h
+ * @brief  Cache for decoded GIF animation frames
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup GFX
+ *
+ * @{
+ */
+
+#ifndef GIF_FRAME_CACHE_H
+#define GIF_FRAME_CACHE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_GIF_IMG_PLAYER_FRAME_CACHE_SIZE
+/** Max. memory in bytes, which a single GIF animation may use to cache its frames. 0 disables the cache. */
+#define CONFIG_GIF_IMG_PLAYER_FRAME_CACHE_SIZE 32768U
+#endif /* CONFIG_GIF_IMG_PLAYER_FRAME_CACHE_SIZE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <YAGfxBitmap.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Caches the completely composed scenes of a GIF animation loop in PSRAM.
+ * Every scene is stored run-length encoded together with its delay, so a
+ * looping animation can be replayed without LZW decoding and disposal.
+ *
+ * The cache is filled during one complete animation loop. If the scenes
+ * exceed the memory budget or there is no PSRAM, recording is given up and
+ * the animation keeps being decoded from the file.
+ */
+class GifFrameCache
+{
+public:
+
+    /**
+     * Construct an empty frame cache.
+     *
+     * @param[in] budget    Max. memory in bytes, used for the frames.
+     */
+    GifFrameCache(size_t budget = CONFIG_GIF_IMG_PLAYER_FRAME_CACHE_SIZE) :
+        m_budget(budget),
+        m_size(0U),
+        m_state(STATE_IDLE),
+        m_head(nullptr),
+        m_tail(nullptr),
+        m_current(nullptr)
+    {
+    }
+
+    /**
+     * Construct a frame cache by copying another one.
+     * Only the budget is taken over, the frames will be recorded again.
+     *
+     * @param[in] cache Frame cache, which to copy.
+     */
+    GifFrameCache(const GifFrameCache& cache) :
+        m_budget(cache.m_budget),
+        m_size(0U),
+        m_state(STATE_IDLE),
+        m_head(nullptr),
+        m_tail(nullptr),
+        m_current(nullptr)
+    {
+    }
+
+    /**
+     * Destroy the frame cache.
+     */
+    ~GifFrameCache()
+    {
+        clear();
+    }
+
+    /**
+     * Assign a frame cache.
+     * Only the budget is taken over, the frames will be recorded again.
+     *
+     * @param[in] cache Frame cache, which to assign.
+     *
+     * @return Frame cache
+     */
+    GifFrameCache& operator=(const GifFrameCache& cache)
+    {
+        if (this != &cache)
+        {
+            clear();
+
+            m_budget = cache.m_budget;
+        }
+
+        return *this;
+    }
+
+    /**
+     * Start recording the scenes of an animation loop.
+     * It has no effect if the cache is already recording, complete or
+     * disabled.
+     */
+    void startRecording();
+
+    /**
+     * Is the cache recording scenes?
+     *
+     * @return If recording, it will return true otherwise false.
+     */
+    bool isRecording() const
+    {
+        return STATE_RECORDING == m_state;
+    }
+
+    /**
+     * Add the current scene to the cache.
+     * If the memory budget is exceeded, all frames are released and the
+     * cache is disabled until it is cleared.
+     *
+     * @param[in] bitmap    Bitmap with the completely composed scene.
+     * @param[in] delay     Delay in ms until the next scene.
+     */
+    void addFrame(const YAGfxBitmap& bitmap, uint32_t delay);
+
+    /**
+     * Finish recording, which means one complete animation loop was recorded.
+     */
+    void finishRecording();
+
+    /**
+     * Contains the cache a complete animation loop?
+     *
+     * @return If complete, it will return true otherwise false.
+     */
+    bool isComplete() const
+    {
+        return STATE_COMPLETE == m_state;
+    }
+
+    /**
+     * Decode the next scene into the given bitmap.
+     * After the last scene, it returns false once and starts again with the
+     * first scene on the next call.
+     *
+     * @param[out] bitmap   Bitmap, which to overwrite with the scene. Its size must be the recorded one.
+     * @param[out] delay    Delay in ms until the next scene.
+     *
+     * @return If a scene is available, it will return true otherwise false.
+     */
+    bool getNextFrame(YAGfxBitmap& bitmap, uint32_t& delay);
+
+    /**
+     * Release all frames and enable the cache again.
+     */
+    void clear();
+
+    /**
+     * Get the used memory in bytes.
+     *
+     * @return Used memory in bytes
+     */
+    size_t getSize() const
+    {
+        return m_size;
+    }
+
+private:
+
+    /**
+     * The cache states.
+     */
+    enum State
+    {
+        STATE_IDLE = 0,  /**< Nothing recorded yet. */
+        STATE_RECORDING, /**< Recording the scenes of one animation loop. */
+        STATE_COMPLETE,  /**< One complete animation loop is available. */
+        STATE_DISABLED   /**< Recording failed, caching is not possible. */
+    };
+
+    /**
+     * A run of pixels with the same color.
+     */
+    typedef struct _Run
+    {
+        uint8_t length; /**< Number of pixels [1; 255]. */
+        uint8_t red;    /**< Red */
+        uint8_t green;  /**< Green */
+        uint8_t blue;   /**< Blue */
+
+    } __attribute__((packed)) Run;
+
+    /**
+     * A cached scene. The runs follow directly after it in memory.
+     */
+    typedef struct _Frame
+    {
+        struct _Frame* next;     /**< Next scene. */
+        uint32_t       delay;    /**< Delay in ms until the next scene. */
+        size_t         runCount; /**< Number of runs. */
+
+    } Frame;
+
+    size_t m_budget;  /**< Max. memory in bytes, used for the frames. */
+    size_t m_size;    /**< Used memory in bytes. */
+    State  m_state;   /**< Current state. */
+    Frame* m_head;    /**< First scene. */
+    Frame* m_tail;    /**< Last scene. */
+    Frame* m_current; /**< Next scene to replay. */
+
+    /**
+     * Release all frames.
+     */
+    void releaseFrames();
+
+    /**
+     * Encode the scene of the bitmap into runs.
+     *
+     * @param[in]  bitmap   Bitmap with the scene.
+     * @param[out] runs     Runs, which to fill. If nullptr, the runs are only counted.
+     *
+     * @return Number of runs
+     */
+    static size_t encode(const YAGfxBitmap& bitmap, Run* runs);
+
+    /**
+     * Decode a scene into the bitmap.
+     *
+     * @param[in]  frame    Scene, which to decode.
+     * @param[out] bitmap   Bitmap, which to overwrite.
+     */
+    static void decode(Frame* frame, YAGfxBitmap& bitmap);
+
+    /**
+     * Get the runs of a scene.
+     *
+     * @param[in] frame Scene
+     *
+     * @return Runs
+     */
+    static Run* getRuns(Frame* frame)
+    {
+        return reinterpret_cast<Run*>(frame + 1);
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GIF_FRAME_CACHE_H */
+
+/** @} */
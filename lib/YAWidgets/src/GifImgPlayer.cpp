@@ -269,7 +269,8 @@ GifImgPlayer::GifImgPlayer() :
     m_delay(0U),
     m_timer(),
     m_isAnimation(false),
-    m_isFinished(false)
+    m_isFinished(false),
+    m_frameCache()
 {
 }
 
@@ -298,7 +299,8 @@ GifImgPlayer::GifImgPlayer(const GifImgPlayer& player) :
     m_delay(player.m_delay),
     m_timer(),
     m_isAnimation(player.m_isAnimation),
-    m_isFinished(player.m_isFinished)
+    m_isFinished(player.m_isFinished),
+    m_frameCache(player.m_frameCache)
 {
     /* Copy global color table. */
     if (false == copyGlobalColorTable(player.m_globalColorTable, player.m_globalColorTableLength))
@@ -346,6 +348,7 @@ GifImgPlayer& GifImgPlayer::operator=(const GifImgPlayer& player)
         m_delay                 = player.m_delay;
         m_isAnimation           = player.m_isAnimation;
         m_isFinished            = player.m_isFinished;
+        m_frameCache            = player.m_frameCache;
 
         /* Copy global color table. */
         if (false == copyGlobalColorTable(player.m_globalColorTable, player.m_globalColorTableLength))
@@ -456,6 +459,7 @@ GifImgPlayer::Ret GifImgPlayer::open(FS& fs, const String& fileName, IGifLoader&
                 m_isAnimation           = false;
                 m_isFinished            = false;
                 m_timer.stop();
+                m_frameCache.clear();
 
                 /* Global color table available? */
                 if (0U != logicalScreenDescriptor.packedField.globalColorTableFlag)
@@ -527,6 +531,11 @@ bool GifImgPlayer::play(YAGfx& gfx, int16_t x, int16_t y)
         /* Redraw last scene. */
         gfx.drawBitmap(x, y, m_bitmap);
     }
+    /* Replay the animation without decoding? */
+    else if (true == m_frameCache.isComplete())
+    {
+        playFromCache(gfx, x, y);
+    }
     else
     {
         bool    isImageShown = false;
@@ -560,6 +569,8 @@ bool GifImgPlayer::play(YAGfx& gfx, int16_t x, int16_t y)
                     {
                         m_timer.start(m_delay);
                         isImageShown = true;
+
+                        m_frameCache.addFrame(m_bitmap, m_delay);
                     }
                 }
             }
@@ -578,26 +589,23 @@ bool GifImgPlayer::play(YAGfx& gfx, int16_t x, int16_t y)
                 /* Animation running? */
                 if (true == m_isAnimation)
                 {
-                    /* Is animation limited to a specific number of repeats? */
-                    if (0U < m_loopCount)
-                    {
-                        --m_loopCount;
+                    countLoop();
 
-                        /* Animation finished? */
-                        if (0U == m_loopCount)
+                    if (false == m_isFinished)
+                    {
+                        /* The first loop starts from an empty canvas, but every
+                         * further loop starts with the last scene. Therefore the
+                         * second loop is recorded, which repeats from now on.
+                         */
+                        if (true == m_frameCache.isRecording())
                         {
-                            m_isFinished = true;
-                            m_timer.stop();
+                            m_frameCache.finishRecording();
+                        }
+                        else
+                        {
+                            m_frameCache.startRecording();
                         }
-                    }
-                    /* Infinite animation. */
-                    else
-                    {
-                        ;
-                    }
 
-                    if (false == m_isFinished)
-                    {
                         /* Restart from begin. */
                         if (false == m_gifLoader->seek(m_restartFilePos, SeekSet))
                         {
@@ -647,6 +655,51 @@ bool GifImgPlayer::play(YAGfx& gfx, int16_t x, int16_t y)
  * Private Methods
  *****************************************************************************/
 
+void GifImgPlayer::playFromCache(YAGfx& gfx, int16_t x, int16_t y)
+{
+    uint32_t delay = 0U;
+
+    /* Next scene available? */
+    if (true == m_frameCache.getNextFrame(m_bitmap, delay))
+    {
+        gfx.drawBitmap(x, y, m_bitmap);
+        m_timer.start(delay);
+    }
+    /* End of the animation loop. */
+    else
+    {
+        GIF_IMG_PLAYER_LOG_DEBUG("Trailer (cached)\n");
+
+        m_isTrailerFound = true;
+
+        /* Redraw last scene. */
+        gfx.drawBitmap(x, y, m_bitmap);
+
+        countLoop();
+    }
+}
+
+void GifImgPlayer::countLoop()
+{
+    /* Is animation limited to a specific number of repeats? */
+    if (0U < m_loopCount)
+    {
+        --m_loopCount;
+
+        /* Animation finished? */
+        if (0U == m_loopCount)
+        {
+            m_isFinished = true;
+            m_timer.stop();
+        }
+    }
+    /* Infinite animation. */
+    else
+    {
+        ;
+    }
+}
+
 bool GifImgPlayer::copyGlobalColorTable(const PaletteColor* colorTable, size_t colorTableLength)
 {
     bool                                      isSuccessful = true;
@@ -751,6 +804,7 @@ void GifImgPlayer::cleanup()
     }
 
     m_bitmap.release();
+    m_frameCache.clear();
 
     if (nullptr != m_imageDataBlock)
     {
@@ -955,16 +1009,8 @@ bool GifImgPlayer::parseImageDescriptor()
             }
             else
             {
-                LzwDecoder                   lzwDecoder;
-                LzwDecoder::ReadFromInStream readFromCodeStreamFunc =
-                    [this](uint8_t& data) -> bool {
-                    return this->readFromCodeStream(data);
-                };
-                LzwDecoder::WriteToOutStream writeToIndexStreamFunc =
-                    [this](uint8_t data) -> bool {
-                    return this->writeToIndexStream(data);
-                };
-                uint8_t blockTerminator = 0U;
+                LzwDecoder lzwDecoder;
+                uint8_t    blockTerminator = 0U;
 
                 /* Reset data block before start decoding the next block. */
                 m_imageDataBlockIdx     = 0U;
@@ -980,7 +1026,7 @@ bool GifImgPlayer::parseImageDescriptor()
                 }
                 else
                 {
-                    if (false == lzwDecoder.decode(readFromCodeStreamFunc, writeToIndexStreamFunc))
+                    if (false == decodeImageData(lzwDecoder))
                     {
                         isSuccessful = false;
                     }
@@ -1316,67 +1362,104 @@ size_t GifImgPlayer::loadImageDataBlock(uint8_t* block, size_t size)
     return blockSize;
 }
 
-bool GifImgPlayer::readFromCodeStream(uint8_t& data)
+bool GifImgPlayer::decodeImageData(LzwDecoder& lzwDecoder)
 {
-    bool isSuccessful = true;
+    bool               isSuccessful = true;
+    LzwDecoder::Status status       = LzwDecoder::STATUS_NEED_INPUT;
+    uint8_t            indexStream[INDEX_STREAM_CHUNK_SIZE];
 
-    if ((0U == m_imageDataBlockLength) ||
-        (m_imageDataBlockLength <= m_imageDataBlockIdx))
+    /* The image data sub-blocks are decoded as a whole into chunks of
+     * the index stream.
+     */
+    while ((LzwDecoder::STATUS_END != status) && (true == isSuccessful))
     {
-        m_imageDataBlockLength = loadImageDataBlock(m_imageDataBlock, IMAGE_DATA_BLOCK_SIZE);
+        size_t inputUsed  = 0U;
+        size_t outputUsed = 0U;
 
-        if (0U == m_imageDataBlockLength)
+        /* All data of the current sub-block consumed? */
+        if ((LzwDecoder::STATUS_NEED_INPUT == status) &&
+            (m_imageDataBlockLength <= m_imageDataBlockIdx))
         {
-            isSuccessful = false;
+            m_imageDataBlockLength = loadImageDataBlock(m_imageDataBlock, IMAGE_DATA_BLOCK_SIZE);
+            m_imageDataBlockIdx    = 0U;
+
+            if (0U == m_imageDataBlockLength)
+            {
+                isSuccessful = false;
+            }
         }
-        else
+
+        if (true == isSuccessful)
         {
-            m_imageDataBlockIdx = 0U;
+            status               = lzwDecoder.decode(&m_imageDataBlock[m_imageDataBlockIdx],
+                                                     m_imageDataBlockLength - m_imageDataBlockIdx,
+                                                     inputUsed,
+                                                     indexStream,
+                                                     sizeof(indexStream),
+                                                     outputUsed);
+            m_imageDataBlockIdx += inputUsed;
+
+            if (LzwDecoder::STATUS_ERROR == status)
+            {
+                isSuccessful = false;
+            }
+            else
+            {
+                isSuccessful = writeToIndexStream(indexStream, outputUsed);
+            }
         }
     }
 
-    if (m_imageDataBlockLength > m_imageDataBlockIdx)
-    {
-        data = m_imageDataBlock[m_imageDataBlockIdx];
-        ++m_imageDataBlockIdx;
-    }
-
     return isSuccessful;
 }
 
-bool GifImgPlayer::writeToIndexStream(uint8_t data)
+bool GifImgPlayer::writeToIndexStream(const uint8_t* indices, size_t count)
 {
-    bool          isSuccessful     = false;
-    PaletteColor* colorTable       = (nullptr != m_localColorTable) ? m_localColorTable : m_globalColorTable;
-    size_t        colorTableLength = (nullptr != m_localColorTable) ? m_localColorTableLength : m_globalColorTableLength;
-
-    /* Color table must be available and
-     * the color index must be part of it.
-     */
-    if ((nullptr != colorTable) &&
-        (colorTableLength > data))
+    bool                isSuccessful     = true;
+    const PaletteColor* colorTable       = (nullptr != m_localColorTable) ? m_localColorTable : m_globalColorTable;
+    size_t              colorTableLength = (nullptr != m_localColorTable) ? m_localColorTableLength : m_globalColorTableLength;
+    int16_t             width            = m_canvas.getWidth();
+    size_t              idx              = 0U;
+
+    /* Color table must be available. */
+    if (nullptr == colorTable)
     {
-        /* If transparency is not enabled or
-         * it is enabled and the color index is not transparent,
-         * the pixel will be drawn.
-         */
-        if ((false == m_isTransparencyEnabled) ||
-            ((true == m_isTransparencyEnabled) && (m_transparentColorIndex != data)))
-        {
-            PaletteColor* paletteColor = &colorTable[data];
-            Color         color(paletteColor->red, paletteColor->green, paletteColor->blue);
+        isSuccessful = false;
+    }
 
-            m_canvas.drawPixel(m_posX, m_posY, color);
-        }
+    while ((count > idx) && (true == isSuccessful))
+    {
+        uint8_t data = indices[idx];
 
-        ++m_posX;
-        if (m_canvas.getWidth() <= m_posX)
+        /* The color index must be part of the color table. */
+        if (colorTableLength <= data)
         {
-            m_posX = 0;
-            ++m_posY;
+            isSuccessful = false;
         }
+        else
+        {
+            /* If transparency is not enabled or
+             * it is enabled and the color index is not transparent,
+             * the pixel will be drawn.
+             */
+            if ((false == m_isTransparencyEnabled) ||
+                (m_transparentColorIndex != data))
+            {
+                const PaletteColor* paletteColor = &colorTable[data];
+                Color               color(paletteColor->red, paletteColor->green, paletteColor->blue);
+
+                m_canvas.drawPixel(m_posX, m_posY, color);
+            }
 
-        isSuccessful = true;
+            ++m_posX;
+            if (width <= m_posX)
+            {
+                m_posX = 0;
+                ++m_posY;
+            }
+
+            ++idx;
+        }
     }
 
     return isSuccessful;
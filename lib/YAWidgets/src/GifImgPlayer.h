@@ -50,6 +50,8 @@
 #include <YAGfxBitmap.h>
 #include <SimpleTimer.hpp>
 #include <IGifLoader.h>
+#include <LzwDecoder.h>
+#include <GifFrameCache.h>
 #include <TypedAllocator.hpp>
 #include <PsAllocator.hpp>
 
@@ -171,6 +173,29 @@ public:
         return m_isTrailerFound;
     }
 
+    /**
+     * Is playing finished?
+     * A single image is finished after it was shown once, an animation after
+     * its last loop. Infinite animations will never finish.
+     *
+     * @return If finished, it will return true otherwise false.
+     */
+    bool isFinished() const
+    {
+        return m_isFinished;
+    }
+
+    /**
+     * Are the scenes replayed from the frame cache instead of decoding the
+     * GIF data stream?
+     *
+     * @return If replayed from the frame cache, it will return true otherwise false.
+     */
+    bool isPlayingFromCache() const
+    {
+        return m_frameCache.isComplete();
+    }
+
     /**
      * Get image width.
      * Note, the GIF must be opened, otherwise it will return 0.
@@ -200,6 +225,11 @@ private:
      */
     static const size_t IMAGE_DATA_BLOCK_SIZE = 256U;
 
+    /**
+     * Number of indices, which are decoded at once into the index stream.
+     */
+    static const size_t INDEX_STREAM_CHUNK_SIZE = 64U;
+
     /**
      * A palette color used for the global color table.
      */
@@ -261,6 +291,8 @@ private:
     bool        m_isAnimation;    /**< GIF contais several scenes which to animate. */
     bool        m_isFinished;     /**< Scenes are finished. */
 
+    GifFrameCache m_frameCache; /**< Cache for the scenes of a looping animation. */
+
     /**
      * Copy global color table from another one.
      *
@@ -314,6 +346,22 @@ private:
      */
     size_t calcColorTableSize(uint8_t sizeExp) const;
 
+    /**
+     * Show the next scene of the animation out of the frame cache.
+     * At the end of the cached scenes it behaves like the trailer is found.
+     *
+     * @param[in] gfx   Graphic functions of the parent canvas.
+     * @param[in] x     x-coordinate of the parent canvas.
+     * @param[in] y     y-coordinate of the parent canvas.
+     */
+    void playFromCache(YAGfx& gfx, int16_t x, int16_t y);
+
+    /**
+     * Count a completed animation loop and finish the animation if the
+     * number of repeats is reached.
+     */
+    void countLoop();
+
     /**
      * Parse extemsopm.
      *
@@ -374,23 +422,24 @@ private:
     size_t loadImageDataBlock(uint8_t* block, size_t size);
 
     /**
-     * Callback used by LZW decoder to read data from the code stream.
+     * Decode the image data sub-blocks with the LZW decoder and write the
+     * resulting index stream to the canvas.
      *
-     * @param[out] data Code stream byte
+     * @param[in] lzwDecoder    Initialized LZW decoder.
      *
-     * @return If successful read, it will return true otherwise false.
+     * @return If successful decoded, it will return true otherwise false.
      */
-    bool readFromCodeStream(uint8_t& data);
+    bool decodeImageData(LzwDecoder& lzwDecoder);
 
     /**
-     * Callback used by LZW decoder to write data to the index stream.
-     * It will update the canvas accordingly.
+     * Write a chunk of the index stream to the canvas.
      *
-     * @param[in] data  Index for color table
+     * @param[in] indices   Indices for the color table.
+     * @param[in] count     Number of indices.
      *
      * @return If successful written, it will return true otherwise false.
      */
-    bool writeToIndexStream(uint8_t data);
+    bool writeToIndexStream(const uint8_t* indices, size_t count);
 };
 
 /******************************************************************************
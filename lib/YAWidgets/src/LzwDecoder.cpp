@@ -183,6 +183,7 @@ bool LzwDecoder::init(uint8_t lzwMinCodeWidth)
     m_endCode         = m_clearCode + 1U;
     m_stackPtr        = m_stack;
     m_bitsInBuffer    = 0U;
+    m_codeBuffer      = 0U;
     clear();
 
     if (false == isSuccessful)
@@ -195,49 +196,133 @@ bool LzwDecoder::init(uint8_t lzwMinCodeWidth)
 
 bool LzwDecoder::decode(const ReadFromInStream& readFromInStreamFunc, const WriteToOutStream& writeToOutStreamFunc)
 {
-    bool     isSuccessful = true;
-    bool     isEnd        = false;
-    uint32_t code;
+    bool    isSuccessful = true;
+    Status  status       = STATUS_NEED_INPUT;
+    uint8_t input        = 0U;
+    size_t  inputSize    = 0U;
+    uint8_t output[CHUNK_SIZE];
+
+    /* The input is provided byte-wise to not read beyond the end code. */
+    while ((STATUS_END != status) && (true == isSuccessful))
+    {
+        size_t inputUsed  = 0U;
+        size_t outputUsed = 0U;
+        size_t idx        = 0U;
+
+        status     = decode(&input, inputSize, inputUsed, output, sizeof(output), outputUsed);
+        inputSize -= inputUsed;
+
+        while ((outputUsed > idx) && (true == isSuccessful))
+        {
+            isSuccessful = writeToOutStreamFunc(output[idx]);
+            ++idx;
+        }
+
+        if (false == isSuccessful)
+        {
+            ;
+        }
+        else if (STATUS_ERROR == status)
+        {
+            isSuccessful = false;
+        }
+        else if (STATUS_NEED_INPUT == status)
+        {
+            if (false == readFromInStreamFunc(input))
+            {
+                /* No more data is available, abort now. */
+                isSuccessful = false;
+            }
+            else
+            {
+                inputSize = 1U;
+            }
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    return isSuccessful;
+}
+
+LzwDecoder::Status LzwDecoder::decode(const uint8_t* input, size_t inputSize, size_t& inputUsed, uint8_t* output, size_t outputSize, size_t& outputUsed)
+{
+    Status status = STATUS_NEED_INPUT;
+    bool   isDone = false;
+
+    inputUsed     = 0U;
+    outputUsed    = 0U;
 
     if ((nullptr == m_codes) ||
-        (nullptr == m_stack))
+        (nullptr == m_stack) ||
+        ((nullptr == input) && (0U < inputSize)) ||
+        (nullptr == output))
     {
-        isSuccessful = false;
+        status = STATUS_ERROR;
+        isDone = true;
     }
 
-    while ((false == isEnd) && (true == isSuccessful))
+    while (false == isDone)
     {
-        /* Get code */
-        if (false == getCode(code, readFromInStreamFunc))
+        /* Any pending string, which didn't fit into the output buffer? */
+        flushStack(output, outputSize, outputUsed);
+
+        if (m_stackPtr > m_stack)
         {
-            isSuccessful = false;
+            status = STATUS_OUTPUT_FULL;
+            isDone = true;
         }
         else
         {
-            /* Finished? */
-            if (code == m_endCode)
+            /* Refill the code buffer with as much bytes as fit into 32 bit. */
+            while ((24U >= m_bitsInBuffer) && (inputSize > inputUsed))
             {
-                isEnd = true;
+                m_codeBuffer   |= static_cast<uint32_t>(input[inputUsed]) << m_bitsInBuffer;
+                m_bitsInBuffer += 8U;
+                ++inputUsed;
             }
-            /* Decoder initialization request? */
-            else if (code == m_clearCode)
+
+            if (m_codeWidth > m_bitsInBuffer)
             {
-                clear();
-            }
-            /* Continue decompression. */
-            else if (false == decompress(code, writeToOutStreamFunc))
-            {
-                isSuccessful = false;
+                status = STATUS_NEED_INPUT;
+                isDone = true;
             }
             else
             {
-                /* Go ahead. */
-                ;
+                uint32_t code    = m_codeBuffer & ((1U << m_codeWidth) - 1U);
+
+                m_codeBuffer   >>= m_codeWidth;
+                m_bitsInBuffer  -= m_codeWidth;
+
+                /* Finished? */
+                if (code == m_endCode)
+                {
+                    status = STATUS_END;
+                    isDone = true;
+                }
+                /* Decoder initialization request? */
+                else if (code == m_clearCode)
+                {
+                    clear();
+                }
+                /* Continue decompression. */
+                else if (false == decompress(code, output, outputSize, outputUsed))
+                {
+                    status = STATUS_ERROR;
+                    isDone = true;
+                }
+                else
+                {
+                    /* Go ahead. */
+                    ;
+                }
             }
         }
     }
 
-    return isSuccessful;
+    return status;
 }
 
 void LzwDecoder::deInit()
@@ -334,146 +419,130 @@ void LzwDecoder::clear()
     m_isInitialState = true;
 }
 
-bool LzwDecoder::getCode(uint32_t& code, const ReadFromInStream& readFromInStreamFunc)
+void LzwDecoder::flushStack(uint8_t* output, size_t outputSize, size_t& outputUsed)
 {
-    bool     isSuccessful   = true;
-    uint32_t codeBitsNeeded = m_codeWidth;
-
-    code                    = 0U;
-
-    /* Run as long as code bits are still needed. */
-    while ((0U < codeBitsNeeded) && (true == isSuccessful))
+    while ((m_stackPtr > m_stack) && (outputSize > outputUsed))
     {
-        /* No bits in the buffer anymore? */
-        if (0U == m_bitsInBuffer)
-        {
-            uint8_t data = 0U;
-
-            /* Read data from code stream. */
-            if (false == readFromInStreamFunc(data))
-            {
-                /* No more data is available, abort now. */
-                isSuccessful = false;
-            }
-            else
-            {
-                m_codeBuffer   = data;
-                m_bitsInBuffer = 8U;
-            }
-        }
-
-        if (true == isSuccessful)
-        {
-            uint32_t bitsAvailable   = (m_bitsInBuffer < codeBitsNeeded) ? m_bitsInBuffer : codeBitsNeeded;
-            uint32_t mask            = (1U << bitsAvailable) - 1U; /* Mask for n bits. */
-
-            code                    |= (m_codeBuffer & mask) << (m_codeWidth - codeBitsNeeded);
-
-            /* Remove bits from code buffer. */
-            m_codeBuffer           >>= bitsAvailable;
-            m_bitsInBuffer          -= bitsAvailable;
-
-            /* Now less bits are needed. */
-            codeBitsNeeded          -= bitsAvailable;
-        }
+        --m_stackPtr;
+        output[outputUsed] = *m_stackPtr;
+        ++outputUsed;
     }
-
-    return isSuccessful;
 }
 
-bool LzwDecoder::decompress(uint32_t& code, const WriteToOutStream& writeToOutStreamFunc)
+bool LzwDecoder::decompress(uint32_t code, uint8_t* output, size_t outputSize, size_t& outputUsed)
 {
     bool isSuccessful = true;
 
     if (true == m_isInitialState)
     {
-        uint8_t data = code & 0xFFU;
-
-        m_firstByte  = code;
-        m_prevCode   = code;
+        m_firstByte = code;
+        m_prevCode  = code;
 
         /* Is code invalid? */
         if (code > m_endCode)
         {
             isSuccessful = false;
         }
-        else if (false == writeToOutStreamFunc(data))
-        {
-            isSuccessful = false;
-        }
         else
         {
+            if (outputSize > outputUsed)
+            {
+                output[outputUsed] = code & 0xFFU;
+                ++outputUsed;
+            }
+            else
+            {
+                *m_stackPtr = code & 0xFFU;
+                ++m_stackPtr;
+            }
+
             m_isInitialState = false;
         }
     }
+    /* Invalid data? */
+    else if (code > m_nextCode)
+    {
+        isSuccessful = false;
+    }
     else
     {
-        m_inCode = code;
+        bool     isKwKwK = (code == m_nextCode);
+        uint32_t length  = 0U;
+
+        m_inCode         = code;
 
         /* Handle the KwKwK case. */
-        if (code >= m_nextCode)
+        if (true == isKwKwK)
+        {
+            code = m_prevCode;
+        }
+
+        length = getLength(code) + ((true == isKwKwK) ? 1U : 0U);
+
+        /* Does the string fit into the output buffer? Then it is unrolled
+         * from its end directly into the output buffer.
+         */
+        if ((outputSize - outputUsed) >= length)
         {
-            /* Invalid data? */
-            if (code != m_nextCode)
+            uint8_t* dst = &output[outputUsed + length];
+
+            if (true == isKwKwK)
             {
-                isSuccessful = false;
+                --dst;
+                *dst = m_firstByte & 0xFFU;
             }
-            else
+
+            /* Heads are packed to left of tails in codes. */
+            while (code >= m_clearCode)
+            {
+                --dst;
+                *dst = m_codes[code] & 0xFFU;
+                code = (m_codes[code] >> 8U) & 0x0FFFU;
+            }
+
+            --dst;
+            *dst        = code & 0xFFU;
+            outputUsed += length;
+        }
+        /* Otherwise "unwind" code's string to stack. */
+        else
+        {
+            if (true == isKwKwK)
             {
                 *m_stackPtr = m_firstByte & 0xFFU;
                 ++m_stackPtr;
-                code = m_prevCode;
             }
-        }
 
-        if (true == isSuccessful)
-        {
-            /* "Unwind" code's string to stack. */
+            /* Heads are packed to left of tails in codes. */
             while (code >= m_clearCode)
             {
-                /* Heads are packed to left of tails in codes. */
-
-                /* Tails */
                 *m_stackPtr = m_codes[code] & 0xFFU;
                 ++m_stackPtr;
-
-                /* Heads*/
-                code = (m_codes[code] >> 8U) & 0x0FFFU;
+                code        = (m_codes[code] >> 8U) & 0x0FFFU;
             }
 
-            m_firstByte = code;
             *m_stackPtr = code & 0xFFU;
             ++m_stackPtr;
 
-            do
-            {
-                --m_stackPtr;
-
-                if (false == writeToOutStreamFunc(*m_stackPtr))
-                {
-                    isSuccessful = false;
-                }
-            }
-            while ((m_stackPtr > m_stack) && (true == isSuccessful));
+            flushStack(output, outputSize, outputUsed);
         }
 
-        if (true == isSuccessful)
+        m_firstByte = code;
+
+        if (m_nextCode < CODE_LIMIT)
         {
-            if (m_nextCode < CODE_LIMIT)
-            {
-                /* Heads are packed to left of tails in codes. */
-                m_codes[m_nextCode] = (m_prevCode << 8U) | code;
-                ++m_nextCode;
+            /* The new string is the previous one, extended by one byte. */
+            m_codes[m_nextCode] = ((getLength(m_prevCode) + 1U) << CODE_LENGTH_SHIFT) | (m_prevCode << 8U) | code;
+            ++m_nextCode;
 
-                if ((m_nextCode > m_maxCode) && (m_nextCode < CODE_LIMIT))
-                {
-                    m_maxCode = m_maxCode * 2U + 1U;
-                    ++m_codeWidth;
-                }
+            if ((m_nextCode > m_maxCode) && (m_nextCode < CODE_LIMIT))
+            {
+                m_maxCode = m_maxCode * 2U + 1U;
+                ++m_codeWidth;
             }
-
-            m_prevCode = m_inCode;
         }
+
+        m_prevCode = m_inCode;
     }
 
     return isSuccessful;
@@ -73,6 +73,17 @@ public:
     /** Prototype for writing decoded data to output stream. */
     typedef std::function<bool(uint8_t& data)> WriteToOutStream;
 
+    /**
+     * Status of the block oriented decoding.
+     */
+    enum Status
+    {
+        STATUS_NEED_INPUT = 0, /**< All input is consumed, more is required to continue. */
+        STATUS_OUTPUT_FULL,    /**< The output buffer is full, call again with a new one. */
+        STATUS_END,            /**< The end code was found, decoding is finished. */
+        STATUS_ERROR           /**< Invalid code stream or decoder not initialized. */
+    };
+
     /**
      * Construct a LZW decoder object.
      */
@@ -124,6 +135,26 @@ public:
      */
     bool decode(const ReadFromInStream& readFromInStreamFunc, const WriteToOutStream& writeToOutStreamFunc);
 
+    /**
+     * Decodes a block of the input stream (code stream) into a block of the
+     * output stream. It continues where the last call stopped, so the input
+     * can be provided e.g. by GIF data sub-blocks and the output in chunks.
+     *
+     * Decoding stops if the input is consumed, the output buffer is full or
+     * the end code is found. Consumed input bytes are kept in the decoder,
+     * so the caller shall provide only the not consumed remainder again.
+     *
+     * @param[in]  input        Input stream data.
+     * @param[in]  inputSize    Number of input bytes.
+     * @param[out] inputUsed    Number of consumed input bytes.
+     * @param[out] output       Output buffer for the decoded data.
+     * @param[in]  outputSize   Output buffer size in bytes.
+     * @param[out] outputUsed   Number of decoded bytes written to the output buffer.
+     *
+     * @return Status, see Status for details.
+     */
+    Status decode(const uint8_t* input, size_t inputSize, size_t& inputUsed, uint8_t* output, size_t outputSize, size_t& outputUsed);
+
     /**
      * Deinitialize the LZW decoder.
      * It will release internal allocated memory.
@@ -154,6 +185,18 @@ private:
      */
     static const size_t STACK_SIZE = 4096U;
 
+    /**
+     * Bit position of the string length in a code table entry.
+     * A code table entry contains the tail byte (bit 0-7), the head code
+     * (bit 8-19) and the length of the whole string (bit 20-31).
+     */
+    static const uint32_t CODE_LENGTH_SHIFT = 20U;
+
+    /**
+     * Output buffer size in bytes, used by the callback based decoding.
+     */
+    static const size_t CHUNK_SIZE = 64U;
+
     CodeAllocator       m_codeAllocator;   /**< Memory allocator for code.*/
     StackAllocator      m_stackAllocator;  /**< Memory allocator for stack.*/
     bool                m_isInitialState;  /**< Is LZW decoder initialization state or not. */
@@ -164,7 +207,7 @@ private:
     uint32_t            m_maxCode;         /**< Max. code */
     uint32_t            m_codeWidth;       /**< Code width in bits */
     uint32_t            m_bitsInBuffer;    /**< Number of bits in code buffer */
-    uint32_t            m_codeBuffer;      /**< Code buffer used to retrieve a code */
+    uint32_t            m_codeBuffer;      /**< Code buffer used to retrieve a code, refilled byte-wise up to 32 bit */
     uint32_t            m_firstByte;       /**< First byte */
     uint32_t            m_inCode;          /**< In code */
     uint32_t            m_prevCode;        /**< Previous code */
@@ -196,24 +239,40 @@ private:
     void clear();
 
     /**
-     * Get the code.
+     * Get the length of the string, which a code represents.
      *
-     * @param[out] code                 The retrieved code.
-     * @param[in] readFromInStreamFunc  Callback to read from input stream on demand.
+     * @param[in] code  Code
      *
-     * @return If successful, it will return true otherwise false.
+     * @return String length in bytes
+     */
+    uint32_t getLength(uint32_t code) const
+    {
+        return (code < m_clearCode) ? 1U : (m_codes[code] >> CODE_LENGTH_SHIFT);
+    }
+
+    /**
+     * Write as much as possible of the pending string on the stack to the
+     * output buffer.
+     *
+     * @param[out]      output      Output buffer
+     * @param[in]       outputSize  Output buffer size in bytes.
+     * @param[in,out]   outputUsed  Number of bytes already written to the output buffer.
      */
-    bool getCode(uint32_t& code, const ReadFromInStream& readFromInStreamFunc);
+    void flushStack(uint8_t* output, size_t outputSize, size_t& outputUsed);
 
     /**
-     * Decompress code to output stream.
+     * Decompress code to the output buffer.
+     * If the string doesn't fit into the output buffer, it is kept on the
+     * stack and written by the next flushStack() calls.
      *
-     * @param[in] code                  The retrieved code.
-     * @param[in] writeToOutStreamFunc  Callback to write to output stream on demand.
+     * @param[in]       code        The retrieved code.
+     * @param[out]      output      Output buffer
+     * @param[in]       outputSize  Output buffer size in bytes.
+     * @param[in,out]   outputUsed  Number of bytes already written to the output buffer.
      *
      * @return If successful, it will return true otherwise false.
      */
-    bool decompress(uint32_t& code, const WriteToOutStream& writeToOutStreamFunc);
+    bool decompress(uint32_t code, uint8_t* output, size_t outputSize, size_t& outputUsed);
 };
 
 /******************************************************************************
@@ -35,6 +35,9 @@
  *****************************************************************************/
 #include "TWAbstractSyntaxTree.h"
 
+#include <algorithm>
+#include <string.h>
+
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
@@ -63,13 +66,22 @@ TWAbstractSyntaxTree& TWAbstractSyntaxTree::operator=(const TWAbstractSyntaxTree
 {
     if (this != &other)
     {
+        TokenList::iterator it;
+
         m_tokenTrash = other.m_tokenTrash;
 
         /* Release first the own tokens. */
         clear();
 
         /* Copy other tokens after the own ones were released! */
+        m_arena  = other.m_arena;
         m_tokens = other.m_tokens;
+
+        /* The copied tokens still refer to the strings of the other AST. */
+        for (it = m_tokens.begin(); it != m_tokens.end(); ++it)
+        {
+            it->m_str = m_arena.data() + (it->m_str - other.m_arena.data());
+        }
     }
 
     return *this;
@@ -84,7 +96,10 @@ TWAbstractSyntaxTree& TWAbstractSyntaxTree::operator=(TWAbstractSyntaxTree&& oth
         /* Release first the own tokens. */
         clear();
 
-        /* Move other tokens after the own ones were released! */
+        /* Move other tokens after the own ones were released!
+         * The token strings stay valid, because the arena memory is moved too.
+         */
+        m_arena  = std::move(other.m_arena);
         m_tokens = std::move(other.m_tokens);
     }
 
@@ -94,14 +109,86 @@ TWAbstractSyntaxTree& TWAbstractSyntaxTree::operator=(TWAbstractSyntaxTree&& oth
 void TWAbstractSyntaxTree::clear()
 {
     m_tokens.clear();
+    m_arena.clear();
+}
+
+void TWAbstractSyntaxTree::swap(TWAbstractSyntaxTree& other)
+{
+    std::swap(m_tokenTrash, other.m_tokenTrash);
+    m_arena.swap(other.m_arena);
+    m_tokens.swap(other.m_tokens);
 }
 
-bool TWAbstractSyntaxTree::createToken(TWToken::Type tokenType, const String& str)
+bool TWAbstractSyntaxTree::createToken(TWToken::Type tokenType, const char* str, size_t length)
 {
-    m_tokens.emplace_back(tokenType, str);
+    size_t offset = m_arena.size();
+
+    reserveArena(offset + length + 1U);
+
+    m_arena.insert(m_arena.end(), str, str + length);
+    m_arena.push_back('\0');
+
+    m_tokens.emplace_back(tokenType, &m_arena[offset], length);
+
     return true;
 }
 
+bool TWAbstractSyntaxTree::appendToLastToken(const char* str, size_t length)
+{
+    bool isSuccessful = false;
+
+    if (false == m_tokens.empty())
+    {
+        const TWToken& lastToken = m_tokens.back();
+
+        /* Only a token string at the end of the arena can be extended. */
+        if ((lastToken.m_str + lastToken.m_length + 1U) == (m_arena.data() + m_arena.size()))
+        {
+            reserveArena(m_arena.size() + length);
+
+            /* Overwrite the termination. */
+            m_arena.pop_back();
+            m_arena.insert(m_arena.end(), str, str + length);
+            m_arena.push_back('\0');
+
+            m_tokens.back().m_length += length;
+
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+bool TWAbstractSyntaxTree::setTokenStr(uint32_t index, const char* str, size_t length)
+{
+    bool isSuccessful = false;
+
+    if (m_tokens.size() > index)
+    {
+        size_t offset = m_tokens[index].m_str - m_arena.data();
+
+        /* Not enough space in place? Append it to the arena. */
+        if (m_tokens[index].m_length < length)
+        {
+            offset = m_arena.size();
+
+            reserveArena(offset + length + 1U);
+            m_arena.resize(offset + length + 1U);
+        }
+
+        memcpy(&m_arena[offset], str, length);
+        m_arena[offset + length] = '\0';
+
+        m_tokens[index].m_str    = &m_arena[offset];
+        m_tokens[index].m_length = length;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
 uint32_t TWAbstractSyntaxTree::length() const
 {
     return m_tokens.size();
@@ -139,6 +226,27 @@ TWToken& TWAbstractSyntaxTree::operator[](uint32_t index)
  * Private Methods
  *****************************************************************************/
 
+void TWAbstractSyntaxTree::reserveArena(size_t size)
+{
+    if (m_arena.capacity() < size)
+    {
+        StringArena         arena;
+        TokenList::iterator it;
+
+        /* Grow at least by the factor 2 to keep the number of relocations low. */
+        arena.reserve(std::max(size, 2U * m_arena.capacity()));
+        arena.assign(m_arena.begin(), m_arena.end());
+
+        /* Relocate the token strings as long as the old arena still exists. */
+        for (it = m_tokens.begin(); it != m_tokens.end(); ++it)
+        {
+            it->m_str = arena.data() + (it->m_str - m_arena.data());
+        }
+
+        m_arena.swap(arena);
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -44,10 +44,10 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include <WString.h>
 #include <TWToken.h>
 #include <vector>
 #include <stdint.h>
+#include <stddef.h>
 
 /******************************************************************************
  * Macros
@@ -58,7 +58,11 @@
  *****************************************************************************/
 
 /**
- * A text widget token.
+ * The abstract syntax tree (AST) of a text widget format string.
+ *
+ * All token strings are stored terminated one after another in a single
+ * string arena. Clearing the AST keeps the memory of the arena and the token
+ * list, which avoids a allocation per token if the AST is setup again.
  */
 class TWAbstractSyntaxTree
 {
@@ -68,7 +72,8 @@ public:
      * Constructs a abstract syntax tree (AST).
      */
     TWAbstractSyntaxTree() :
-        m_tokenTrash(TWToken::TYPE_KEYWORD, ""),
+        m_tokenTrash(TWToken::TYPE_KEYWORD, "", 0U),
+        m_arena(),
         m_tokens()
     {
     }
@@ -80,8 +85,10 @@ public:
      */
     TWAbstractSyntaxTree(const TWAbstractSyntaxTree& other) :
         m_tokenTrash(other.m_tokenTrash),
-        m_tokens(other.m_tokens)
+        m_arena(),
+        m_tokens()
     {
+        *this = other;
     }
 
     /**
@@ -111,19 +118,49 @@ public:
     TWAbstractSyntaxTree& operator=(TWAbstractSyntaxTree&& other) noexcept;
 
     /**
-     * Clear AST.
+     * Clear AST. The allocated memory is kept for reuse.
      */
     void clear();
 
+    /**
+     * Swap the AST with other one. No token string is copied.
+     *
+     * @param[in, out] other The other AST.
+     */
+    void swap(TWAbstractSyntaxTree& other);
+
     /**
      * Create a token add it to the AST.
      *
      * @param[in]   tokenType   The type of the token.
      * @param[in]   str         The string which represents the token.
+     * @param[in]   length      The string length.
      *
      * @return If successful created and added, it will return true otherwise false.
      */
-    bool createToken(TWToken::Type tokenType, const String& str);
+    bool createToken(TWToken::Type tokenType, const char* str, size_t length);
+
+    /**
+     * Append a string to the string of the last created token.
+     *
+     * @param[in]   str     The string which to append.
+     * @param[in]   length  The string length.
+     *
+     * @return If successful appended, it will return true otherwise false.
+     */
+    bool appendToLastToken(const char* str, size_t length);
+
+    /**
+     * Set the string of a token. If the new string is not longer than the
+     * current one, it will be overwritten in place.
+     *
+     * @param[in]   index   The token index in the AST.
+     * @param[in]   str     The string which to set. It must not refer to the AST.
+     * @param[in]   length  The string length.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool setTokenStr(uint32_t index, const char* str, size_t length);
 
     /**
      * Get number of tokens in the AST.
@@ -159,8 +196,20 @@ private:
     /** Token list */
     typedef std::vector<TWToken> TokenList;
 
+    /** String arena */
+    typedef std::vector<char>    StringArena;
+
     TWToken                      m_tokenTrash; /**< Used for invalid token access. */
+    StringArena                  m_arena;      /**< Terminated token strings */
     TokenList                    m_tokens;     /**< Token AST */
+
+    /**
+     * Ensure that the string arena can hold the given number of characters
+     * without moving. If the arena must grow, all token strings are relocated.
+     *
+     * @param[in] size  Number of characters
+     */
+    void reserveArena(size_t size);
 };
 
 /******************************************************************************
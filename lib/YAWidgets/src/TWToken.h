@@ -44,7 +44,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include <WString.h>
+#include <stddef.h>
 
 /******************************************************************************
  * Macros
@@ -56,6 +56,9 @@
 
 /**
  * A text widget token.
+ *
+ * The token doesn't own its string. It refers to the string arena of the
+ * abstract syntax tree, which created the token.
  */
 class TWToken
 {
@@ -75,11 +78,14 @@ public:
      * Constructs a token.
      *
      * @param[in] tokenType The type of the token.
-     * @param[in] str       The string which represents the token.
+     * @param[in] str       The string which represents the token. It must be
+     *                      terminated and live as long as the token.
+     * @param[in] length    The string length without termination.
      */
-    TWToken(Type tokenType, const String& str) :
+    TWToken(Type tokenType, const char* str, size_t length) :
         m_type(tokenType),
-        m_str(str)
+        m_str(str),
+        m_length(length)
     {
     }
 
@@ -90,7 +96,8 @@ public:
      */
     TWToken(const TWToken& other) :
         m_type(other.m_type),
-        m_str(other.m_str)
+        m_str(other.m_str),
+        m_length(other.m_length)
     {
     }
 
@@ -112,8 +119,9 @@ public:
     {
         if (this != &other)
         {
-            m_type = other.m_type;
-            m_str  = other.m_str;
+            m_type   = other.m_type;
+            m_str    = other.m_str;
+            m_length = other.m_length;
         }
 
         return *this;
@@ -142,27 +150,31 @@ public:
     /**
      * Get token string.
      *
-     * @return Token string
+     * @return Terminated token string
      */
-    const String& getStr() const
+    const char* getStr() const
     {
         return m_str;
     }
 
     /**
-     * Set token string.
+     * Get token string length.
      *
-     * @param[in] str   Token string which to set.
+     * @return Number of characters without termination
      */
-    void setStr(const String& str)
+    size_t getLength() const
     {
-        m_str = str;
+        return m_length;
     }
 
 private:
 
-    Type   m_type; /**< The type of the token. */
-    String m_str;  /**< String which represents the token. */
+    /* The AST relocates the token string, if its string arena moves. */
+    friend class TWAbstractSyntaxTree;
+
+    Type        m_type;   /**< The type of the token. */
+    const char* m_str;    /**< String which represents the token. */
+    size_t      m_length; /**< String length without termination. */
 };
 
 /******************************************************************************
@@ -61,20 +61,24 @@
 
 bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
 {
-    bool   isSuccessful        = true;
-    size_t idx                 = 0U;
-    bool   isKeywordBeginFound = false;
-    bool   isEscapeActive      = false;
-    size_t beginIdx            = 0U;
-    String result;
-
-    /* Clear the AST first to ensure there is no old stuff inside. */
+    bool        isSuccessful        = true;
+    size_t      idx                 = 0U;
+    bool        isKeywordBeginFound = false;
+    bool        isEscapeActive      = false;
+    bool        isTextTokenOpen     = false;
+    size_t      beginIdx            = 0U;
+    const char* text                = formattedText.c_str();
+
+    /* Clear the AST first to ensure there is no old stuff inside.
+     * Its memory is reused, so a format string which differs only in its
+     * text values from the previous one, is parsed without any allocation.
+     */
     ast.clear();
 
     /* Walk through formatted text character by character as long as parse
      * error happens or the end is reached.
      */
-    while ((true == isSuccessful) && ('\0' != formattedText[idx]))
+    while ((true == isSuccessful) && ('\0' != text[idx]))
     {
         /* Escape active? */
         if (true == isEscapeActive)
@@ -83,14 +87,18 @@ bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
              * text. The escape character itself shall not be in the
              * result text.
              */
-            result         += formattedText.substring(beginIdx, idx - 1U);
-            result         += formattedText[idx];
+            isSuccessful = addText(ast, isTextTokenOpen, &text[beginIdx], idx - 1U - beginIdx);
+
+            if (true == isSuccessful)
+            {
+                isSuccessful = addText(ast, isTextTokenOpen, &text[idx], 1U);
+            }
 
             beginIdx        = idx + 1U;
             isEscapeActive  = false;
         }
         /* Escape character found? */
-        else if ('\\' == formattedText[idx])
+        else if ('\\' == text[idx])
         {
             /* Escape character inside a keyword is not allowed. */
             if (true == isKeywordBeginFound)
@@ -103,7 +111,7 @@ bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
             }
         }
         /* Line feed found? */
-        else if ('\n' == formattedText[idx])
+        else if ('\n' == text[idx])
         {
             /* Line feed inside a keyword is not allowed. */
             if (true == isKeywordBeginFound)
@@ -112,13 +120,13 @@ bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
             }
             else
             {
-                isSuccessful = ast.createToken(TWToken::TYPE_LINE_FEED, "\n");
-
-                beginIdx     = idx + 1U;
+                isSuccessful    = ast.createToken(TWToken::TYPE_LINE_FEED, &text[idx], 1U);
+                isTextTokenOpen = false;
+                beginIdx        = idx + 1U;
             }
         }
         /* Begin of keyword found? */
-        else if ('{' == formattedText[idx])
+        else if ('{' == text[idx])
         {
             /* Already inside a keyword? */
             if (true == isKeywordBeginFound)
@@ -132,7 +140,7 @@ bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
             }
         }
         /* End of keyword found? */
-        else if ('}' == formattedText[idx])
+        else if ('}' == text[idx])
         {
             /* No keyword started yet? */
             if (false == isKeywordBeginFound)
@@ -141,7 +149,8 @@ bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
             }
             else
             {
-                isSuccessful        = ast.createToken(TWToken::TYPE_KEYWORD, formattedText.substring(beginIdx, idx + 1U));
+                isSuccessful        = ast.createToken(TWToken::TYPE_KEYWORD, &text[beginIdx], idx + 1U - beginIdx);
+                isTextTokenOpen     = false;
                 beginIdx            = idx + 1U;
                 isKeywordBeginFound = false;
             }
@@ -149,22 +158,13 @@ bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
         else if (false == isKeywordBeginFound)
         {
             /* End of text reached? */
-            if (('{' == formattedText[idx + 1U]) ||
-                ('}' == formattedText[idx + 1U]) ||
-                ('\n' == formattedText[idx + 1U]) ||
-                ('\0' == formattedText[idx + 1U]))
+            if (('{' == text[idx + 1U]) ||
+                ('}' == text[idx + 1U]) ||
+                ('\n' == text[idx + 1U]) ||
+                ('\0' == text[idx + 1U]))
             {
-                if (beginIdx <= idx)
-                {
-                    result += formattedText.substring(beginIdx, idx + 1U);
-                }
-
-                if (false == result.isEmpty())
-                {
-                    isSuccessful = ast.createToken(TWToken::TYPE_TEXT, result);
-                    beginIdx     = idx + 1U;
-                    result.clear();
-                }
+                isSuccessful = addText(ast, isTextTokenOpen, &text[beginIdx], idx + 1U - beginIdx);
+                beginIdx     = idx + 1U;
             }
         }
         else
@@ -181,11 +181,6 @@ bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
         ++idx;
     }
 
-    if (false == result.isEmpty())
-    {
-        isSuccessful = ast.createToken(TWToken::TYPE_TEXT, result);
-    }
-
     return isSuccessful;
 }
 
@@ -197,6 +192,27 @@ bool TWTokenizer::parse(TWAbstractSyntaxTree& ast, const String& formattedText)
  * Private Methods
  *****************************************************************************/
 
+bool TWTokenizer::addText(TWAbstractSyntaxTree& ast, bool& isTextTokenOpen, const char* str, size_t length)
+{
+    bool isSuccessful = true;
+
+    if (0U < length)
+    {
+        /* Text parts, which are separated by escapes, belong to the same text token. */
+        if (true == isTextTokenOpen)
+        {
+            isSuccessful = ast.appendToLastToken(str, length);
+        }
+        else
+        {
+            isSuccessful    = ast.createToken(TWToken::TYPE_TEXT, str, length);
+            isTextTokenOpen = isSuccessful;
+        }
+    }
+
+    return isSuccessful;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
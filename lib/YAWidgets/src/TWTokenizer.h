@@ -44,6 +44,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
+#include <WString.h>
 #include <TWToken.h>
 #include <TWAbstractSyntaxTree.h>
 
@@ -107,6 +108,19 @@ public:
 private:
 
     uint32_t m_errorIndex; /**< Index in the formatted text, where the error happened. */
+
+    /**
+     * Add text to the AST. If a text token is open, the text will be appended
+     * to it, otherwise a new text token is created.
+     *
+     * @param[in, out]  ast             The abstract syntax tree.
+     * @param[in, out]  isTextTokenOpen Is the last token a open text token?
+     * @param[in]       str             The text which to add.
+     * @param[in]       length          The text length.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool addText(TWAbstractSyntaxTree& ast, bool& isTextTokenOpen, const char* str, size_t length);
 };
 
 /******************************************************************************
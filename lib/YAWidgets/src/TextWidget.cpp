@@ -37,6 +37,8 @@
 #include "TWTokenizer.h"
 #include "Utf8.h"
 
+#include <string.h>
+
 #include <Fonts.h>
 #include <Util.h>
 #include <Logging.h>
@@ -110,6 +112,7 @@ TextWidget::TextWidget(uint16_t width, uint16_t height, int16_t x, int16_t y) :
     m_updateText(false),
     m_ast(),
     m_astNew(),
+    m_astSpare(),
     m_solidBrush(DEFAULT_TEXT_COLOR),
     m_linearGradientBrush(
         DEFAULT_TEXT_COLOR_GRADIENT_COLOR_1,
@@ -121,6 +124,9 @@ TextWidget::TextWidget(uint16_t width, uint16_t height, int16_t x, int16_t y) :
     m_scrollingCnt(0U),
     m_scrollOffset(0),
     m_scrollTimer(),
+    m_textLayout(),
+    m_isScrollStripEnabled(false),
+    m_scrollStrip(),
     m_hAlign(Alignment::Horizontal::HORIZONTAL_LEFT),
     m_vAlign(Alignment::Vertical::VERTICAL_TOP),
     m_vAlignPosY(0)
@@ -145,6 +151,7 @@ TextWidget::TextWidget(const String& str, const Color& color) :
     m_updateText(false),
     m_ast(),
     m_astNew(),
+    m_astSpare(),
     m_solidBrush(DEFAULT_TEXT_COLOR),
     m_linearGradientBrush(
         DEFAULT_TEXT_COLOR_GRADIENT_COLOR_1,
@@ -156,6 +163,9 @@ TextWidget::TextWidget(const String& str, const Color& color) :
     m_scrollingCnt(0U),
     m_scrollOffset(0),
     m_scrollTimer(),
+    m_textLayout(),
+    m_isScrollStripEnabled(false),
+    m_scrollStrip(),
     m_hAlign(Alignment::Horizontal::HORIZONTAL_LEFT),
     m_vAlign(Alignment::Vertical::VERTICAL_TOP),
     m_vAlignPosY(0)
@@ -192,12 +202,16 @@ TextWidget::TextWidget(const TextWidget& widget) :
     m_updateText(widget.m_updateText),
     m_ast(widget.m_ast),
     m_astNew(widget.m_astNew),
+    m_astSpare(),
     m_solidBrush(widget.m_solidBrush),
     m_linearGradientBrush(widget.m_linearGradientBrush),
     m_gfxText(widget.m_gfxText),
     m_scrollingCnt(widget.m_scrollingCnt),
     m_scrollOffset(widget.m_scrollOffset),
     m_scrollTimer(widget.m_scrollTimer),
+    m_textLayout(widget.m_textLayout),
+    m_isScrollStripEnabled(widget.m_isScrollStripEnabled),
+    m_scrollStrip(widget.m_scrollStrip),
     m_hAlign(widget.m_hAlign),
     m_vAlign(widget.m_vAlign),
     m_vAlignPosY(widget.m_vAlignPosY)
@@ -210,26 +224,29 @@ TextWidget& TextWidget::operator=(const TextWidget& widget)
     {
         Widget::operator=(widget);
 
-        m_formatStrUtf8       = widget.m_formatStrUtf8;
-        m_formatStrNewUtf8    = widget.m_formatStrNewUtf8;
-        m_fadeState           = widget.m_fadeState;
-        m_fadeBrightness      = widget.m_fadeBrightness;
-        m_isFadeEffectEnabled = widget.m_isFadeEffectEnabled;
-        m_scrollInfo          = widget.m_scrollInfo;
-        m_scrollInfoNew       = widget.m_scrollInfoNew;
-        m_prepareNewText      = widget.m_prepareNewText;
-        m_updateText          = widget.m_updateText;
-        m_ast                 = widget.m_ast;
-        m_astNew              = widget.m_astNew;
-        m_solidBrush          = widget.m_solidBrush;
-        m_linearGradientBrush = widget.m_linearGradientBrush;
-        m_gfxText             = widget.m_gfxText;
-        m_scrollingCnt        = widget.m_scrollingCnt;
-        m_scrollOffset        = widget.m_scrollOffset;
-        m_scrollTimer         = widget.m_scrollTimer;
-        m_hAlign              = widget.m_hAlign;
-        m_vAlign              = widget.m_vAlign;
-        m_vAlignPosY          = widget.m_vAlignPosY;
+        m_formatStrUtf8        = widget.m_formatStrUtf8;
+        m_formatStrNewUtf8     = widget.m_formatStrNewUtf8;
+        m_fadeState            = widget.m_fadeState;
+        m_fadeBrightness       = widget.m_fadeBrightness;
+        m_isFadeEffectEnabled  = widget.m_isFadeEffectEnabled;
+        m_scrollInfo           = widget.m_scrollInfo;
+        m_scrollInfoNew        = widget.m_scrollInfoNew;
+        m_prepareNewText       = widget.m_prepareNewText;
+        m_updateText           = widget.m_updateText;
+        m_ast                  = widget.m_ast;
+        m_astNew               = widget.m_astNew;
+        m_solidBrush           = widget.m_solidBrush;
+        m_linearGradientBrush  = widget.m_linearGradientBrush;
+        m_gfxText              = widget.m_gfxText;
+        m_scrollingCnt         = widget.m_scrollingCnt;
+        m_scrollOffset         = widget.m_scrollOffset;
+        m_scrollTimer          = widget.m_scrollTimer;
+        m_textLayout           = widget.m_textLayout;
+        m_isScrollStripEnabled = widget.m_isScrollStripEnabled;
+        m_scrollStrip          = widget.m_scrollStrip;
+        m_hAlign               = widget.m_hAlign;
+        m_vAlign               = widget.m_vAlign;
+        m_vAlignPosY           = widget.m_vAlignPosY;
     }
 
     return *this;
@@ -241,13 +258,16 @@ void TextWidget::setFormatStr(const String& formatStrUtf8)
     if (((m_formatStrUtf8 != formatStrUtf8) && (false == m_prepareNewText)) ||
         ((m_formatStrNewUtf8 != formatStrUtf8) && (true == m_prepareNewText)))
     {
-        TWTokenizer          tokenizer;
-        TWAbstractSyntaxTree ast;
-        String               formatStrIntern; /* Internal character encoding. */
+        TWTokenizer tokenizer;
+        String      formatStrIntern; /* Internal character encoding. */
 
         Utf8::toIntern(formatStrUtf8, formatStrIntern);
 
-        if (false == tokenizer.parse(ast, formatStrIntern))
+        /* Parse into the spare AST, which keeps the new AST valid in case of
+         * an error. Swapping instead of moving keeps the memory of all ASTs
+         * for reuse.
+         */
+        if (false == tokenizer.parse(m_astSpare, formatStrIntern))
         {
             LOG_WARNING("Text format is invalid at pos %u", tokenizer.getErrorIndex());
         }
@@ -255,7 +275,7 @@ void TextWidget::setFormatStr(const String& formatStrUtf8)
         {
             m_formatStrNewUtf8 = formatStrUtf8;
             m_prepareNewText   = true;
-            m_astNew           = std::move(ast);
+            m_astNew.swap(m_astSpare);
 
             /* Convert special character codes here to avoid that they need
              * later always special handling.
@@ -276,6 +296,8 @@ void TextWidget::clear()
     m_prepareNewText = false;
 
     m_ast.clear();
+    m_textLayout.clear();
+    m_scrollStrip.clear();
 
     m_vAlignPosY = 0U;
 }
@@ -673,8 +695,10 @@ void TextWidget::paint(YAGfx& gfx)
         m_updateText    = false;
         m_formatStrUtf8 = m_formatStrNewUtf8;
         m_scrollInfo    = m_scrollInfoNew;
-        m_ast           = std::move(m_astNew);
+        m_ast.swap(m_astNew);
+        m_astNew.clear();
 
+        m_textLayout.clear();
         alignTextVertical();
 
         if (true == m_scrollInfo.isEnabled)
@@ -688,10 +712,20 @@ void TextWidget::paint(YAGfx& gfx)
 
     /* Update the cursor position, it may have changed by scrolling. */
     calculateCursorPos(cursorX, cursorY);
-    m_gfxText.setTextCursorPos(cursorX, cursorY);
+
+    /* The format keywords are only handled again, if the layout depends
+     * on something else than the cursor position.
+     */
+    if (false == isTextLayoutValid(gfx, cursorX))
+    {
+        layoutText(gfx, m_ast, cursorX, cursorY);
+    }
 
     /* Show the text. */
-    show(gfx, m_ast, m_scrollInfo.isEnabled);
+    if (false == showScrollStrip(gfx, cursorX, cursorY))
+    {
+        show(gfx, m_ast, cursorX, cursorY);
+    }
 
     /* Handle fade effect. */
     handleFadeEffect();
@@ -715,17 +749,19 @@ void TextWidget::specialCharacterCodeKeywordToText(TWAbstractSyntaxTree& ast)
 
         if (TWToken::TYPE_KEYWORD == token.getType())
         {
-            if (true == isKeywordEqual("{0x*}", token.getStr().c_str()))
+            if (true == isKeywordEqual("{0x*}", token.getStr()))
             {
-                size_t  length      = token.getStr().length();
-                String  charCodeStr = token.getStr().substring(1U, length - 1U); /* {0x*} */
+                size_t  length      = token.getLength();
+                String  charCodeStr = String(token.getStr()).substring(1U, length - 1U); /* {0x*} */
                 uint8_t charCode    = 0U;
                 bool    convStatus  = Util::strToUInt8(charCodeStr, charCode);
 
                 if (true == convStatus)
                 {
+                    char character = static_cast<char>(charCode);
+
                     token.setType(TWToken::TYPE_TEXT);
-                    token.setStr(String(static_cast<char>(charCode)));
+                    (void)ast.setTokenStr(idx, &character, 1U);
                 }
             }
         }
@@ -797,7 +833,29 @@ uint32_t TextWidget::getSingleLine(String& singleLine, const TWAbstractSyntaxTre
     return idx;
 }
 
-void TextWidget::show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, bool isScrolling)
+bool TextWidget::isTextLayoutValid(const YAGfx& gfx, int16_t cursorX) const
+{
+    bool isValid = false;
+
+    if ((true == m_textLayout.isValid) &&
+        (gfx.getWidth() == m_textLayout.width) &&
+        (m_gfxText.getFont().getGfxFont() == m_textLayout.gfxFont) &&
+        (m_hAlign == m_textLayout.hAlign))
+    {
+        /* Moving the layout vertical is always possible, but horizontal
+         * only if there is no dependency to the absolute cursor position.
+         */
+        if ((true == m_textLayout.isMovableX) ||
+            (cursorX == m_textLayout.cursorX))
+        {
+            isValid = true;
+        }
+    }
+
+    return isValid;
+}
+
+void TextWidget::layoutText(YAGfx& gfx, const TWAbstractSyntaxTree& ast, int16_t cursorX, int16_t cursorY)
 {
     uint32_t                 astLength                 = ast.length();
     YAGfxSolidBrush          solidBrushBackup          = m_solidBrush;          /* Backup solid brush */
@@ -811,6 +869,15 @@ void TextWidget::show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, bool isScroll
     String                   singleLine;
     uint8_t                  brushIntensity;
 
+    m_textLayout.clear();
+    m_textLayout.isMovableX = (false == m_gfxText.isTextWrapEnabled());
+    m_textLayout.cursorX    = cursorX;
+    m_textLayout.width      = gfx.getWidth();
+    m_textLayout.gfxFont    = m_gfxText.getFont().getGfxFont();
+    m_textLayout.hAlign     = m_hAlign;
+
+    m_gfxText.setTextCursorPos(cursorX, cursorY);
+
     /* First run handles only format tags, which influence the whole text. */
     for (idx = 0U; idx < astLength; ++idx)
     {
@@ -819,7 +886,7 @@ void TextWidget::show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, bool isScroll
         if (TWToken::TYPE_KEYWORD == token.getType())
         {
             /* Handle only format tags, which influence the whole text. */
-            (void)handleKeyword(gfx, FORMAT_KEYWORD_TABLE_1, UTIL_ARRAY_NUM(FORMAT_KEYWORD_TABLE_1), token.getStr().c_str());
+            (void)handleKeyword(gfx, FORMAT_KEYWORD_TABLE_1, UTIL_ARRAY_NUM(FORMAT_KEYWORD_TABLE_1), token.getStr());
         }
     }
 
@@ -828,7 +895,7 @@ void TextWidget::show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, bool isScroll
     hAlignPosX = alignTextHorizontal(gfx, singleLine, m_hAlign);
     m_gfxText.setTextCursorPosX(m_gfxText.getTextCursorPosX() + hAlignPosX);
 
-    /* Second run, now showing text too. */
+    /* Second run, now positioning the text too. */
     for (idx = 0U; idx < astLength; ++idx)
     {
         const TWToken& token = ast[idx];
@@ -836,7 +903,7 @@ void TextWidget::show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, bool isScroll
         switch (token.getType())
         {
         case TWToken::TYPE_KEYWORD:
-            (void)handleKeyword(gfx, FORMAT_KEYWORD_TABLE_2, UTIL_ARRAY_NUM(FORMAT_KEYWORD_TABLE_2), token.getStr().c_str());
+            (void)handleKeyword(gfx, FORMAT_KEYWORD_TABLE_2, UTIL_ARRAY_NUM(FORMAT_KEYWORD_TABLE_2), token.getStr());
             break;
 
         case TWToken::TYPE_TEXT:
@@ -849,12 +916,26 @@ void TextWidget::show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, bool isScroll
                 hAlign = m_hAlign;
             }
 
-            m_gfxText.drawText(gfx, token.getStr().c_str());
+            addTextRun(idx, cursorX, cursorY);
+
+            /* A line feed by special character code depends on the absolute cursor position. */
+            if (nullptr != strchr(token.getStr(), '\n'))
+            {
+                m_textLayout.isMovableX = false;
+            }
+
+            m_gfxText.moveTextCursor(gfx.getWidth(), token.getStr());
+
+            if (m_textLayout.maxX < (m_gfxText.getTextCursorPosX() - cursorX))
+            {
+                m_textLayout.maxX = m_gfxText.getTextCursorPosX() - cursorX;
+            }
             break;
 
         case TWToken::TYPE_LINE_FEED:
             /* Set text cursor to next line. */
-            m_gfxText.drawText(gfx, "\n");
+            m_gfxText.moveTextCursor(gfx.getWidth(), "\n");
+            m_textLayout.isMovableX = false;
 
             /* Calculate next text cursor x position and consider horizontal alignment. */
             (void)getSingleLine(singleLine, ast, idx + 1U);
@@ -878,6 +959,265 @@ void TextWidget::show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, bool isScroll
     m_gfxText.getBrush().setIntensity(brushIntensity);
     m_hAlign = hAlignBackup;
     m_vAlign = vAlignBackup;
+
+    /* Brush changes by format keywords are only tracked during layout. */
+    m_textLayout.isSolidBrushChanged          = false;
+    m_textLayout.isLinearGradientBrushChanged = false;
+    m_textLayout.isValid                      = true;
+
+    /* The scroll strip belongs to the previous layout. */
+    m_scrollStrip.isValid = false;
+}
+
+void TextWidget::addTextRun(uint32_t tokenIdx, int16_t cursorX, int16_t cursorY)
+{
+    const YAGfxBrush* brush = &m_gfxText.getBrush();
+    TextRun           run;
+
+    run.x        = m_gfxText.getTextCursorPosX() - cursorX;
+    run.y        = m_gfxText.getTextCursorPosY() - cursorY;
+    run.tokenIdx = tokenIdx;
+    run.brush    = RUN_BRUSH_TEXT;
+    run.brushIdx = 0U;
+
+    /* A brush, which was changed by a format keyword is kept as it is.
+     * All other brushes are used as they are at the time of drawing.
+     */
+    if (&m_solidBrush == brush)
+    {
+        if (true == m_textLayout.isSolidBrushChanged)
+        {
+            run.brush    = RUN_BRUSH_SOLID_KEYWORD;
+            run.brushIdx = m_textLayout.solidBrushes.size();
+            m_textLayout.solidBrushes.push_back(m_solidBrush);
+        }
+        else
+        {
+            run.brush = RUN_BRUSH_SOLID;
+        }
+    }
+    else if (&m_linearGradientBrush == brush)
+    {
+        if (true == m_textLayout.isLinearGradientBrushChanged)
+        {
+            run.brush    = RUN_BRUSH_LINEAR_GRADIENT_KEYWORD;
+            run.brushIdx = m_textLayout.linearGradientBrushes.size();
+            m_textLayout.linearGradientBrushes.push_back(m_linearGradientBrush);
+        }
+        else
+        {
+            run.brush = RUN_BRUSH_LINEAR_GRADIENT;
+        }
+    }
+    else
+    {
+        ;
+    }
+
+    if (m_textLayout.minX > run.x)
+    {
+        m_textLayout.minX = run.x;
+    }
+
+    m_textLayout.runs.push_back(run);
+}
+
+YAGfxBrush& TextWidget::getRunBrush(const TextRun& run, YAGfxBrush& textBrush)
+{
+    YAGfxBrush* brush = &textBrush;
+
+    switch (run.brush)
+    {
+    case RUN_BRUSH_TEXT:
+        break;
+
+    case RUN_BRUSH_SOLID:
+        brush = &m_solidBrush;
+        break;
+
+    case RUN_BRUSH_LINEAR_GRADIENT:
+        brush = &m_linearGradientBrush;
+        break;
+
+    case RUN_BRUSH_SOLID_KEYWORD:
+        brush = &m_textLayout.solidBrushes[run.brushIdx];
+        break;
+
+    case RUN_BRUSH_LINEAR_GRADIENT_KEYWORD:
+        brush = &m_textLayout.linearGradientBrushes[run.brushIdx];
+        break;
+
+    default:
+        break;
+    }
+
+    return *brush;
+}
+
+Color TextWidget::getRunColor(const TextRun& run, YAGfxBrush& textBrush)
+{
+    const YAGfxBrush& brush = getRunBrush(run, textBrush);
+    Color             color = SCROLL_STRIP_TRANSPARENT_COLOR;
+
+    /* Only a solid brush is independent of the pixel position. */
+    if (true == brush.isSolid())
+    {
+        color = static_cast<const YAGfxSolidBrush&>(brush).getColor();
+        color.setIntensity(FADING_BRIGHTNESS_HIGH);
+    }
+
+    return color;
+}
+
+void TextWidget::show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, int16_t cursorX, int16_t cursorY)
+{
+    YAGfxBrush& textBrush                    = m_gfxText.getBrush();
+    uint8_t     brushIntensity               = textBrush.getIntensity();
+    uint8_t     solidBrushIntensity          = m_solidBrush.getIntensity();
+    uint8_t     linearGradientBrushIntensity = m_linearGradientBrush.getIntensity();
+    size_t      idx;
+
+    /* All brushes are drawn with the current text brush intensity,
+     * because of the fade effect.
+     */
+    m_solidBrush.setIntensity(brushIntensity);
+    m_linearGradientBrush.setIntensity(brushIntensity);
+
+    for (idx = 0U; idx < m_textLayout.runs.size(); ++idx)
+    {
+        const TextRun& run   = m_textLayout.runs[idx];
+        YAGfxBrush&    brush = getRunBrush(run, textBrush);
+
+        brush.setIntensity(brushIntensity);
+
+        m_gfxText.setBrush(brush);
+        m_gfxText.setTextCursorPos(cursorX + run.x, cursorY + run.y);
+        m_gfxText.drawText(gfx, ast[run.tokenIdx].getStr());
+    }
+
+    /* Restore original brushes. */
+    m_solidBrush.setIntensity(solidBrushIntensity);
+    m_linearGradientBrush.setIntensity(linearGradientBrushIntensity);
+    m_gfxText.setBrush(textBrush);
+    textBrush.setIntensity(brushIntensity);
+}
+
+bool TextWidget::showScrollStrip(YAGfx& gfx, int16_t cursorX, int16_t cursorY)
+{
+    bool isShown = false;
+
+    /* The scroll strip is only used for text, which scrolls from right to
+     * left and is completely faded in. Otherwise the text is drawn directly.
+     */
+    if ((true == m_isScrollStripEnabled) &&
+        (true == m_scrollInfo.isEnabled) &&
+        (true == m_scrollInfo.isScrollingToLeft) &&
+        (true == m_textLayout.isMovableX) &&
+        (FADING_BRIGHTNESS_HIGH == m_fadeBrightness))
+    {
+        if (false == isScrollStripValid(gfx, cursorY))
+        {
+            renderScrollStrip(gfx, cursorY);
+        }
+
+        if (true == m_scrollStrip.bitmap.isAllocated())
+        {
+            gfx.drawBitmap(cursorX + m_textLayout.minX, 0, m_scrollStrip.bitmap, SCROLL_STRIP_TRANSPARENT_COLOR);
+            isShown = true;
+        }
+    }
+
+    return isShown;
+}
+
+bool TextWidget::isScrollStripValid(const YAGfx& gfx, int16_t cursorY)
+{
+    bool isValid = false;
+
+    if ((true == m_scrollStrip.isValid) &&
+        (cursorY == m_scrollStrip.cursorY) &&
+        (gfx.getHeight() == m_scrollStrip.height) &&
+        (m_textLayout.runs.size() == m_scrollStrip.runColors.size()))
+    {
+        YAGfxBrush& textBrush = m_gfxText.getBrush();
+        size_t      idx       = 0U;
+
+        isValid = true;
+
+        /* Brushes, which are not set by format keywords, may be changed any time. */
+        while ((m_textLayout.runs.size() > idx) && (true == isValid))
+        {
+            if (getRunColor(m_textLayout.runs[idx], textBrush) != m_scrollStrip.runColors[idx])
+            {
+                isValid = false;
+            }
+
+            ++idx;
+        }
+    }
+
+    return isValid;
+}
+
+void TextWidget::renderScrollStrip(const YAGfx& gfx, int16_t cursorY)
+{
+    YAGfxBrush& textBrush    = m_gfxText.getBrush();
+    uint16_t    width        = 0U;
+    uint16_t    height       = gfx.getHeight();
+    bool        isRenderable = true;
+    size_t      idx;
+
+    if (m_textLayout.minX < m_textLayout.maxX)
+    {
+        width = m_textLayout.maxX - m_textLayout.minX;
+    }
+
+    m_scrollStrip.isValid = true;
+    m_scrollStrip.cursorY = cursorY;
+    m_scrollStrip.height  = height;
+    m_scrollStrip.runColors.clear();
+
+    /* Every text run must have a solid color, which differs from the transparent one. */
+    for (idx = 0U; idx < m_textLayout.runs.size(); ++idx)
+    {
+        Color color = getRunColor(m_textLayout.runs[idx], textBrush);
+
+        if (SCROLL_STRIP_TRANSPARENT_COLOR == color)
+        {
+            isRenderable = false;
+        }
+
+        m_scrollStrip.runColors.push_back(color);
+    }
+
+    if ((0U == width) ||
+        (0U == height) ||
+        (MAX_SCROLL_STRIP_PIXELS < (static_cast<uint32_t>(width) * height)))
+    {
+        isRenderable = false;
+    }
+
+    /* Reuse the bitmap, if it has already the required size. */
+    if ((false == isRenderable) ||
+        (width != m_scrollStrip.bitmap.getWidth()) ||
+        (height != m_scrollStrip.bitmap.getHeight()))
+    {
+        m_scrollStrip.bitmap.release();
+    }
+
+    if (true == isRenderable)
+    {
+        if ((true == m_scrollStrip.bitmap.isAllocated()) ||
+            (true == m_scrollStrip.bitmap.create(width, height)))
+        {
+            m_scrollStrip.bitmap.fillScreen(SCROLL_STRIP_TRANSPARENT_COLOR);
+            show(m_scrollStrip.bitmap, m_ast, -m_textLayout.minX, cursorY);
+        }
+        else
+        {
+            LOG_WARNING("Scroll strip allocation failed.");
+        }
+    }
 }
 
 bool TextWidget::isKeywordEqual(const char* keyword, const char* other) const
@@ -1001,6 +1341,8 @@ void TextWidget::handleSolidColor(YAGfx& gfx, const String& keyword)
 
         m_solidBrush.setColor(textColor);
         m_gfxText.setBrush(m_solidBrush);
+
+        m_textLayout.isSolidBrushChanged = true;
     }
 }
 
@@ -1047,7 +1389,8 @@ bool TextWidget::handleLinearGradient(YAGfx& gfx, const String& keyword)
             m_linearGradientBrush.setOffset(offset);
             m_linearGradientBrush.setLength(gradLength);
 
-            isSuccessful = true;
+            m_textLayout.isLinearGradientBrushChanged = true;
+            isSuccessful                              = true;
         }
     }
 
@@ -45,12 +45,14 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
+#include <vector>
 #include <WString.h>
 #include <Widget.hpp>
 #include <YAColor.h>
 #include <YAFont.h>
 #include <YAGfxText.h>
 #include <YAGfxBrush.h>
+#include <YAGfxBitmap.h>
 #include <SimpleTimer.hpp>
 #include "Alignment.h"
 #include "TWAbstractSyntaxTree.h"
@@ -299,6 +301,21 @@ public:
      */
     bool getScrollInfo(bool& isScrollingEnabled, uint32_t& scrollingCnt);
 
+    /**
+     * Is the text animated, because it scrolls, fades or a new text is
+     * not shown yet? As long as it is animated, it shall be painted
+     * periodically.
+     *
+     * @return If animated, it will return true otherwise false.
+     */
+    bool isAnimated() const
+    {
+        return (true == m_prepareNewText) ||
+               (true == m_updateText) ||
+               (FADE_STATE_IDLE != m_fadeState) ||
+               (true == m_scrollInfo.isEnabled);
+    }
+
     /**
      * Set the horizontal alignment.
      *
@@ -336,6 +353,29 @@ public:
         m_isFadeEffectEnabled = false;
     }
 
+    /**
+     * Enable the scroll strip. A text, which scrolls from right to left,
+     * is rendered once into an off-screen bitmap and every scroll step
+     * just copies it to the current position.
+     *
+     * It is only used for text with solid colors, because e.g. a linear
+     * gradient depends on the absolute position. The bitmap is allocated
+     * in PSRAM, if available.
+     */
+    void enableScrollStrip()
+    {
+        m_isScrollStripEnabled = true;
+    }
+
+    /**
+     * Disable the scroll strip and release its bitmap.
+     */
+    void disableScrollStrip()
+    {
+        m_isScrollStripEnabled = false;
+        m_scrollStrip.clear();
+    }
+
     /** Default text color */
     static const uint32_t DEFAULT_TEXT_COLOR                  = ColorDef::WHITE;
 
@@ -369,6 +409,9 @@ public:
     /** Maximal scroll pause in ms */
     static const uint32_t MAX_SCROLL_PAUSE     = 500U;
 
+    /** Max. number of pixels of the scroll strip bitmap. */
+    static const uint32_t MAX_SCROLL_STRIP_PIXELS = 16384U;
+
 private:
 
     /** Fading brightness delta value per cycle. */
@@ -380,6 +423,9 @@ private:
     /** Fading brigthness high (brigthest value). */
     static const uint8_t FADING_BRIGHTNESS_HIGH  = 255U;
 
+    /** Transparent color of the scroll strip. */
+    static const uint32_t SCROLL_STRIP_TRANSPARENT_COLOR = ColorDef::BLACK;
+
     /** Keyword handler method. */
     typedef void (TextWidget::*KeywordHandler)(YAGfx& gfx, const String& keyword);
 
@@ -449,23 +495,152 @@ private:
         }
     };
 
-    String                   m_formatStrUtf8;       /**< Current shown string, which contains format tags. Encoding: UTF-8 */
-    String                   m_formatStrNewUtf8;    /**< New text string, which contains format tags. Encoding: UTF-8 */
-    FadeState                m_fadeState;           /**< The current fade state. Used to switch from old to new text. */
-    uint8_t                  m_fadeBrightness;      /**< Brightness value used for fading. */
-    bool                     m_isFadeEffectEnabled; /**< Is fade effect enabled? */
-    ScrollInfo               m_scrollInfo;          /**< Scroll information */
-    ScrollInfo               m_scrollInfoNew;       /**< Scroll information for the new text. */
-    bool                     m_prepareNewText;      /**< User set new text, which shall be prepared. */
-    bool                     m_updateText;          /**< New text is prepared shall be updated. */
-    TWAbstractSyntaxTree     m_ast;                 /**< AST for the current format string. Encoding: Internal */
-    TWAbstractSyntaxTree     m_astNew;              /**< AST for the new format string. Encoding: Internal */
-    YAGfxSolidBrush          m_solidBrush;          /**< Solid text color brush. */
-    YAGfxLinearGradientBrush m_linearGradientBrush; /**< Linear gradient text color brush. */
-    YAGfxText                m_gfxText;             /**< GFX for current text. */
-    uint32_t                 m_scrollingCnt;        /**< Counts how often a text was complete scrolled. */
-    int16_t                  m_scrollOffset;        /**< Pixel offset of cursor x position, used for scrolling. */
-    SimpleTimer              m_scrollTimer;         /**< Timer, used for scrolling */
+    /**
+     * The brush, which a text run is drawn with.
+     */
+    enum RunBrush
+    {
+        RUN_BRUSH_TEXT = 0,               /**< Current text brush */
+        RUN_BRUSH_SOLID,                  /**< Solid text color brush */
+        RUN_BRUSH_LINEAR_GRADIENT,        /**< Linear gradient text color brush */
+        RUN_BRUSH_SOLID_KEYWORD,          /**< Solid brush, which was set by format keyword. */
+        RUN_BRUSH_LINEAR_GRADIENT_KEYWORD /**< Linear gradient brush, which was set by format keyword. */
+    };
+
+    /**
+     * A text token of the AST with its resolved position and brush.
+     */
+    struct TextRun
+    {
+        int16_t  x;        /**< Cursor x-coordinate relative to the start cursor position. */
+        int16_t  y;        /**< Cursor y-coordinate relative to the start cursor position. */
+        uint32_t tokenIdx; /**< Index of the text token in the AST. */
+        RunBrush brush;    /**< Brush used to draw the text. */
+        size_t   brushIdx; /**< Index of the brush, which was set by format keyword. */
+    };
+
+    /**
+     * Text layout, which is the result of handling all format keywords of
+     * the current text. It is valid as long as the text, the font, the
+     * width and the horizontal alignment don't change. A pure cursor
+     * movement by scrolling just moves the whole layout.
+     */
+    struct TextLayout
+    {
+        bool                                  isValid;                      /**< Is layout valid? */
+        bool                                  isMovableX;                   /**< Can the layout be moved horizontal? Not possible in case of line feeds or text wrap around. */
+        int16_t                               cursorX;                      /**< Start cursor x-coordinate, used for the layout. */
+        uint16_t                              width;                        /**< Width in pixel, used for the layout. */
+        const GFXfont*                        gfxFont;                      /**< Font, used for the layout. */
+        Alignment::Horizontal                 hAlign;                       /**< Horizontal alignment, used for the layout. */
+        int16_t                               minX;                         /**< Left border of the text relative to the start cursor position. */
+        int16_t                               maxX;                         /**< Right border of the text relative to the start cursor position. */
+        std::vector<TextRun>                  runs;                         /**< Text runs */
+        std::vector<YAGfxSolidBrush>          solidBrushes;                 /**< Solid brushes, set by format keywords. */
+        std::vector<YAGfxLinearGradientBrush> linearGradientBrushes;        /**< Linear gradient brushes, set by format keywords. */
+        bool                                  isSolidBrushChanged;          /**< Is solid brush changed by format keyword during layout? */
+        bool                                  isLinearGradientBrushChanged; /**< Is linear gradient brush changed by format keyword during layout? */
+
+        /**
+         * Initializes the text layout.
+         */
+        TextLayout() :
+            isValid(false),
+            isMovableX(false),
+            cursorX(0),
+            width(0U),
+            gfxFont(nullptr),
+            hAlign(Alignment::Horizontal::HORIZONTAL_LEFT),
+            minX(0),
+            maxX(0),
+            runs(),
+            solidBrushes(),
+            linearGradientBrushes(),
+            isSolidBrushChanged(false),
+            isLinearGradientBrushChanged(false)
+        {
+        }
+
+        /**
+         * Clear text layout.
+         */
+        void clear()
+        {
+            isValid                      = false;
+            isMovableX                   = false;
+            cursorX                      = 0;
+            width                        = 0U;
+            gfxFont                      = nullptr;
+            hAlign                       = Alignment::Horizontal::HORIZONTAL_LEFT;
+            minX                         = 0;
+            maxX                         = 0;
+            isSolidBrushChanged          = false;
+            isLinearGradientBrushChanged = false;
+
+            runs.clear();
+            solidBrushes.clear();
+            linearGradientBrushes.clear();
+        }
+    };
+
+    /**
+     * Scroll strip, which contains the whole pre-rendered text line.
+     */
+    struct ScrollStrip
+    {
+        bool               isValid;   /**< Is the scroll strip rendered for the current text layout? */
+        int16_t            cursorY;   /**< Start cursor y-coordinate, used for rendering. */
+        uint16_t           height;    /**< Height in pixel, used for rendering. */
+        std::vector<Color> runColors; /**< Color of every text run, used for rendering. */
+        YAGfxDynamicBitmap bitmap;    /**< Pre-rendered text line, only allocated if the text can be pre-rendered. */
+
+        /**
+         * Initializes the scroll strip.
+         */
+        ScrollStrip() :
+            isValid(false),
+            cursorY(0),
+            height(0U),
+            runColors(),
+            bitmap()
+        {
+        }
+
+        /**
+         * Clear scroll strip and release its bitmap.
+         */
+        void clear()
+        {
+            isValid = false;
+            cursorY = 0;
+            height  = 0U;
+
+            runColors.clear();
+            bitmap.release();
+        }
+    };
+
+    String                   m_formatStrUtf8;        /**< Current shown string, which contains format tags. Encoding: UTF-8 */
+    String                   m_formatStrNewUtf8;     /**< New text string, which contains format tags. Encoding: UTF-8 */
+    FadeState                m_fadeState;            /**< The current fade state. Used to switch from old to new text. */
+    uint8_t                  m_fadeBrightness;       /**< Brightness value used for fading. */
+    bool                     m_isFadeEffectEnabled;  /**< Is fade effect enabled? */
+    ScrollInfo               m_scrollInfo;           /**< Scroll information */
+    ScrollInfo               m_scrollInfoNew;        /**< Scroll information for the new text. */
+    bool                     m_prepareNewText;       /**< User set new text, which shall be prepared. */
+    bool                     m_updateText;           /**< New text is prepared shall be updated. */
+    TWAbstractSyntaxTree     m_ast;                  /**< AST for the current format string. Encoding: Internal */
+    TWAbstractSyntaxTree     m_astNew;               /**< AST for the new format string. Encoding: Internal */
+    TWAbstractSyntaxTree     m_astSpare;             /**< Spare AST, used to parse a new format string. Encoding: Internal */
+    YAGfxSolidBrush          m_solidBrush;           /**< Solid text color brush. */
+    YAGfxLinearGradientBrush m_linearGradientBrush;  /**< Linear gradient text color brush. */
+    YAGfxText                m_gfxText;              /**< GFX for current text. */
+    uint32_t                 m_scrollingCnt;         /**< Counts how often a text was complete scrolled. */
+    int16_t                  m_scrollOffset;         /**< Pixel offset of cursor x position, used for scrolling. */
+    SimpleTimer              m_scrollTimer;          /**< Timer, used for scrolling */
+    TextLayout               m_textLayout;           /**< Layout of the current text */
+    bool                     m_isScrollStripEnabled; /**< Is the scroll strip enabled? */
+    ScrollStrip              m_scrollStrip;          /**< Scroll strip of the current text */
 
     /**
      * Horizontal alignment which is the default one.
@@ -618,15 +793,99 @@ private:
     uint32_t getSingleLine(String& singleLine, const TWAbstractSyntaxTree& ast, uint32_t startIdx);
 
     /**
-     * Show formatted text.
-     * Format tags:
-     * - "#RRGGBB" Color in HTML form (RGB888)
+     * Is the current text layout valid for the given graphics and start
+     * cursor position?
+     *
+     * @param[in] gfx       Graphics, used to draw the characters.
+     * @param[in] cursorX   Start cursor x-coordinate
+     *
+     * @return If valid, it will return true otherwise false.
+     */
+    bool isTextLayoutValid(const YAGfx& gfx, int16_t cursorX) const;
+
+    /**
+     * Layout the formatted text by handling all format keywords.
+     * The result is a list of text runs with their position relative to the
+     * start cursor position and their brush.
+     *
+     * @param[in] gfx       Graphics, used to draw the characters.
+     * @param[in] ast       The abstract syntax tree.
+     * @param[in] cursorX   Start cursor x-coordinate
+     * @param[in] cursorY   Start cursor y-coordinate
+     */
+    void layoutText(YAGfx& gfx, const TWAbstractSyntaxTree& ast, int16_t cursorX, int16_t cursorY);
+
+    /**
+     * Add the text token at the current text cursor position with the
+     * current brush to the text layout.
+     *
+     * @param[in] tokenIdx  Index of the text token in the AST.
+     * @param[in] cursorX   Start cursor x-coordinate
+     * @param[in] cursorY   Start cursor y-coordinate
+     */
+    void addTextRun(uint32_t tokenIdx, int16_t cursorX, int16_t cursorY);
+
+    /**
+     * Get the brush of a text run.
+     *
+     * @param[in] run       Text run
+     * @param[in] textBrush Current text brush
+     *
+     * @return Brush, which to draw the text run with.
+     */
+    YAGfxBrush& getRunBrush(const TextRun& run, YAGfxBrush& textBrush);
+
+    /**
+     * Get the color of a text run with full intensity, like it is used for
+     * the scroll strip.
+     *
+     * @param[in] run       Text run
+     * @param[in] textBrush Current text brush
+     *
+     * @return Color of a solid brush or the transparent color in any other case.
+     */
+    Color getRunColor(const TextRun& run, YAGfxBrush& textBrush);
+
+    /**
+     * Show the text layout at the given start cursor position.
+     *
+     * @param[in] gfx       Graphics, used to draw the characters.
+     * @param[in] ast       The abstract syntax tree, which the layout belongs to.
+     * @param[in] cursorX   Start cursor x-coordinate
+     * @param[in] cursorY   Start cursor y-coordinate
+     */
+    void show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, int16_t cursorX, int16_t cursorY);
+
+    /**
+     * Show the text layout via the scroll strip. The scroll strip is
+     * rendered again, if necessary.
+     *
+     * @param[in] gfx       Graphics, used to draw the characters.
+     * @param[in] cursorX   Start cursor x-coordinate
+     * @param[in] cursorY   Start cursor y-coordinate
+     *
+     * @return If the text is shown via the scroll strip, it will return true otherwise false.
+     */
+    bool showScrollStrip(YAGfx& gfx, int16_t cursorX, int16_t cursorY);
+
+    /**
+     * Is the scroll strip rendered for the current text layout and brushes?
+     *
+     * @param[in] gfx       Graphics, used to draw the characters.
+     * @param[in] cursorY   Start cursor y-coordinate
+     *
+     * @return If valid, it will return true otherwise false.
+     */
+    bool isScrollStripValid(const YAGfx& gfx, int16_t cursorY);
+
+    /**
+     * Render the current text layout into the scroll strip. If the text
+     * can not be pre-rendered, the scroll strip bitmap will be released.
      *
-     * @param[in] gfx           Graphics, used to draw the characters.
-     * @param[in] ast           The abstract syntax tree.
-     * @param[in] isScrolling   Is text scrolling or not.
+     * @param[in] gfx       Graphics, used to draw the characters.
+     * @param[in] cursorY   Start cursor y-coordinate
      */
-    void show(YAGfx& gfx, const TWAbstractSyntaxTree& ast, bool isScrolling);
+    void renderScrollStrip(const YAGfx& gfx, int16_t cursorY);
 
     /**
      * Compares two keywords.
@@ -137,6 +137,18 @@ bool DisplayMgr::begin()
         LOG_FATAL("Couldn't create double framebuffer.");
         isError = true;
     }
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+    else if (false == m_tripleFrameBuffer.create(Display::getInstance().getWidth(), Display::getInstance().getHeight()))
+    {
+        LOG_FATAL("Couldn't create triple framebuffer.");
+        isError = true;
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+    else if (false == m_frameSnapshot.create(Display::getInstance().getWidth(), Display::getInstance().getHeight()))
+    {
+        LOG_FATAL("Couldn't create frame snapshot.");
+        isError = true;
+    }
     else if (false == m_mutexInterf.create())
     {
         isError = true;
@@ -145,11 +157,31 @@ bool DisplayMgr::begin()
     {
         isError = true;
     }
+    else if (false == m_mutexDisplay.create())
+    {
+        isError = true;
+    }
     else
     {
         ;
     }
 
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+    /* Present task not started yet? */
+    if ((false == isError) &&
+        (false == m_presentTask.isRunning()))
+    {
+        if (false == m_presentTask.start(this))
+        {
+            isError = true;
+        }
+        else
+        {
+            LOG_DEBUG("Present task is up.");
+        }
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+
     /* Process task not started yet? */
     if ((false == isError) &&
         (false == m_processTask.isRunning()))
@@ -219,13 +251,30 @@ void DisplayMgr::end()
         LOG_DEBUG("Update task is down.");
     }
 
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+    /* Stop the present task. */
+    if (false == m_presentTask.stop())
+    {
+        LOG_ERROR("Failed to stop present task.");
+    }
+    else
+    {
+        LOG_DEBUG("Present task is down.");
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
     m_statisticsLogTimer.stop();
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 
+    m_mutexDisplay.destroy();
     m_mutexUpdate.destroy();
     m_mutexInterf.destroy();
 
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+    m_tripleFrameBuffer.release();
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+    m_frameSnapshot.release();
     m_doubleFrameBuffer.release();
     m_slotList.destroy();
 
@@ -254,9 +303,11 @@ bool DisplayMgr::getAutoBrightnessAdjustment(void) const
 
 void DisplayMgr::setBrightness(uint8_t level)
 {
-    MutexGuard<MutexRecursive> guard(m_mutexInterf);
+    MutexGuard<MutexRecursive> guard1(m_mutexInterf);
+    MutexGuard<MutexRecursive> guard2(m_mutexUpdate);
 
     BrightnessCtrl::getInstance().setBrightness(level);
+    m_updateTask.notify();
 }
 
 uint8_t DisplayMgr::getBrightness(void) const
@@ -686,37 +737,46 @@ bool DisplayMgr::setSlotDuration(uint8_t slotId, uint32_t duration, bool store)
     return status;
 }
 
-void DisplayMgr::getFBCopy(uint32_t* fb, size_t length, uint8_t* slotId)
+bool DisplayMgr::registerFBCopyReader()
 {
+    return m_frameSnapshot.registerReader();
+}
+
+void DisplayMgr::unregisterFBCopyReader()
+{
+    m_frameSnapshot.unregisterReader();
+}
+
+bool DisplayMgr::getFBCopy(uint32_t* fb, size_t length, uint8_t* slotId)
+{
+    bool isSuccessful = false;
+
     if ((nullptr != fb) &&
         (0 < length))
     {
-        IDisplay&                  display = Display::getInstance();
-        int16_t                    x;
-        int16_t                    y;
-        size_t                     index = 0;
-        MutexGuard<MutexRecursive> guard(m_mutexInterf);
+        uint32_t timestamp = millis();
 
-        /* Copy framebuffer after it is completely updated. */
-        for (y = 0; y < display.getHeight(); ++y)
-        {
-            for (x = 0; x < display.getWidth(); ++x)
-            {
-                fb[index] = display.getColor(x, y);
-                ++index;
+        isSuccessful = m_frameSnapshot.read(fb, length, slotId);
 
-                if (length <= index)
-                {
-                    break;
-                }
-            }
+        /* The snapshot is available after the first frame was published to it,
+         * which is requested now in case the display is refreshed event driven.
+         * The display itself is never read, to not block the display update.
+         */
+        if (false == isSuccessful)
+        {
+            m_updateTask.notify();
         }
 
-        if (nullptr != slotId)
+        while ((false == isSuccessful) &&
+               (FB_COPY_WAIT_TIME > (millis() - timestamp)))
         {
-            *slotId = m_selectedSlotId;
+            delay(FB_COPY_POLL_PERIOD);
+
+            isSuccessful = m_frameSnapshot.read(fb, length, slotId);
         }
     }
+
+    return isSuccessful;
 }
 
 uint8_t DisplayMgr::getMaxSlots() const
@@ -738,6 +798,7 @@ void DisplayMgr::displayOff()
 {
     MutexGuard<MutexRecursive> guard1(m_mutexInterf);
     MutexGuard<MutexRecursive> guard2(m_mutexUpdate);
+    MutexGuard<MutexRecursive> guard3(m_mutexDisplay);
 
     Display::getInstance().off();
 }
@@ -746,8 +807,10 @@ void DisplayMgr::displayOn()
 {
     MutexGuard<MutexRecursive> guard1(m_mutexInterf);
     MutexGuard<MutexRecursive> guard2(m_mutexUpdate);
+    MutexGuard<MutexRecursive> guard3(m_mutexDisplay);
 
     Display::getInstance().on();
+    m_updateTask.notify();
 }
 
 bool DisplayMgr::isDisplayOn() const
@@ -755,6 +818,7 @@ bool DisplayMgr::isDisplayOn() const
     bool                       isDisplayOn = false;
     MutexGuard<MutexRecursive> guard1(m_mutexInterf);
     MutexGuard<MutexRecursive> guard2(m_mutexUpdate);
+    MutexGuard<MutexRecursive> guard3(m_mutexDisplay);
 
     isDisplayOn = Display::getInstance().isOn();
 
@@ -775,8 +839,39 @@ void DisplayMgr::setIndicator(uint8_t indicatorId, bool isOn)
     MutexGuard<MutexRecursive> guard2(m_mutexUpdate);
 
     m_indicatorView.setIndicator(indicatorId, isOn);
+    m_updateTask.notify();
+}
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
+
+void DisplayMgr::getStatistics(Statistics& statistics) const
+{
+    MutexGuard<MutexRecursive> guard(m_mutexUpdate);
+
+    statistics = m_statistics;
+}
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+
+bool DisplayMgr::getSlotStatistics(uint8_t slotId, SlotStatistics& slotStatistics) const
+{
+    bool                       isSuccessful = false;
+    MutexGuard<MutexRecursive> guard(m_mutexUpdate);
+    const Slot*                slot = m_slotList.getSlot(slotId);
+
+    if (nullptr != slot)
+    {
+        slotStatistics = slot->getStatistics();
+        isSuccessful   = true;
+    }
+
+    return isSuccessful;
 }
 
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -788,8 +883,14 @@ void DisplayMgr::setIndicator(uint8_t indicatorId, bool isOn)
 DisplayMgr::DisplayMgr() :
     m_mutexInterf(),
     m_mutexUpdate(),
+    m_mutexDisplay(),
     m_processTask("processTask", processTask, PROCESS_TASK_STACK_SIZE, PROCESS_TASK_PRIORITY, PROCESS_TASK_RUN_CORE),
     m_updateTask("updateTask", updateTask, UPDATE_TASK_STACK_SIZE, UPDATE_TASK_PRIORITY, UPDATE_TASK_RUN_CORE),
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+    m_presentTask("presentTask", presentTask, PRESENT_TASK_STACK_SIZE, PRESENT_TASK_PRIORITY, PRESENT_TASK_RUN_CORE),
+    m_tripleFrameBuffer(),
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+    m_frameSnapshot(),
     m_slotList(),
     m_selectedSlotId(SlotList::SLOT_ID_INVALID),
     m_selectedPlugin(nullptr),
@@ -798,7 +899,8 @@ DisplayMgr::DisplayMgr() :
     m_doubleFrameBuffer(),
     m_fadeEffectController(m_doubleFrameBuffer),
     m_isNetworkConnected(false),
-    m_indicatorView()
+    m_indicatorView(),
+    m_updateDelay(UPDATE_TASK_PERIOD)
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
     ,
@@ -918,6 +1020,7 @@ void DisplayMgr::process()
     uint8_t                    index      = 0U;
     uint8_t                    stickySlot = SlotList::SLOT_ID_INVALID;
     MutexGuard<MutexRecursive> guardInterf(m_mutexInterf);
+    uint8_t                    brightness = BrightnessCtrl::getInstance().getBrightness();
 
     /* Handle display brightness */
     BrightnessCtrl::getInstance().process();
@@ -1096,6 +1199,8 @@ void DisplayMgr::process()
         /* No plugin is active, clear the display. */
         else
         {
+            MutexGuard<MutexRecursive> guardDisplay(m_mutexDisplay);
+
             selectedFrameBuffer.fillScreen(ColorDef::BLACK);
             display.clear();
         }
@@ -1109,31 +1214,133 @@ void DisplayMgr::process()
 
         if (nullptr != plugin)
         {
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+            uint32_t timestamp = micros();
+
+            plugin->process(m_isNetworkConnected);
+
+            m_slotList.getSlot(index)->getStatistics().updateProcessing(micros() - timestamp);
+#else  /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
             plugin->process(m_isNetworkConnected);
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+        }
+    }
+
+    /* The selected plugin or the fade effect may require a display refresh
+     * earlier than the update task expects.
+     */
+    {
+        MutexGuard<MutexRecursive> guard(m_mutexUpdate);
+
+        if (brightness != BrightnessCtrl::getInstance().getBrightness())
+        {
+            m_updateTask.notify();
+        }
+        else
+        {
+            requestUpdate();
         }
     }
 }
 
 void DisplayMgr::update()
 {
-    IDisplay&                  display = Display::getInstance();
     MutexGuard<MutexRecursive> guard(m_mutexUpdate);
     YAGfxDynamicBitmap&        selectedFrameBuffer = m_doubleFrameBuffer.getSelectedFramebuffer();
 
     /* Update frame buffer with plugin content. */
     if (nullptr != m_selectedPlugin)
     {
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+        uint32_t timestamp = micros();
+        Slot*    slot      = m_slotList.getSlot(m_selectedSlotId);
+
         m_selectedPlugin->update(selectedFrameBuffer);
+
+        /* A plugin which renders longer than the update period, delays the display refresh. */
+        if (nullptr != slot)
+        {
+            slot->getStatistics().updateRendering(micros() - timestamp, UPDATE_TASK_PERIOD * 1000U);
+        }
+#else  /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+        m_selectedPlugin->update(selectedFrameBuffer);
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
     }
 
     /* Update frame buffer with indicators (foreground). */
     m_indicatorView.update(selectedFrameBuffer);
 
-    /* Update the display buffer. */
-    m_fadeEffectController.update(display);
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+    /* Compose the frame and hand it over to the present task. */
+    m_fadeEffectController.update(m_tripleFrameBuffer.getBackBuffer());
+    m_frameSnapshot.publish(m_tripleFrameBuffer.getBackBuffer(), m_selectedSlotId);
+    m_tripleFrameBuffer.swapBackBuffer();
+    m_presentTask.notify();
+#else  /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+    {
+        IDisplay&                  display = Display::getInstance();
+        MutexGuard<MutexRecursive> guardDisplay(m_mutexDisplay);
+
+        /* Update the display buffer. */
+        m_fadeEffectController.update(display);
+
+        /* Publish the completed frame for getFBCopy(). The display is the
+         * source of the composed frame, therefore it is copied with the
+         * display lock held. With triple buffering it is copied without,
+         * from the back buffer, which only this task writes.
+         */
+        m_frameSnapshot.publish(display, m_selectedSlotId);
+
+        /* Latch display buffer. */
+        display.show();
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+
+    m_updateDelay = calcUpdateDelay();
+}
+
+uint32_t DisplayMgr::calcUpdateDelay() const
+{
+    uint32_t updateDelay = UPDATE_TASK_PERIOD;
+
+#if (0 != CONFIG_DISPLAY_MGR_EVENT_DRIVEN)
+    if (true == m_fadeEffectController.isRunning())
+    {
+        /* The fade effect requires every refresh cycle. */
+        ;
+    }
+    else if (nullptr != m_selectedPlugin)
+    {
+        updateDelay = m_selectedPlugin->getTimeToNextUpdate();
+
+        if (UPDATE_TASK_PERIOD > updateDelay)
+        {
+            updateDelay = UPDATE_TASK_PERIOD;
+        }
+        else if (UPDATE_TASK_MAX_PERIOD < updateDelay)
+        {
+            updateDelay = UPDATE_TASK_MAX_PERIOD;
+        }
+        else
+        {
+            ;
+        }
+    }
+    else
+    {
+        updateDelay = UPDATE_TASK_MAX_PERIOD;
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_EVENT_DRIVEN) */
 
-    /* Latch display buffer. */
-    display.show();
+    return updateDelay;
+}
+
+void DisplayMgr::requestUpdate()
+{
+    if (calcUpdateDelay() < m_updateDelay)
+    {
+        m_updateTask.notify();
+    }
 }
 
 void DisplayMgr::processTask(DisplayMgr* self)
@@ -1155,87 +1362,161 @@ void DisplayMgr::updateTask(DisplayMgr* self)
 {
     uint32_t timestamp           = millis(); /* ms */
     uint32_t duration            = 0U;       /* ms */
-    uint32_t timestampPhyUpdate  = 0U;       /* ms */
-    uint32_t durationPhyUpdate   = 0U;       /* ms */
-    bool     abort               = false;
-
-    /* Observe the physical display refresh and limit the duration to 70% of refresh period. */
-    const uint32_t MAX_LOOP_TIME = (UPDATE_TASK_PERIOD * 7U) / (10U);
 
     /* Refresh display content periodically */
     self->update();
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-    /* Update statistics for active plugin processing time. */
-    self->m_statistics.pluginProcessing.update(millis() - timestamp);
+    {
+        MutexGuard<MutexRecursive> guard(self->m_mutexUpdate);
+
+        /* Update statistics for active plugin processing time. */
+        self->m_statistics.pluginProcessing.update(millis() - timestamp);
+    }
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 
-    /* Wait until the physical update is ready to avoid flickering
-     * and artifacts on the display, because of e.g. webserver flash
-     * access.
-     */
-    timestampPhyUpdate = millis();
-    while ((false == Display::getInstance().isReady()) && (false == abort))
+#if (0 == CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
     {
+        uint32_t timestampPhyUpdate  = millis(); /* ms */
+        uint32_t durationPhyUpdate   = 0U;       /* ms */
+
+        /* Wait until the physical update is ready to avoid flickering
+         * and artifacts on the display, because of e.g. webserver flash
+         * access.
+         */
+        (void)Display::getInstance().waitUntilReady(MAX_PHY_UPDATE_TIME);
         durationPhyUpdate = millis() - timestampPhyUpdate;
 
-        if (MAX_LOOP_TIME <= durationPhyUpdate)
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
         {
-            abort = true;
+            MutexGuard<MutexRecursive> guard(self->m_mutexUpdate);
+
+            /* Update statistics for physical display update time. */
+            self->m_statistics.displayUpdate.update(durationPhyUpdate);
         }
+#else  /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+        (void)durationPhyUpdate;
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
     }
+#endif /* (0 == CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-    /* Update statistics for physical display update time. */
-    self->m_statistics.displayUpdate.update(durationPhyUpdate);
+    {
+        MutexGuard<MutexRecursive> guard(self->m_mutexUpdate);
 
-    /* Update statistics for total processing time. */
-    self->m_statistics.total.update(self->m_statistics.pluginProcessing.getCurrent() + self->m_statistics.displayUpdate.getCurrent());
+        /* Update statistics for total processing time. */
+        self->m_statistics.total.update(self->m_statistics.pluginProcessing.getCurrent() + self->m_statistics.displayUpdate.getCurrent());
 
-    if (true == self->m_statisticsLogTimer.isTimeout())
-    {
-        LOG_DEBUG("Refresh period   : min %2u avg %2u max %2u",
-            self->m_statistics.refreshPeriod.getMin(),
-            self->m_statistics.refreshPeriod.getAvg(),
-            self->m_statistics.refreshPeriod.getMax());
-
-        LOG_DEBUG("Plugin processing: min %2u avg %2u max %2u",
-            self->m_statistics.pluginProcessing.getMin(),
-            self->m_statistics.pluginProcessing.getAvg(),
-            self->m_statistics.pluginProcessing.getMax());
-
-        LOG_DEBUG("Display update   : min %2u avg %2u max %2u",
-            self->m_statistics.displayUpdate.getMin(),
-            self->m_statistics.displayUpdate.getAvg(),
-            self->m_statistics.displayUpdate.getMax());
-
-        LOG_DEBUG("Total            : min %2u avg %2u max %2u",
-            self->m_statistics.total.getMin(),
-            self->m_statistics.total.getAvg(),
-            self->m_statistics.total.getMax());
-
-        /* Reset the statistics to get a new min./max. determination. */
-        self->m_statistics.pluginProcessing.reset();
-        self->m_statistics.displayUpdate.reset();
-        self->m_statistics.total.reset();
-        self->m_statistics.refreshPeriod.reset();
-
-        self->m_statisticsLogTimer.restart();
+        if (true == self->m_statisticsLogTimer.isTimeout())
+        {
+            LOG_DEBUG("Refresh period   : min %2u avg %2u max %2u",
+                self->m_statistics.refreshPeriod.getMin(),
+                self->m_statistics.refreshPeriod.getAvg(),
+                self->m_statistics.refreshPeriod.getMax());
+
+            LOG_DEBUG("Plugin processing: min %2u avg %2u max %2u",
+                self->m_statistics.pluginProcessing.getMin(),
+                self->m_statistics.pluginProcessing.getAvg(),
+                self->m_statistics.pluginProcessing.getMax());
+
+            LOG_DEBUG("Display update   : min %2u avg %2u max %2u",
+                self->m_statistics.displayUpdate.getMin(),
+                self->m_statistics.displayUpdate.getAvg(),
+                self->m_statistics.displayUpdate.getMax());
+
+            LOG_DEBUG("Total            : min %2u avg %2u max %2u",
+                self->m_statistics.total.getMin(),
+                self->m_statistics.total.getAvg(),
+                self->m_statistics.total.getMax());
+
+            /* Reset the statistics to get a new min./max. determination. */
+            self->m_statistics.pluginProcessing.reset();
+            self->m_statistics.displayUpdate.reset();
+            self->m_statistics.total.reset();
+            self->m_statistics.refreshPeriod.reset();
+
+            self->m_statisticsLogTimer.restart();
+        }
     }
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 
     /* Calculate overall duration */
     duration = millis() - timestamp;
 
+#if (0 != CONFIG_DISPLAY_MGR_EVENT_DRIVEN)
+    /* Sleep until the next display refresh is required or the update
+     * task is woken up earlier, because the display content changed.
+     */
+    (void)Task<DisplayMgr>::waitForNotification(self->m_updateDelay - (duration % self->m_updateDelay));
+#else  /* (0 != CONFIG_DISPLAY_MGR_EVENT_DRIVEN) */
     /* Updating the display shall take place in aquidistant intervals. */
     delay(UPDATE_TASK_PERIOD - (duration % UPDATE_TASK_PERIOD));
+#endif /* (0 != CONFIG_DISPLAY_MGR_EVENT_DRIVEN) */
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
+    {
+        MutexGuard<MutexRecursive> guard(self->m_mutexUpdate);
+
+        self->m_statistics.refreshPeriod.update(millis() - self->m_timestampLastUpdate);
+        self->m_timestampLastUpdate = millis();
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+}
+
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+
+bool DisplayMgr::present()
+{
+    bool isPresented = false;
+
+    if (true == m_tripleFrameBuffer.acquireFrontBuffer())
+    {
+        IDisplay&                  display = Display::getInstance();
+        MutexGuard<MutexRecursive> guard(m_mutexDisplay);
+
+        /* The display copies only the pixels, which changed since the last
+         * presented frame, into its own buffer.
+         */
+        display.drawBitmap(0, 0, m_tripleFrameBuffer.getFrontBuffer());
+
+        /* Latch display buffer. */
+        display.show();
+
+        /* Wait until the physical update is ready to avoid flickering
+         * and artifacts on the display, because of e.g. webserver flash
+         * access.
+         */
+        (void)display.waitUntilReady(MAX_PHY_UPDATE_TIME);
+
+        isPresented = true;
+    }
 
+    return isPresented;
+}
+
+void DisplayMgr::presentTask(DisplayMgr* self)
+{
+    /* Sleep until the update task provides a new frame. */
+    if (true == Task<DisplayMgr>::waitForNotification(UPDATE_TASK_MAX_PERIOD))
+    {
+        uint32_t timestamp = millis(); /* ms */
+
+        if (true == self->present())
+        {
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-    self->m_statistics.refreshPeriod.update(millis() - self->m_timestampLastUpdate);
-    self->m_timestampLastUpdate = millis();
+            MutexGuard<MutexRecursive> guard(self->m_mutexUpdate);
+
+            /* Update statistics for physical display update time. */
+            self->m_statistics.displayUpdate.update(millis() - timestamp);
+#else  /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+            (void)timestamp;
 #endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+        }
+    }
 }
 
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
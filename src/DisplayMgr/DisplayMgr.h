@@ -41,6 +41,16 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_DISPLAY_MGR_EVENT_DRIVEN
+/** Event driven display refresh default configuration. */
+#define CONFIG_DISPLAY_MGR_EVENT_DRIVEN 0
+#endif
+
+#ifndef CONFIG_DISPLAY_MGR_TRIPLE_BUFFER
+/** Triple buffering with asynchronous frame presentation default configuration. */
+#define CONFIG_DISPLAY_MGR_TRIPLE_BUFFER 0
+#endif
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -56,6 +66,11 @@
 #include "SlotList.h"
 #include "FadeEffectController.h"
 #include "DoubleFrameBuffer.h"
+#include "FrameSnapshot.h"
+
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+#include "TripleFrameBuffer.h"
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
 #include <StatisticValue.hpp>
@@ -352,14 +367,34 @@ public:
      */
     bool setSlotDuration(uint8_t slotId, uint32_t duration, bool store = true);
 
+    /**
+     * Register a reader, which calls getFBCopy().
+     * While at least one reader is registered, every completed frame is
+     * copied to a snapshot, so getFBCopy() doesn't access the display.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool registerFBCopyReader();
+
+    /**
+     * Unregister a reader, which was registered by registerFBCopyReader().
+     */
+    void unregisterFBCopyReader();
+
     /**
      * Get access to copy of framebuffer.
+     * The copy is taken from the snapshot of the latest completed frame,
+     * therefore the caller shall be registered as reader.
+     * If no frame is published yet after the registration, it will wait
+     * for the next completed frame at most FB_COPY_WAIT_TIME.
      *
      * @param[out] fb       Pointer to framebuffer copy
      * @param[out] length   Number of elements in the framebuffer copy
      * @param[out] slotId   Id of slot, from which the copy was taken.
+     *
+     * @return If a frame is copied, it will return true otherwise false.
      */
-    void getFBCopy(uint32_t* fb, size_t length, uint8_t* slotId);
+    bool getFBCopy(uint32_t* fb, size_t length, uint8_t* slotId);
 
     /**
      * Get max. number of display slots, which can be used for plugins.
@@ -423,6 +458,43 @@ public:
      */
     static const uint8_t INDICATOR_ID_NETWORK = 0U;
 
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
+
+    /**
+     * A collection of statistics, which are interesting for debugging purposes.
+     * All durations are in ms.
+     */
+    struct Statistics
+    {
+        StatisticValue<uint32_t, 0U, 10U> pluginProcessing;
+        StatisticValue<uint32_t, 0U, 10U> displayUpdate;
+        StatisticValue<uint32_t, 0U, 10U> total;
+        StatisticValue<uint32_t, 0U, 10U> refreshPeriod;
+    };
+
+    /**
+     * Get the display refresh statistics of the last statistics log period.
+     *
+     * @param[out] statistics   Display refresh statistics
+     */
+    void getStatistics(Statistics& statistics) const;
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+
+    /**
+     * Get the timing statistics of the plugin in the slot.
+     *
+     * @param[in]  slotId           Slot id
+     * @param[out] slotStatistics   Slot statistics
+     *
+     * @return If the slot id is valid, it will return true otherwise false.
+     */
+    bool getSlotStatistics(uint8_t slotId, SlotStatistics& slotStatistics) const;
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+
 private:
 
     /** The process task stack size in bytes */
@@ -443,24 +515,71 @@ private:
     /** The update task period in ms. */
     static const uint32_t UPDATE_TASK_PERIOD       = 20U;
 
+    /**
+     * The max. update task period in ms, used in event driven mode if the
+     * display content doesn't change.
+     */
+    static const uint32_t UPDATE_TASK_MAX_PERIOD   = 1000U;
+
+    /**
+     * Observe the physical display refresh and limit the duration to 70% of
+     * the update task period.
+     */
+    static const uint32_t MAX_PHY_UPDATE_TIME      = (UPDATE_TASK_PERIOD * 7U) / 10U;
+
+    /** Max. time in ms, getFBCopy() waits for the first frame published to the snapshot. */
+    static const uint32_t FB_COPY_WAIT_TIME        = 5U * UPDATE_TASK_PERIOD;
+
+    /** Period in ms, getFBCopy() checks for the first frame published to the snapshot. */
+    static const uint32_t FB_COPY_POLL_PERIOD      = 5U;
+
     /** The update task shall run on the MCU core with less load. */
     static const BaseType_t UPDATE_TASK_RUN_CORE   = tskNO_AFFINITY;
 
     /** The update task priority shall be higher than the other application tasks. */
     static const UBaseType_t UPDATE_TASK_PRIORITY  = 4U;
 
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+
+    /** The present task stack size in bytes */
+    static const uint32_t PRESENT_TASK_STACK_SIZE   = 3072U;
+
+    /** The present task shall run on the MCU core with less load, in parallel to the update task. */
+    static const BaseType_t PRESENT_TASK_RUN_CORE   = tskNO_AFFINITY;
+
+    /** The present task priority shall be equal to the update task priority. */
+    static const UBaseType_t PRESENT_TASK_PRIORITY  = UPDATE_TASK_PRIORITY;
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+
     /** Mutex to protect concurrent access through the public interface. */
     mutable MutexRecursive m_mutexInterf;
 
     /** Mutex to protect the display update against concurrent access. */
     mutable MutexRecursive m_mutexUpdate;
 
+    /** Mutex to protect the physical display against concurrent access. */
+    mutable MutexRecursive m_mutexDisplay;
+
     /** Process task */
     Task<DisplayMgr> m_processTask;
 
     /** Update task */
     Task<DisplayMgr> m_updateTask;
 
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+
+    /** Present task */
+    Task<DisplayMgr> m_presentTask;
+
+    /** Triple framebuffer, which decouples the frame composition from the presentation. */
+    TripleFrameBuffer m_tripleFrameBuffer;
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
+
+    /** Snapshot of the latest completed frame, which is read by getFBCopy() while a reader is registered. */
+    FrameSnapshot m_frameSnapshot;
+
     /** List of all slots with their connected plugins. */
     SlotList m_slotList;
 
@@ -480,21 +599,11 @@ private:
     FadeEffectController m_fadeEffectController; /**< Fade effect controller. */
     bool                 m_isNetworkConnected;   /**< Is a network connection established? */
     IndicatorViewBase    m_indicatorView;        /**< Indicator view shown as overlay to indicate user defined states. */
+    uint32_t             m_updateDelay;          /**< Duration in ms until the next display refresh is required. */
 
 
 #if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
 
-    /**
-     * A collection of statistics, which are interesting for debugging purposes.
-     */
-    struct Statistics
-    {
-        StatisticValue<uint32_t, 0U, 10U> pluginProcessing;
-        StatisticValue<uint32_t, 0U, 10U> displayUpdate;
-        StatisticValue<uint32_t, 0U, 10U> total;
-        StatisticValue<uint32_t, 0U, 10U> refreshPeriod;
-    };
-
     /** Statistics log period in ms. */
     static const uint32_t STATISTICS_LOG_PERIOD = 4000U; /* [ms] */
     Statistics            m_statistics;                  /**< Statistics data. */
@@ -508,6 +617,21 @@ private:
      */
     DisplayMgr();
 
+    /**
+     * Determine the duration until the next display refresh is required.
+     * It considers a running fade effect and the selected plugin.
+     * Protect it with the update mutex!
+     *
+     * @return Duration in ms.
+     */
+    uint32_t calcUpdateDelay() const;
+
+    /**
+     * Wake up the update task immediately, if it waits longer than the
+     * required display refresh delay. Protect it with the update mutex!
+     */
+    void requestUpdate();
+
     /**
      * Destroys the display manager.
      */
@@ -564,6 +688,25 @@ private:
      * @param[in] self Display manager instance.
      */
     static void updateTask(DisplayMgr* self);
+
+#if (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER)
+
+    /**
+     * Present the latest composed frame on the physical display.
+     *
+     * @return If a frame was presented, it will return true otherwise false.
+     */
+    bool present(void);
+
+    /**
+     * Display present task is responsible to transfer the composed frames
+     * to the physical display, in parallel to the frame composition.
+     *
+     * @param[in] self Display manager instance.
+     */
+    static void presentTask(DisplayMgr* self);
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_TRIPLE_BUFFER) */
 };
 
 /******************************************************************************
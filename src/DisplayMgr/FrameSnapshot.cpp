@@ -0,0 +1,248 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   FrameSnapshot.cpp
+ * @brief  Frame snapshot
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "FrameSnapshot.h"
+
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool FrameSnapshot::create(uint16_t width, uint16_t height)
+{
+    bool isSuccessful = false;
+
+    release();
+
+    if ((0U < width) &&
+        (0U < height) &&
+        (true == m_mutex.create()))
+    {
+        m_width      = width;
+        m_height     = height;
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+void FrameSnapshot::release()
+{
+    if (nullptr != m_buffer)
+    {
+        delete[] m_buffer;
+        m_buffer = nullptr;
+    }
+
+    m_width       = 0U;
+    m_height      = 0U;
+    m_readers     = 0U;
+    m_isPublished = false;
+    m_mutex.destroy();
+}
+
+bool FrameSnapshot::registerReader()
+{
+    bool isSuccessful = false;
+
+    if (true == m_mutex.take(portMAX_DELAY))
+    {
+        if (nullptr == m_buffer)
+        {
+            size_t length = static_cast<size_t>(m_width) * m_height;
+
+            if (0U < length)
+            {
+                m_buffer      = new (std::nothrow) uint32_t[length];
+                m_isPublished = false;
+            }
+        }
+
+        if (nullptr != m_buffer)
+        {
+            ++m_readers;
+            isSuccessful = true;
+        }
+
+        (void)m_mutex.give();
+    }
+
+    return isSuccessful;
+}
+
+void FrameSnapshot::unregisterReader()
+{
+    if (true == m_mutex.take(portMAX_DELAY))
+    {
+        if (0U < m_readers)
+        {
+            --m_readers;
+
+            if ((0U == m_readers) &&
+                (nullptr != m_buffer))
+            {
+                delete[] m_buffer;
+                m_buffer      = nullptr;
+                m_isPublished = false;
+            }
+        }
+
+        (void)m_mutex.give();
+    }
+}
+
+void FrameSnapshot::publish(const YAGfx& gfx, uint8_t slotId)
+{
+    /* Never wait for a reader, the frame is skipped instead. */
+    if (true == m_mutex.take(0U))
+    {
+        if ((nullptr != m_buffer) &&
+            (m_width == gfx.getWidth()) &&
+            (m_height == gfx.getHeight()))
+        {
+            uint32_t* dst = m_buffer;
+            int16_t   y;
+
+            for (y = 0; y < m_height; ++y)
+            {
+                uint16_t     offset = 0U;
+                const Color* src    = gfx.getFrameBufferXAddr(0, y, m_width, offset);
+                int16_t      x;
+
+                /* Copy the whole row directly from the framebuffer if possible,
+                 * otherwise pixel by pixel.
+                 */
+                if (nullptr != src)
+                {
+                    for (x = 0; x < m_width; ++x)
+                    {
+                        *dst = *src;
+                        ++dst;
+                        src += offset;
+                    }
+                }
+                else
+                {
+                    for (x = 0; x < m_width; ++x)
+                    {
+                        *dst = gfx.getColor(x, y);
+                        ++dst;
+                    }
+                }
+            }
+
+            m_slotId      = slotId;
+            m_isPublished = true;
+        }
+
+        (void)m_mutex.give();
+    }
+}
+
+bool FrameSnapshot::read(uint32_t* fb, size_t length, uint8_t* slotId)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != fb) &&
+        (0U < length) &&
+        (true == m_mutex.take(portMAX_DELAY)))
+    {
+        if ((nullptr != m_buffer) &&
+            (true == m_isPublished))
+        {
+            size_t fbLength = static_cast<size_t>(m_width) * m_height;
+            size_t idx;
+
+            if (fbLength < length)
+            {
+                length = fbLength;
+            }
+
+            for (idx = 0U; idx < length; ++idx)
+            {
+                fb[idx] = m_buffer[idx];
+            }
+
+            if (nullptr != slotId)
+            {
+                *slotId = m_slotId;
+            }
+
+            isSuccessful = true;
+        }
+
+        (void)m_mutex.give();
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
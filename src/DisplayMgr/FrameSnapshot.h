@@ -0,0 +1,185 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   FrameSnapshot.h
+ * @brief  Frame snapshot
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup DISPLAY_MGR
+ *
+ * @{
+ */
+
+#ifndef FRAME_SNAPSHOT_H
+#define FRAME_SNAPSHOT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <YAGfx.h>
+#include <Mutex.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The frame snapshot holds a copy of the latest completed frame, which can
+ * be read by other tasks without accessing the display.
+ *
+ * The snapshot buffer is only allocated and published, while at least one
+ * reader is registered. It is protected by a mutex, so it is not lock-free.
+ * But the writer never waits for it: It only tries to take the mutex and
+ * skips the frame, if a reader copies the snapshot meanwhile. Only the
+ * readers wait, at most for the duration of a single frame copy.
+ *
+ * The colors are stored in 24-bit RGB format.
+ */
+class FrameSnapshot
+{
+public:
+
+    /**
+     * Construct the frame snapshot.
+     */
+    FrameSnapshot() :
+        m_mutex(),
+        m_buffer(nullptr),
+        m_width(0U),
+        m_height(0U),
+        m_readers(0U),
+        m_isPublished(false),
+        m_slotId(0U)
+    {
+        /* Nothing to do */
+    }
+
+    /**
+     * Destruct the frame snapshot.
+     */
+    ~FrameSnapshot()
+    {
+        release();
+    }
+
+    /**
+     * Create the snapshot. The snapshot buffer is allocated by the first
+     * registered reader.
+     * It shall not be called, while the snapshot is used.
+     *
+     * @param[in] width     Width in pixels
+     * @param[in] height    Height in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t width, uint16_t height);
+
+    /**
+     * Release the snapshot.
+     * It shall not be called, while the snapshot is used.
+     */
+    void release();
+
+    /**
+     * Register a reader. The first reader allocates the snapshot buffer.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool registerReader();
+
+    /**
+     * Unregister a reader. The last reader releases the snapshot buffer.
+     */
+    void unregisterReader();
+
+    /**
+     * Publish a completed frame, if a reader is registered.
+     * Shall only be called by the single writer. The caller is responsible
+     * that the frame isn't changed during the copy, e.g. by holding the lock
+     * of the display.
+     *
+     * @param[in] gfx       Graphics, which contains the completed frame.
+     * @param[in] slotId    Id of slot, which rendered the frame.
+     */
+    void publish(const YAGfx& gfx, uint8_t slotId);
+
+    /**
+     * Copy the latest published frame.
+     *
+     * @param[out] fb       Framebuffer copy
+     * @param[in]  length   Number of elements in the framebuffer copy
+     * @param[out] slotId   Id of slot, from which the copy was taken. Optional, may be nullptr.
+     *
+     * @return If a frame is copied, it will return true otherwise false.
+     */
+    bool read(uint32_t* fb, size_t length, uint8_t* slotId);
+
+private:
+
+    Mutex     m_mutex;       /**< Protects the snapshot against concurrent access. */
+    uint32_t* m_buffer;      /**< Snapshot buffer with width * height colors, only allocated while a reader is registered. */
+    uint16_t  m_width;       /**< Width in pixels */
+    uint16_t  m_height;      /**< Height in pixels */
+    size_t    m_readers;     /**< Number of registered readers */
+    bool      m_isPublished; /**< Is a frame published to the snapshot buffer? */
+    uint8_t   m_slotId;      /**< Id of slot, which rendered the frame. */
+
+    /**
+     * Copy consturctor is not allowed.
+     *
+     * @param[in] other  Other instance, which to copy
+     */
+    FrameSnapshot(const FrameSnapshot& other)            = delete;
+
+    /**
+     * Assignment operator is not allowed.
+     *
+     * @param[in] other  Other instance, which to assign
+     *
+     * @return Reference to this instance
+     */
+    FrameSnapshot& operator=(const FrameSnapshot& other) = delete;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* FRAME_SNAPSHOT_H */
+
+/** @} */
\ No newline at end of file
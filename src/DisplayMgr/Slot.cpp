@@ -64,6 +64,10 @@ Slot::Slot() :
     m_duration(DURATION_DEFAULT),
     m_isLocked(false),
     m_isDisabled(false)
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+    ,
+    m_statistics()
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
 {
 }
 
@@ -75,6 +79,10 @@ Slot::Slot(const Slot& slot) :
     m_plugin(slot.m_plugin),
     m_duration(slot.m_duration),
     m_isLocked(slot.m_isLocked)
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+    ,
+    m_statistics(slot.m_statistics)
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
 {
 }
 
@@ -85,6 +93,10 @@ Slot& Slot::operator=(const Slot& slot)
         m_plugin    = slot.m_plugin;
         m_duration  = slot.m_duration;
         m_isLocked  = slot.m_isLocked;
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+        m_statistics = slot.m_statistics;
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
     }
 
     return *this;
@@ -118,6 +130,10 @@ bool Slot::setPlugin(IPluginMaintenance* plugin)
             m_plugin->setSlot(this);
         }
 
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+        m_statistics.reset();
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+
         status = true;
     }
 
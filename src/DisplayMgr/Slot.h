@@ -47,6 +47,7 @@
 #include <stdint.h>
 #include "IPluginMaintenance.hpp"
 #include "ISlotPlugin.hpp"
+#include "SlotStatistics.h"
 
 /******************************************************************************
  * Macros
@@ -169,6 +170,32 @@ public:
      */
     bool isDisabled() const;
 
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+
+    /**
+     * Get the timing statistics of the plugged in plugin.
+     * They are reset, every time a plugin is plugged in or removed.
+     *
+     * @return Slot statistics
+     */
+    SlotStatistics& getStatistics()
+    {
+        return m_statistics;
+    }
+
+    /**
+     * Get the timing statistics of the plugged in plugin.
+     * They are reset, every time a plugin is plugged in or removed.
+     *
+     * @return Slot statistics
+     */
+    const SlotStatistics& getStatistics() const
+    {
+        return m_statistics;
+    }
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+
     /** Default duration in ms */
     static const uint32_t DURATION_DEFAULT = 30000U;
 
@@ -178,6 +205,10 @@ private:
     uint32_t            m_duration;   /**< Duration in ms, how long the plugin shall be active. */
     bool                m_isLocked;   /**< Is slot locked or not. */
     bool                m_isDisabled; /**< Is slot disabled? */
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+    SlotStatistics      m_statistics; /**< Timing statistics of the plugged in plugin. */
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
 };
 
 /******************************************************************************
@@ -193,6 +193,18 @@ Slot* SlotList::getSlot(uint8_t slotId)
     return slot;
 }
 
+const Slot* SlotList::getSlot(uint8_t slotId) const
+{
+    const Slot* slot = nullptr;
+
+    if (true == isSlotIdValid(slotId))
+    {
+        slot = &m_slots[slotId];
+    }
+
+    return slot;
+}
+
 uint8_t SlotList::getEmptyUnlockedSlot()
 {
     uint8_t slotId = SLOT_ID_INVALID;
@@ -197,6 +197,15 @@ public:
      */
     Slot* getSlot(uint8_t slotId);
 
+    /**
+     * Get slot by the slot id.
+     *
+     * @param[in] slotId    The id of the slot.
+
+     * @return If slot is available, it will return it otherwise nullptr.
+     */
+    const Slot* getSlot(uint8_t slotId) const;
+
     /**
      * Get id of a empty and unlocked slot.
      * 
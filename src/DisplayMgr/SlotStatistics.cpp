@@ -0,0 +1,140 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   SlotStatistics.cpp
+ * @brief  Slot statistics
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "SlotStatistics.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Upper limits: 1 ms, 2 ms, 5 ms, 10 ms, 20 ms */
+const uint32_t SlotStatistics::HISTOGRAM_BIN_LIMITS[HISTOGRAM_BINS - 1U] = { 1000U, 2000U, 5000U, 10000U, 20000U };
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void SlotStatistics::reset()
+{
+    uint8_t bin;
+
+    m_processing.reset();
+    m_rendering.reset();
+
+    m_worstProcessing = 0U;
+    m_worstRendering  = 0U;
+    m_deadlineMisses  = 0U;
+    m_frames          = 0U;
+
+    for (bin = 0U; bin < HISTOGRAM_BINS; ++bin)
+    {
+        m_processingHistogram[bin] = 0U;
+        m_renderingHistogram[bin]  = 0U;
+    }
+}
+
+void SlotStatistics::updateProcessing(uint32_t duration)
+{
+    m_processing.update(duration);
+
+    if (m_worstProcessing < duration)
+    {
+        m_worstProcessing = duration;
+    }
+
+    addToHistogram(m_processingHistogram, duration);
+}
+
+void SlotStatistics::updateRendering(uint32_t duration, uint32_t deadline)
+{
+    m_rendering.update(duration);
+
+    if (m_worstRendering < duration)
+    {
+        m_worstRendering = duration;
+    }
+
+    if (deadline < duration)
+    {
+        ++m_deadlineMisses;
+    }
+
+    addToHistogram(m_renderingHistogram, duration);
+    ++m_frames;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void SlotStatistics::addToHistogram(uint32_t histogram[HISTOGRAM_BINS], uint32_t duration)
+{
+    uint8_t bin = 0U;
+
+    while (((HISTOGRAM_BINS - 1U) > bin) && (HISTOGRAM_BIN_LIMITS[bin] <= duration))
+    {
+        ++bin;
+    }
+
+    ++histogram[bin];
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
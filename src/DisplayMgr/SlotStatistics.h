@@ -0,0 +1,256 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   SlotStatistics.h
+ * @brief  Slot statistics
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup DISPLAY_MGR
+ *
+ * @{
+ */
+
+#ifndef SLOT_STATISTICS_H
+#define SLOT_STATISTICS_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS
+/** Plugin timing statistics per slot default configuration. */
+#define CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS 1
+#endif
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <StatisticValue.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Timing statistics of the plugin in a slot. It observes how long the plugin
+ * needs for processing and for rendering a frame. All durations are in us.
+ */
+class SlotStatistics
+{
+public:
+
+    /** Statistic value type, used for the plugin processing and rendering durations. */
+    typedef StatisticValue<uint32_t, 0U, 10U> Value;
+
+    /** Number of duration histogram bins. */
+    static const uint8_t HISTOGRAM_BINS = 6U;
+
+    /**
+     * Upper limits in us of the duration histogram bins.
+     * The last bin has no upper limit.
+     */
+    static const uint32_t HISTOGRAM_BIN_LIMITS[HISTOGRAM_BINS - 1U];
+
+    /**
+     * Constructs the slot statistics in initial state.
+     */
+    SlotStatistics() :
+        m_processing(),
+        m_rendering(),
+        m_worstProcessing(0U),
+        m_worstRendering(0U),
+        m_processingHistogram(),
+        m_renderingHistogram(),
+        m_deadlineMisses(0U),
+        m_frames(0U)
+    {
+    }
+
+    /**
+     * Destroys the slot statistics.
+     */
+    ~SlotStatistics()
+    {
+    }
+
+    /**
+     * Reset everything to get it back in initial state.
+     */
+    void reset();
+
+    /**
+     * Update the statistics with the duration of a plugin process() call.
+     *
+     * @param[in] duration  Duration in us
+     */
+    void updateProcessing(uint32_t duration);
+
+    /**
+     * Update the statistics with the duration of a plugin update() call,
+     * which renders a frame.
+     *
+     * @param[in] duration  Duration in us
+     * @param[in] deadline  Frame budget in us. A longer duration is counted as deadline miss.
+     */
+    void updateRendering(uint32_t duration, uint32_t deadline);
+
+    /**
+     * Get plugin processing statistics.
+     *
+     * @return Plugin processing statistics
+     */
+    const Value& getProcessing() const
+    {
+        return m_processing;
+    }
+
+    /**
+     * Get plugin rendering statistics.
+     *
+     * @return Plugin rendering statistics
+     */
+    const Value& getRendering() const
+    {
+        return m_rendering;
+    }
+
+    /**
+     * Get the worst plugin processing duration since the last reset.
+     *
+     * @return Duration in us
+     */
+    uint32_t getWorstProcessing() const
+    {
+        return m_worstProcessing;
+    }
+
+    /**
+     * Get the worst plugin rendering duration since the last reset.
+     *
+     * @return Duration in us
+     */
+    uint32_t getWorstRendering() const
+    {
+        return m_worstRendering;
+    }
+
+    /**
+     * Get number of plugin process() calls in the histogram bin.
+     *
+     * @param[in] bin   Histogram bin index
+     *
+     * @return Number of process() calls
+     */
+    uint32_t getProcessingHistogram(uint8_t bin) const
+    {
+        return getHistogramBin(m_processingHistogram, bin);
+    }
+
+    /**
+     * Get number of rendered frames in the histogram bin.
+     *
+     * @param[in] bin   Histogram bin index
+     *
+     * @return Number of frames
+     */
+    uint32_t getRenderingHistogram(uint8_t bin) const
+    {
+        return getHistogramBin(m_renderingHistogram, bin);
+    }
+
+    /**
+     * Get number of rendered frames, which exceeded the frame budget.
+     *
+     * @return Number of deadline misses
+     */
+    uint32_t getDeadlineMisses() const
+    {
+        return m_deadlineMisses;
+    }
+
+    /**
+     * Get number of rendered frames.
+     *
+     * @return Number of frames
+     */
+    uint32_t getFrames() const
+    {
+        return m_frames;
+    }
+
+private:
+
+    Value    m_processing;                          /**< Plugin processing durations. */
+    Value    m_rendering;                           /**< Plugin rendering durations. */
+    uint32_t m_worstProcessing;                     /**< Worst plugin processing duration in us. */
+    uint32_t m_worstRendering;                      /**< Worst plugin rendering duration in us. */
+    uint32_t m_processingHistogram[HISTOGRAM_BINS]; /**< Histogram of the plugin processing durations. */
+    uint32_t m_renderingHistogram[HISTOGRAM_BINS];  /**< Histogram of the plugin rendering durations. */
+    uint32_t m_deadlineMisses;                      /**< Number of frames, which exceeded the frame budget. */
+    uint32_t m_frames;                              /**< Number of rendered frames. */
+
+    /**
+     * Count the duration in the corresponding histogram bin.
+     *
+     * @param[in,out]   histogram   Histogram
+     * @param[in]       duration    Duration in us
+     */
+    static void addToHistogram(uint32_t histogram[HISTOGRAM_BINS], uint32_t duration);
+
+    /**
+     * Get the value of a histogram bin.
+     *
+     * @param[in] histogram Histogram
+     * @param[in] bin       Histogram bin index
+     *
+     * @return Value of the histogram bin. If the bin index is invalid, it will be 0.
+     */
+    static uint32_t getHistogramBin(const uint32_t histogram[HISTOGRAM_BINS], uint8_t bin)
+    {
+        uint32_t value = 0U;
+
+        if (HISTOGRAM_BINS > bin)
+        {
+            value = histogram[bin];
+        }
+
+        return value;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* SLOT_STATISTICS_H */
+
+/** @} */
\ No newline at end of file
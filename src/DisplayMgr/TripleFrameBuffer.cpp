@@ -0,0 +1,157 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TripleFrameBuffer.cpp
+ * @brief  Triple frame buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TripleFrameBuffer.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool TripleFrameBuffer::create(uint16_t width, uint16_t height)
+{
+    bool   isSuccessful = true;
+    size_t idx;
+
+    if (false == m_mutex.create())
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        for (idx = 0U; idx < FB_MAX; ++idx)
+        {
+            if (false == m_framebuffers[idx].create(width, height))
+            {
+                isSuccessful = false;
+                break;
+            }
+        }
+    }
+
+    if (false == isSuccessful)
+    {
+        release();
+    }
+    else
+    {
+        m_backIndex  = 0U;
+        m_readyIndex = 1U;
+        m_frontIndex = 2U;
+        m_isReady    = false;
+    }
+
+    return isSuccessful;
+}
+
+void TripleFrameBuffer::release()
+{
+    size_t idx;
+
+    for (idx = 0U; idx < FB_MAX; ++idx)
+    {
+        m_framebuffers[idx].release();
+    }
+
+    m_mutex.destroy();
+
+    m_backIndex  = 0U;
+    m_readyIndex = 1U;
+    m_frontIndex = 2U;
+    m_isReady    = false;
+}
+
+void TripleFrameBuffer::swapBackBuffer()
+{
+    MutexGuard<Mutex> guard(m_mutex);
+    size_t            tmpIndex = m_readyIndex;
+
+    m_readyIndex = m_backIndex;
+    m_backIndex  = tmpIndex;
+    m_isReady    = true;
+}
+
+bool TripleFrameBuffer::acquireFrontBuffer()
+{
+    bool              isAcquired = false;
+    MutexGuard<Mutex> guard(m_mutex);
+
+    if (true == m_isReady)
+    {
+        size_t tmpIndex = m_frontIndex;
+
+        m_frontIndex = m_readyIndex;
+        m_readyIndex = tmpIndex;
+        m_isReady    = false;
+        isAcquired   = true;
+    }
+
+    return isAcquired;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,183 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TripleFrameBuffer.h
+ * @brief  Triple frame buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup DISPLAY_MGR
+ *
+ * @{
+ */
+
+#ifndef TRIPLE_FRAME_BUFFER_H
+#define TRIPLE_FRAME_BUFFER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfxBitmap.h>
+#include <Mutex.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * This class provides a triple buffered framebuffer, which decouples the
+ * composition of a frame from its presentation on the physical display.
+ *
+ * The producer composes always into the back buffer and swaps it with the
+ * ready buffer, after the frame is complete. The consumer acquires the
+ * latest ready buffer as front buffer and presents it. Producer and consumer
+ * never block each other, except for the short buffer index swap. If the
+ * producer is faster than the consumer, not presented frames are dropped.
+ *
+ * The framebuffers memory is allocated dynamically.
+ */
+class TripleFrameBuffer
+{
+public:
+
+    /**
+     * Construct the triple framebuffer.
+     */
+    TripleFrameBuffer() :
+        m_mutex(),
+        m_framebuffers(),
+        m_backIndex(0U),
+        m_readyIndex(1U),
+        m_frontIndex(2U),
+        m_isReady(false)
+    {
+        /* Nothing to do */
+    }
+
+    /**
+     * Destruct the triple framebuffer.
+     */
+    ~TripleFrameBuffer()
+    {
+        /* Nothing to do */
+    }
+
+    /**
+     * Create framebuffers.
+     *
+     * @param[in] width     Width in pixels
+     * @param[in] height    Height in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t width, uint16_t height);
+
+    /**
+     * Release framebuffers.
+     */
+    void release();
+
+    /**
+     * Get the back buffer, which is exclusive owned by the producer.
+     *
+     * @return Back buffer
+     */
+    YAGfxDynamicBitmap& getBackBuffer()
+    {
+        return m_framebuffers[m_backIndex];
+    }
+
+    /**
+     * Mark the back buffer as complete and swap it with the ready buffer.
+     * Shall only be called by the producer.
+     */
+    void swapBackBuffer();
+
+    /**
+     * Acquire the latest complete frame as front buffer.
+     * Shall only be called by the consumer.
+     *
+     * @return If a new frame is available, it will return true otherwise false.
+     */
+    bool acquireFrontBuffer();
+
+    /**
+     * Get the front buffer, which is exclusive owned by the consumer.
+     *
+     * @return Front buffer
+     */
+    const YAGfxDynamicBitmap& getFrontBuffer() const
+    {
+        return m_framebuffers[m_frontIndex];
+    }
+
+private:
+
+    /**
+     * Max. number of frame buffers.
+     */
+    static const size_t FB_MAX = 3U;
+
+    Mutex               m_mutex;                /**< Mutex to protect the buffer swap. */
+    YAGfxDynamicBitmap  m_framebuffers[FB_MAX]; /**< Three framebuffers, which are used for triple buffering. */
+    size_t              m_backIndex;            /**< Index of the back buffer, owned by the producer. */
+    size_t              m_readyIndex;           /**< Index of the latest complete frame. */
+    size_t              m_frontIndex;           /**< Index of the front buffer, owned by the consumer. */
+    bool                m_isReady;              /**< Is a complete frame available, which is not presented yet? */
+
+    /**
+     * Copy consturctor is not allowed.
+     *
+     * @param[in] other  Other instance, which to copy
+     */
+    TripleFrameBuffer(const TripleFrameBuffer& other)            = delete;
+
+    /**
+     * Assignment operator is not allowed.
+     *
+     * @param[in] other  Other instance, which to assign
+     *
+     * @return Reference to this instance
+     */
+    TripleFrameBuffer& operator=(const TripleFrameBuffer& other) = delete;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* TRIPLE_FRAME_BUFFER_H */
+
+/** @} */
\ No newline at end of file
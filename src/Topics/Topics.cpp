@@ -37,6 +37,7 @@
 #include <SettingsService.h>
 #include <TopicHandlerService.h>
 #include <Util.h>
+#include <RestService.h>
 #include "DisplayMgr.h"
 #include "RestartMgr.h"
 #include "ButtonActions.h"
@@ -114,6 +115,16 @@ static bool hasDisplayStateChanged(const String& topic);
 static bool setDisplayState(const String& topic, const JsonObjectConst& value);
 static bool restart(const String& topic, const JsonObjectConst& value);
 
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+static void addStatisticValue(JsonObject value, const SlotStatistics::Value& statistic, uint32_t worst);
+static bool getDisplayStatistics(const String& topic, JsonObject& value);
+static bool hasDisplayStatisticsChanged(const String& topic);
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+
+static void addDurationValue(JsonObject value, const RestService::Duration& duration);
+static bool getRestStatistics(const String& topic, JsonObject& value);
+static bool hasRestStatisticsChanged(const String& topic);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -141,10 +152,14 @@ static String gDeviceId;
  *                 DISCOVERY-TOPIC = DISCOVERY-PREFIX/COMPONENT/NODE-ID/OBJECT-ID/config
  */
 static TopicElem gTopicList[] = {
-    /* ENTITY-ID    TOPIC       GET                 HAS-CHANGED             SET                 EXTRA-HA-FILE */
-    { "",           "button",   nullptr,            nullptr,                execButtonAction,   "/extra/button.json"  },
-    { "display",    "power",    getDisplayState,    hasDisplayStateChanged, setDisplayState,    "/extra/display.json" },
-    { "",           "restart",  nullptr,            nullptr,                restart,            "/extra/restart.json" }
+    /* ENTITY-ID    TOPIC           GET                     HAS-CHANGED                     SET                 EXTRA-HA-FILE */
+    { "",           "button",       nullptr,                nullptr,                        execButtonAction,   "/extra/button.json"  },
+    { "display",    "power",        getDisplayState,        hasDisplayStateChanged,         setDisplayState,    "/extra/display.json" },
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+    { "display",    "statistics",   getDisplayStatistics,   hasDisplayStatisticsChanged,    nullptr,            nullptr               },
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+    { "rest",       "statistics",   getRestStatistics,      hasRestStatisticsChanged,       nullptr,            nullptr               },
+    { "",           "restart",      nullptr,                nullptr,                        restart,            "/extra/restart.json" }
 };
 
 /* clang-format on */
@@ -154,6 +169,30 @@ static TopicElem gTopicList[] = {
  */
 static bool gLastDisplayOnState = false;
 
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+
+/**
+ * Display statistics publish period in ms.
+ */
+static const uint32_t DISPLAY_STATISTICS_PERIOD = SIMPLE_TIMER_SECONDS(10U);
+
+/**
+ * Timer used to publish the display statistics periodically.
+ */
+static SimpleTimer gDisplayStatisticsTimer;
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+
+/**
+ * REST request statistics publish period in ms.
+ */
+static const uint32_t REST_STATISTICS_PERIOD = SIMPLE_TIMER_SECONDS(10U);
+
+/**
+ * Timer used to publish the REST request statistics periodically.
+ */
+static SimpleTimer gRestStatisticsTimer;
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -404,3 +443,209 @@ static bool restart(const String& topic, const JsonObjectConst& value)
 
     return true;
 }
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS)
+
+/**
+ * Add statistic value in JSON format.
+ *
+ * @param[out]  value       JSON object, which to fill
+ * @param[in]   statistic   Statistic value
+ * @param[in]   worst       Worst value since last reset
+ */
+static void addStatisticValue(JsonObject value, const SlotStatistics::Value& statistic, uint32_t worst)
+{
+    value["min"]   = statistic.getMin();
+    value["avg"]   = statistic.getAvg();
+    value["max"]   = statistic.getMax();
+    value["worst"] = worst;
+}
+
+/**
+ * Get display statistics.
+ * The display refresh durations are in ms, the plugin durations per slot in us.
+ * The display refresh durations are only available, if the firmware is built
+ * with CONFIG_DISPLAY_MGR_ENABLE_STATISTICS.
+ *
+ * @param[in]   topic   Topic
+ * @param[out]  value   Value
+ *
+ * @return If successful, it will return true otherwise false.
+ */
+static bool getDisplayStatistics(const String& topic, JsonObject& value)
+{
+    DisplayMgr& displayMgr = DisplayMgr::getInstance();
+    JsonArray   jsonSlots  = value.createNestedArray("slots");
+    uint8_t     slotId;
+
+    UTIL_NOT_USED(topic);
+
+#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
+    {
+        DisplayMgr::Statistics statistics;
+        JsonObject             jsonRefresh = value.createNestedObject("refreshPeriod");
+        JsonObject             jsonDisplay = value.createNestedObject("displayUpdate");
+
+        displayMgr.getStatistics(statistics);
+
+        jsonRefresh["min"] = statistics.refreshPeriod.getMin();
+        jsonRefresh["avg"] = statistics.refreshPeriod.getAvg();
+        jsonRefresh["max"] = statistics.refreshPeriod.getMax();
+
+        jsonDisplay["min"] = statistics.displayUpdate.getMin();
+        jsonDisplay["avg"] = statistics.displayUpdate.getAvg();
+        jsonDisplay["max"] = statistics.displayUpdate.getMax();
+    }
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+
+    /* Only slots with an installed plugin are considered. */
+    for (slotId = 0U; slotId < displayMgr.getMaxSlots(); ++slotId)
+    {
+        IPluginMaintenance* plugin = displayMgr.getPluginInSlot(slotId);
+        SlotStatistics      slotStatistics;
+
+        if ((nullptr != plugin) &&
+            (true == displayMgr.getSlotStatistics(slotId, slotStatistics)))
+        {
+            JsonObject jsonSlot             = jsonSlots.createNestedObject();
+            JsonObject jsonUpdate           = jsonSlot.createNestedObject("update");
+            JsonObject jsonProcess          = jsonSlot.createNestedObject("process");
+            JsonArray  jsonUpdateHistogram  = jsonUpdate.createNestedArray("histogram");
+            JsonArray  jsonProcessHistogram = jsonProcess.createNestedArray("histogram");
+            uint8_t    bin;
+
+            jsonSlot["slotId"]         = slotId;
+            jsonSlot["uid"]            = plugin->getUID();
+            jsonSlot["name"]           = plugin->getName();
+
+            addStatisticValue(jsonUpdate, slotStatistics.getRendering(), slotStatistics.getWorstRendering());
+            addStatisticValue(jsonProcess, slotStatistics.getProcessing(), slotStatistics.getWorstProcessing());
+
+            for (bin = 0U; bin < SlotStatistics::HISTOGRAM_BINS; ++bin)
+            {
+                (void)jsonUpdateHistogram.add(slotStatistics.getRenderingHistogram(bin));
+                (void)jsonProcessHistogram.add(slotStatistics.getProcessingHistogram(bin));
+            }
+
+            jsonSlot["deadlineMisses"] = slotStatistics.getDeadlineMisses();
+            jsonSlot["frames"]         = slotStatistics.getFrames();
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Have the display statistics changed?
+ * They change permanently, therefore they are published periodically.
+ *
+ * @param[in]   topic   Topic
+ *
+ * @return If the display statistics shall be published, it will return true otherwise false.
+ */
+static bool hasDisplayStatisticsChanged(const String& topic)
+{
+    bool hasChanged = false;
+
+    UTIL_NOT_USED(topic);
+
+    if (false == gDisplayStatisticsTimer.isTimerRunning())
+    {
+        gDisplayStatisticsTimer.start(DISPLAY_STATISTICS_PERIOD);
+    }
+    else if (true == gDisplayStatisticsTimer.isTimeout())
+    {
+        gDisplayStatisticsTimer.restart();
+        hasChanged = true;
+    }
+    else
+    {
+        ;
+    }
+
+    return hasChanged;
+}
+
+#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_SLOT_STATISTICS) */
+
+/**
+ * Add duration statistic value in JSON format.
+ *
+ * @param[out]  value       JSON object, which to fill
+ * @param[in]   duration    Duration statistic value in ms
+ */
+static void addDurationValue(JsonObject value, const RestService::Duration& duration)
+{
+    value["min"] = duration.getMin();
+    value["avg"] = duration.getAvg();
+    value["max"] = duration.getMax();
+}
+
+/**
+ * Get REST request statistics per plugin.
+ * The queue wait and latency durations are in ms.
+ *
+ * @param[in]   topic   Topic
+ * @param[out]  value   Value
+ *
+ * @return If successful, it will return true otherwise false.
+ */
+static bool getRestStatistics(const String& topic, JsonObject& value)
+{
+    std::vector<RestService::Statistics> statistics;
+    JsonArray                            jsonPlugins = value.createNestedArray("plugins");
+
+    UTIL_NOT_USED(topic);
+
+    RestService::getInstance().getStatistics(statistics);
+
+    for (const RestService::Statistics& userStatistics : statistics)
+    {
+        JsonObject jsonPlugin = jsonPlugins.createNestedObject();
+
+        if (RestService::UNKNOWN_UID != userStatistics.uid)
+        {
+            jsonPlugin["uid"] = userStatistics.uid;
+        }
+
+        jsonPlugin["requests"] = userStatistics.requests;
+        jsonPlugin["failed"]   = userStatistics.failed;
+        jsonPlugin["timeouts"] = userStatistics.timeouts;
+
+        addDurationValue(jsonPlugin.createNestedObject("queueWait"), userStatistics.queueWait);
+        addDurationValue(jsonPlugin.createNestedObject("latency"), userStatistics.latency);
+    }
+
+    return true;
+}
+
+/**
+ * Have the REST request statistics changed?
+ * They are published periodically.
+ *
+ * @param[in]   topic   Topic
+ *
+ * @return If the REST request statistics shall be published, it will return true otherwise false.
+ */
+static bool hasRestStatisticsChanged(const String& topic)
+{
+    bool hasChanged = false;
+
+    UTIL_NOT_USED(topic);
+
+    if (false == gRestStatisticsTimer.isTimerRunning())
+    {
+        gRestStatisticsTimer.start(REST_STATISTICS_PERIOD);
+    }
+    else if (true == gRestStatisticsTimer.isTimeout())
+    {
+        gRestStatisticsTimer.restart();
+        hasChanged = true;
+    }
+    else
+    {
+        ;
+    }
+
+    return hasChanged;
+}
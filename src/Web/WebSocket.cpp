@@ -38,6 +38,7 @@
 #include "WsCmdAlias.h"
 #include "WsCmdBrightness.h"
 #include "WsCmdButton.h"
+#include "WsCmdDispStream.h"
 #include "WsCmdEffect.h"
 #include "WsCmdGetDisp.h"
 #include "WsCmdInstall.h"
@@ -50,6 +51,7 @@
 #include "WsCmdSlot.h"
 #include "WsCmdSlots.h"
 #include "WsCmdUninstall.h"
+#include "WsDisplayStream.h"
 
 #include <Logging.h>
 #include <Util.h>
@@ -124,6 +126,9 @@ static WsCmdEffect gWsCmdEffect;
 /** Websocket get/set plugin alias name command */
 static WsCmdAlias gWsCmdAlias;
 
+/** Websocket start/stop display stream command */
+static WsCmdDispStream gWsCmdDispStream;
+
 /** Websocket command list */
 static WsCmd* gWsCommands[] = {
     &gWsCmdGetDisp,
@@ -142,7 +147,8 @@ static WsCmd* gWsCommands[] = {
 #endif /* CONFIG_FEATURE_IPERF == 1 */
     &gWsCmdButton,
     &gWsCmdEffect,
-    &gWsCmdAlias
+    &gWsCmdAlias,
+    &gWsCmdDispStream
 };
 
 /******************************************************************************
@@ -234,6 +240,9 @@ void WebSocketSrv::process()
                 msg = nullptr;
             }
         }
+
+        /* Push the display content to the subscribed clients. */
+        WsDisplayStream::getInstance().process(m_webSocket);
     }
 }
 
@@ -295,6 +304,8 @@ void WebSocketSrv::onConnect(AsyncWebSocket* server, AsyncWebSocketClient* clien
 void WebSocketSrv::onDisconnect(AsyncWebSocket* server, AsyncWebSocketClient* client)
 {
     LOG_INFO("ws[%s][%u] Client disconnected.", server->url(), client->id());
+
+    WsDisplayStream::getInstance().unsubscribe(client->id());
 }
 
 void WebSocketSrv::onPong(AsyncWebSocket* server, AsyncWebSocketClient* client, uint8_t* data, size_t len)
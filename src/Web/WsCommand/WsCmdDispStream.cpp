@@ -0,0 +1,147 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   WsCmdDispStream.cpp
+ * @brief  Websocket command to start/stop the display stream
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WsCmdDispStream.h"
+#include "WsDisplayStream.h"
+
+#include <Util.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void WsCmdDispStream::execute(AsyncWebSocket* server, uint32_t clientId)
+{
+    if (nullptr == server)
+    {
+        return;
+    }
+
+    /* Any error happended? */
+    if (true == m_isError)
+    {
+        sendNegativeResponse(server, clientId, "\"Parameter invalid.\"");
+    }
+    else
+    {
+        WsDisplayStream& displayStream = WsDisplayStream::getInstance();
+        bool             isSuccessful  = true;
+
+        /* Start/stop the stream? */
+        if (0U < m_cnt)
+        {
+            if (0U == m_period)
+            {
+                displayStream.unsubscribe(clientId);
+            }
+            else
+            {
+                isSuccessful = displayStream.subscribe(clientId, m_period);
+            }
+        }
+
+        if (false == isSuccessful)
+        {
+            sendNegativeResponse(server, clientId, "\"No stream available.\"");
+        }
+        else
+        {
+            String msg;
+
+            preparePositiveResponse(msg);
+
+            msg += displayStream.getPeriod(clientId);
+
+            sendResponse(server, clientId, msg);
+        }
+    }
+
+    m_cnt     = 0U;
+    m_period  = 0U;
+    m_isError = false;
+}
+
+void WsCmdDispStream::setPar(const char* par)
+{
+    if (0U == m_cnt)
+    {
+        if (false == Util::strToUInt32(par, m_period))
+        {
+            m_isError = true;
+        }
+
+        ++m_cnt;
+    }
+    else
+    {
+        m_isError = true;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -80,15 +80,28 @@ void WsCmdGetDisp::execute(AsyncWebSocket* server, uint32_t clientId)
     {
         constexpr size_t fbLength    = CONFIG_LED_MATRIX_WIDTH * CONFIG_LED_MATRIX_HEIGHT;
         uint32_t*        framebuffer = new (std::nothrow) uint32_t[fbLength];
+        uint8_t          slotId      = SlotList::SLOT_ID_INVALID;
+        bool             isCopied    = false;
+
+        /* The display manager publishes the frames only for registered readers,
+         * therefore the command registers itself for the single copy.
+         */
+        if ((nullptr != framebuffer) &&
+            (true == DisplayMgr::getInstance().registerFBCopyReader()))
+        {
+            isCopied = DisplayMgr::getInstance().getFBCopy(framebuffer, fbLength, &slotId);
+            DisplayMgr::getInstance().unregisterFBCopyReader();
+        }
 
-        if (nullptr == framebuffer)
+        if (false == isCopied)
         {
+            delete[] framebuffer;
+
             sendNegativeResponse(server, clientId, "\"Internal error.\"");
         }
         else
         {
             String         msg;
-            uint8_t        slotId = SlotList::SLOT_ID_INVALID;
 
             uint32_t       lastColor;          /* The color that started a repeat sequence.   */
             uint32_t       color      = 0U;    /* Actual color in read order.                 */
@@ -97,8 +110,6 @@ void WsCmdGetDisp::execute(AsyncWebSocket* server, uint32_t clientId)
             const uint32_t REPEAT_MAX = 0xFFU; /* Maximum repeat color counter value.         */
             GetDispState   state      = STATE_GETDISP_COLLECT; /* Frame buffer reading state. */
 
-            DisplayMgr::getInstance().getFBCopy(framebuffer, fbLength, &slotId);
-
             preparePositiveResponse(msg);
             msg += slotId;
 
@@ -0,0 +1,403 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   WsDisplayStream.cpp
+ * @brief  Websocket display stream
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WsDisplayStream.h"
+#include "DisplayMgr.h"
+#include "SlotList.h"
+
+#include <Display.h>
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Number of pixels in the framebuffer. */
+static const size_t FB_LENGTH = CONFIG_LED_MATRIX_WIDTH * CONFIG_LED_MATRIX_HEIGHT;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+bool WsDisplayStream::subscribe(uint32_t clientId, uint32_t period)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+    Subscriber*       subscriber = nullptr;
+    size_t            idx;
+    bool              isSuccessful = false;
+
+    /* Already subscribed? Otherwise use a free one. */
+    for (idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+    {
+        Subscriber& candidate = m_subscribers[idx];
+
+        if (true == candidate.isUsed)
+        {
+            if (clientId == candidate.clientId)
+            {
+                subscriber = &candidate;
+                break;
+            }
+        }
+        else if (nullptr == subscriber)
+        {
+            subscriber = &candidate;
+        }
+        else
+        {
+            ;
+        }
+    }
+
+    if (nullptr == subscriber)
+    {
+        LOG_WARNING("Max. number of display stream clients reached.");
+    }
+    else
+    {
+        /* The framebuffer copy is shared by all subscribers. */
+        if (nullptr == m_framebuffer)
+        {
+            m_framebuffer = new (std::nothrow) uint32_t[FB_LENGTH];
+
+            /* The display manager provides the frames only for registered readers. */
+            if ((nullptr != m_framebuffer) &&
+                (false == DisplayMgr::getInstance().registerFBCopyReader()))
+            {
+                delete[] m_framebuffer;
+                m_framebuffer = nullptr;
+            }
+        }
+
+        if (nullptr == m_framebuffer)
+        {
+            LOG_ERROR("Couldn't allocate display stream framebuffer.");
+        }
+        else
+        {
+            if (false == subscriber->isUsed)
+            {
+                subscriber->isUsed    = true;
+                subscriber->clientId  = clientId;
+                subscriber->timestamp = millis();
+                subscriber->hasFrame  = false;
+                subscriber->frameHash = 0U;
+            }
+
+            subscriber->period = (MIN_PERIOD > period) ? MIN_PERIOD : period;
+
+            isSuccessful       = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void WsDisplayStream::unsubscribe(uint32_t clientId)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+    size_t            idx;
+
+    for (idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+    {
+        Subscriber& subscriber = m_subscribers[idx];
+
+        if ((true == subscriber.isUsed) &&
+            (clientId == subscriber.clientId))
+        {
+            subscriber.isUsed = false;
+        }
+    }
+
+    releaseFramebuffer();
+}
+
+uint32_t WsDisplayStream::getPeriod(uint32_t clientId)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+    size_t            idx;
+    uint32_t          period = 0U;
+
+    for (idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+    {
+        const Subscriber& subscriber = m_subscribers[idx];
+
+        if ((true == subscriber.isUsed) &&
+            (clientId == subscriber.clientId))
+        {
+            period = subscriber.period;
+            break;
+        }
+    }
+
+    return period;
+}
+
+void WsDisplayStream::process(AsyncWebSocket& server)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+    uint32_t          now    = millis();
+    uint8_t           slotId = SlotList::SLOT_ID_INVALID;
+
+    /* If no frame is available, it is tried again with the next call. */
+    if ((nullptr != m_framebuffer) &&
+        (true == isAnySubscriberDue(now)) &&
+        (true == DisplayMgr::getInstance().getFBCopy(m_framebuffer, FB_LENGTH, &slotId)))
+    {
+        uint32_t                   frameHash    = calcFrameHash(FB_LENGTH, slotId);
+        bool                       isAnyRemoved = false;
+        AsyncWebSocketSharedBuffer frame;
+        size_t                     idx;
+
+        for (idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+        {
+            Subscriber& subscriber = m_subscribers[idx];
+
+            if ((true == subscriber.isUsed) &&
+                (subscriber.period <= (now - subscriber.timestamp)))
+            {
+                AsyncWebSocketClient* client = server.client(subscriber.clientId);
+
+                subscriber.timestamp         = now;
+
+                /* A client, which is gone without unsubscribing, is removed. */
+                if (nullptr == client)
+                {
+                    subscriber.isUsed = false;
+                    isAnyRemoved      = true;
+                }
+                /* Send only a changed frame. */
+                else if ((false == subscriber.hasFrame) ||
+                         (frameHash != subscriber.frameHash))
+                {
+                    /* If the client can't keep up, the frame is skipped and
+                     * it will get a newer one later. This limits the heap
+                     * consumption by the websocket message queues.
+                     */
+                    if (false == client->queueIsFull())
+                    {
+                        /* Encode only once, the frame is shared between all clients. */
+                        if (nullptr == frame)
+                        {
+                            frame = std::make_shared<std::vector<uint8_t>>();
+                            encodeFrame(*frame, FB_LENGTH, slotId);
+                        }
+
+                        client->binary(frame);
+
+                        subscriber.hasFrame  = true;
+                        subscriber.frameHash = frameHash;
+                    }
+                }
+                else
+                {
+                    ;
+                }
+            }
+        }
+
+        if (true == isAnyRemoved)
+        {
+            releaseFramebuffer();
+        }
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+WsDisplayStream::WsDisplayStream() :
+    m_mutex(),
+    m_subscribers(),
+    m_framebuffer(nullptr)
+{
+    (void)m_mutex.create();
+}
+
+WsDisplayStream::~WsDisplayStream()
+{
+    if (nullptr != m_framebuffer)
+    {
+        delete[] m_framebuffer;
+        m_framebuffer = nullptr;
+    }
+
+    m_mutex.destroy();
+}
+
+bool WsDisplayStream::isAnySubscriberDue(uint32_t now)
+{
+    size_t idx;
+    bool   isDue = false;
+
+    for (idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+    {
+        const Subscriber& subscriber = m_subscribers[idx];
+
+        if ((true == subscriber.isUsed) &&
+            (subscriber.period <= (now - subscriber.timestamp)))
+        {
+            isDue = true;
+            break;
+        }
+    }
+
+    return isDue;
+}
+
+void WsDisplayStream::releaseFramebuffer()
+{
+    size_t idx;
+    bool   isAnyUsed = false;
+
+    for (idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+    {
+        isAnyUsed = isAnyUsed || m_subscribers[idx].isUsed;
+    }
+
+    if ((false == isAnyUsed) &&
+        (nullptr != m_framebuffer))
+    {
+        delete[] m_framebuffer;
+        m_framebuffer = nullptr;
+
+        DisplayMgr::getInstance().unregisterFBCopyReader();
+    }
+}
+
+uint32_t WsDisplayStream::calcFrameHash(size_t length, uint8_t slotId) const
+{
+    const uint32_t FNV_OFFSET_BASIS = 2166136261U;
+    const uint32_t FNV_PRIME        = 16777619U;
+    uint32_t       hash             = FNV_OFFSET_BASIS;
+    size_t         idx;
+
+    /* FNV-1a, but pixel wise instead of byte wise, which is sufficient to detect changes. */
+    for (idx = 0U; idx < length; ++idx)
+    {
+        hash ^= m_framebuffer[idx];
+        hash *= FNV_PRIME;
+    }
+
+    hash ^= slotId;
+    hash *= FNV_PRIME;
+
+    return hash;
+}
+
+void WsDisplayStream::encodeFrame(std::vector<uint8_t>& frame, size_t length, uint8_t slotId) const
+{
+    /* Count the runs first to allocate the frame only once. */
+    size_t   runCnt = encodeRuns(nullptr, length);
+    uint16_t width  = CONFIG_LED_MATRIX_WIDTH;
+    uint16_t height = CONFIG_LED_MATRIX_HEIGHT;
+
+    frame.resize(HEADER_SIZE + (runCnt * RUN_SIZE));
+
+    frame[0U] = FORMAT_VERSION;
+    frame[1U] = slotId;
+    frame[2U] = static_cast<uint8_t>((width >> 0U) & 0xFFU);
+    frame[3U] = static_cast<uint8_t>((width >> 8U) & 0xFFU);
+    frame[4U] = static_cast<uint8_t>((height >> 0U) & 0xFFU);
+    frame[5U] = static_cast<uint8_t>((height >> 8U) & 0xFFU);
+
+    (void)encodeRuns(&frame[HEADER_SIZE], length);
+}
+
+size_t WsDisplayStream::encodeRuns(uint8_t* runs, size_t length) const
+{
+    size_t runCnt = 0U;
+    size_t idx    = 0U;
+
+    while (length > idx)
+    {
+        uint32_t color  = m_framebuffer[idx];
+        uint32_t repeat = 0U;
+
+        ++idx;
+
+        /* The repeat counter indicates how often the same color is used in subsequent pixels. */
+        while ((length > idx) &&
+               (color == m_framebuffer[idx]) &&
+               (REPEAT_MAX > repeat))
+        {
+            ++repeat;
+            ++idx;
+        }
+
+        if (nullptr != runs)
+        {
+            uint8_t* run = &runs[runCnt * RUN_SIZE];
+
+            run[0U]      = static_cast<uint8_t>(repeat);
+            run[1U]      = static_cast<uint8_t>((color >> 16U) & 0xFFU);
+            run[2U]      = static_cast<uint8_t>((color >> 8U) & 0xFFU);
+            run[3U]      = static_cast<uint8_t>((color >> 0U) & 0xFFU);
+        }
+
+        ++runCnt;
+    }
+
+    return runCnt;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,224 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   WsDisplayStream.h
+ * @brief  Websocket display stream
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup WEB
+ *
+ * @{
+ */
+
+#ifndef WS_DISPLAY_STREAM_H
+#define WS_DISPLAY_STREAM_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <ESPAsyncWebServer.h>
+#include <stdint.h>
+#include <Mutex.hpp>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Pushes the display content as binary websocket message to all subscribed
+ * clients. A frame is only sent to a client, if the display content changed
+ * since the last frame it got and not faster than the client requested.
+ *
+ * Binary frame format (multi-byte values in little endian):
+ * - uint8_t    Format version
+ * - uint8_t    Id of the slot, from which the frame was taken.
+ * - uint16_t   Display width in pixel
+ * - uint16_t   Display height in pixel
+ * - N runs of <repeat>, <red>, <green>, <blue> (each uint8_t), starting with
+ *   the row y = 0 and from x = 0 to width - 1. The repeat counter indicates
+ *   how often the color is used in subsequent pixels.
+ */
+class WsDisplayStream
+{
+public:
+
+    /**
+     * Get websocket display stream instance.
+     *
+     * @return Websocket display stream instance
+     */
+    static WsDisplayStream& getInstance()
+    {
+        static WsDisplayStream instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Subscribe a client or change the period of an already subscribed client.
+     *
+     * @param[in] clientId  Websocket client id
+     * @param[in] period    Min. period in ms between two frames. It is limited to MIN_PERIOD.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool subscribe(uint32_t clientId, uint32_t period);
+
+    /**
+     * Unsubscribe a client.
+     *
+     * @param[in] clientId  Websocket client id
+     */
+    void unsubscribe(uint32_t clientId);
+
+    /**
+     * Get the period of a subscribed client.
+     *
+     * @param[in] clientId  Websocket client id
+     *
+     * @return Period in ms or 0 if the client is not subscribed.
+     */
+    uint32_t getPeriod(uint32_t clientId);
+
+    /**
+     * Send the display content to all subscribed clients, which are due.
+     * This method need to be called periodically.
+     *
+     * @param[in] server    Websocket server
+     */
+    void process(AsyncWebSocket& server);
+
+    /** Max. number of clients, which can subscribe. */
+    static const size_t   MAX_SUBSCRIBERS = 4U;
+
+    /** Min. period in ms between two frames to a single client. */
+    static const uint32_t MIN_PERIOD      = 100U;
+
+    /** Binary frame format version. */
+    static const uint8_t  FORMAT_VERSION  = 1U;
+
+private:
+
+    /**
+     * A subscribed client.
+     */
+    struct Subscriber
+    {
+        bool     isUsed;    /**< Is the subscriber used? */
+        uint32_t clientId;  /**< Websocket client id */
+        uint32_t period;    /**< Min. period in ms between two frames. */
+        uint32_t timestamp; /**< Timestamp in ms of the last check. */
+        bool     hasFrame;  /**< Got the client already a frame? */
+        uint32_t frameHash; /**< Hash of the last frame, the client got. */
+    };
+
+    /** Frame header size in byte. */
+    static const size_t HEADER_SIZE = 6U;
+
+    /** Size of a single run in byte. */
+    static const size_t RUN_SIZE = 4U;
+
+    /** Max. repeat counter value of a single run. */
+    static const uint32_t REPEAT_MAX = 0xFFU;
+
+    Mutex      m_mutex;                        /**< Protects the subscribers against concurrent access. */
+    Subscriber m_subscribers[MAX_SUBSCRIBERS]; /**< Subscribed clients */
+    uint32_t*  m_framebuffer;                  /**< Framebuffer copy, only allocated if a client is subscribed. The stream is registered as framebuffer copy reader meanwhile. */
+
+    /**
+     * Constructs the websocket display stream.
+     */
+    WsDisplayStream();
+
+    /**
+     * Destroys the websocket display stream.
+     */
+    ~WsDisplayStream();
+
+    WsDisplayStream(const WsDisplayStream& stream);
+    WsDisplayStream& operator=(const WsDisplayStream& stream);
+
+    /**
+     * Is any subscriber due to get the next frame?
+     *
+     * @param[in] now   Current timestamp in ms
+     *
+     * @return If any subscriber is due, it will return true otherwise false.
+     */
+    bool isAnySubscriberDue(uint32_t now);
+
+    /**
+     * Release the framebuffer copy, if no client is subscribed anymore.
+     * The caller must hold the mutex.
+     */
+    void releaseFramebuffer();
+
+    /**
+     * Calculate the hash of the framebuffer copy.
+     *
+     * @param[in] length    Number of pixels
+     * @param[in] slotId    Id of the slot, from which the copy was taken.
+     *
+     * @return Hash
+     */
+    uint32_t calcFrameHash(size_t length, uint8_t slotId) const;
+
+    /**
+     * Encode the framebuffer copy in the binary frame format.
+     *
+     * @param[out] frame    Binary frame
+     * @param[in]  length   Number of pixels
+     * @param[in]  slotId   Id of the slot, from which the copy was taken.
+     */
+    void encodeFrame(std::vector<uint8_t>& frame, size_t length, uint8_t slotId) const;
+
+    /**
+     * Run-length encode the framebuffer copy.
+     *
+     * @param[out] runs     Buffer for the runs. If nullptr, the runs are only counted.
+     * @param[in]  length   Number of pixels
+     *
+     * @return Number of runs
+     */
+    size_t encodeRuns(uint8_t* runs, size_t length) const;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* WS_DISPLAY_STREAM_H */
+
+/** @} */
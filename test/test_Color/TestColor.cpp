@@ -35,6 +35,7 @@
  *****************************************************************************/
 #include <unity.h>
 #include <Rgb888.h>
+#include <Rgb888Packed.h>
 #include <Rgb565.h>
 #include <ColorUtil.hpp>
 #include <Util.h>
@@ -56,7 +57,9 @@
  *****************************************************************************/
 
 static void testColorUtil();
+static void testColorUtilScaleRgb888();
 static void testColor888();
+static void testColor888Packed();
 static void testColor565();
 
 /******************************************************************************
@@ -93,7 +96,9 @@ extern int main(int argc, char** argv)
     UNITY_BEGIN();
 
     RUN_TEST(testColorUtil);
+    RUN_TEST(testColorUtilScaleRgb888);
     RUN_TEST(testColor888);
+    RUN_TEST(testColor888Packed);
     RUN_TEST(testColor565);
 
     return UNITY_END();
@@ -170,6 +175,30 @@ static void testColorUtil()
     TEST_ASSERT_EQUAL_UINT32(0x00080408U, ColorUtil::to888(0x0821U));
 }
 
+/**
+ * Test the word-parallel scaling of RGB888 colors, which shall be identical
+ * to the per channel scaling.
+ */
+static void testColorUtilScaleRgb888()
+{
+    uint32_t base;
+    uint32_t intensity;
+
+    for (base = 0U; base <= UINT8_MAX; ++base)
+    {
+        for (intensity = 0U; intensity <= UINT8_MAX; ++intensity)
+        {
+            uint32_t expected = (base * intensity) / UINT8_MAX;
+            uint32_t rgb888   = ColorUtil::to888(static_cast<uint8_t>(base), static_cast<uint8_t>(UINT8_MAX - base), static_cast<uint8_t>(base));
+            uint32_t scaled   = ColorUtil::scaleRgb888(rgb888, static_cast<uint8_t>(intensity));
+
+            TEST_ASSERT_EQUAL_UINT8(expected, ColorUtil::rgb888Red(scaled));
+            TEST_ASSERT_EQUAL_UINT8(((UINT8_MAX - base) * intensity) / UINT8_MAX, ColorUtil::rgb888Green(scaled));
+            TEST_ASSERT_EQUAL_UINT8(expected, ColorUtil::rgb888Blue(scaled));
+        }
+    }
+}
+
 /**
  * Test RGB888 color.
  */
@@ -226,6 +255,19 @@ static void testColor888()
     TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getGreen());
     TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getBlue());
 
+    /* All base colors at once with respect to the intensity. */
+    {
+        uint8_t red   = 0U;
+        uint8_t green = 0U;
+        uint8_t blue  = 0U;
+
+        myColorA.get(red, green, blue);
+        TEST_ASSERT_EQUAL_UINT8(0x96u, red);
+        TEST_ASSERT_EQUAL_UINT8(0x96u, green);
+        TEST_ASSERT_EQUAL_UINT8(0x96u, blue);
+        TEST_ASSERT_EQUAL_UINT32(0x969696u, myColorA);
+    }
+
     /* Dim a color by 0%, which means no change.
      * And additional check non-destructive base colors.
      */
@@ -235,6 +277,64 @@ static void testColor888()
     TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getBlue());
 }
 
+/**
+ * Test packed RGB888 color.
+ */
+static void testColor888Packed()
+{
+    Rgb888Packed myColorA;
+    Rgb888Packed myColorB = ColorDef::TOMATO;
+    Rgb888Packed myColorC = myColorB;
+
+    /* Only the base colors are stored. */
+    TEST_ASSERT_EQUAL(3U, sizeof(Rgb888Packed));
+
+    /* Default color is black */
+    TEST_ASSERT_EQUAL_UINT32(0u, myColorA);
+
+    /* Does the color assignment works? */
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Red(ColorDef::TOMATO), myColorB.getRed());
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Green(ColorDef::TOMATO), myColorB.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(ColorUtil::rgb888Blue(ColorDef::TOMATO), myColorB.getBlue());
+
+    /* Does the color assignment via copy constructor works? */
+    TEST_ASSERT_TRUE(myColorB == myColorC);
+
+    /* Check the 5-6-5 RGB format conversion. */
+    myColorA.set(0x00080408U);
+    TEST_ASSERT_EQUAL_UINT16(0x0821u, myColorA.toRgb565());
+
+    myColorA.fromRgb565(0x0821u);
+    TEST_ASSERT_EQUAL_UINT32(0x00080408U, myColorA);
+
+    /* Get/Set single colors */
+    myColorA.setRed(0x12U);
+    myColorA.setGreen(0x34U);
+    myColorA.setBlue(0x56U);
+    TEST_ASSERT_EQUAL_UINT32(0x123456u, myColorA);
+    TEST_ASSERT_TRUE(myColorA != myColorB);
+
+    /* Dim color 25% darker, the intensity is applied immediately. */
+    myColorA = 0xc8c8c8u;
+    myColorA.setIntensity(192);
+    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getBlue());
+    TEST_ASSERT_EQUAL_UINT8(Rgb888Packed::MAX_BRIGHT, myColorA.getIntensity());
+
+    /* Same result as the RGB888 color with intensity. */
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(Rgb888(0xc8U, 0xc8U, 0xc8U, 192U)), myColorA);
+    TEST_ASSERT_TRUE(Rgb888Packed(0xc8U, 0xc8U, 0xc8U, 192U) == myColorA);
+
+    /* Dim a color by 0%, which means no change. */
+    myColorA.setIntensity(255);
+    TEST_ASSERT_EQUAL_UINT32(0x969696u, myColorA);
+
+    /* Dimming is destructive. */
+    myColorA.setIntensity(0);
+    TEST_ASSERT_EQUAL_UINT32(0u, myColorA);
+}
+
 /**
  * Test RGB565 color.
  */
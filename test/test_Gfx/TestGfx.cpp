@@ -35,6 +35,7 @@
  *****************************************************************************/
 #include <unity.h>
 #include <Util.h>
+#include <YAGfxCanvas.h>
 #include <chrono>
 
 #include "../common/YAGfxTest.hpp"
@@ -56,6 +57,7 @@
  *****************************************************************************/
 
 static void testGfx();
+static void testGfxDirtyRegion();
 static void testGfxSpeed();
 static void measureGfxSpeed(uint16_t width, uint16_t height, uint32_t count);
 
@@ -93,6 +95,7 @@ extern int main(int argc, char** argv)
     UNITY_BEGIN();
 
     RUN_TEST(testGfx);
+    RUN_TEST(testGfxDirtyRegion);
     RUN_TEST(testGfxSpeed);
 
     return UNITY_END();
@@ -238,6 +241,151 @@ static void testGfx()
     /* Clear screen */
     testGfx.fillScreen(0U);
     TEST_ASSERT_TRUE(testGfx.verify(0, 0, YAGfxTest::WIDTH, YAGfxTest::HEIGHT, 0U));
+
+    /* Test drawing a bitmap, which starts outside the screen.
+     * Only its remaining part shall be drawn.
+     */
+    testGfx.drawBitmap(-5, -2, bitmap);
+
+    for (y = 0U; y < YAGfxTest::HEIGHT; ++y)
+    {
+        for (x = 0U; x < YAGfxTest::WIDTH; ++x)
+        {
+            if (((YAGfxTest::WIDTH - 5) > x) &&
+                ((YAGfxTest::HEIGHT - 2) > y))
+            {
+                TEST_ASSERT_EQUAL_UINT16(bitmap.getColor(x + 5, y + 2), testGfx.getColor(x, y));
+            }
+            else
+            {
+                TEST_ASSERT_EQUAL_UINT16(0U, testGfx.getColor(x, y));
+            }
+        }
+    }
+
+    /* Clear screen */
+    testGfx.fillScreen(0U);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, YAGfxTest::WIDTH, YAGfxTest::HEIGHT, 0U));
+}
+
+/**
+ * Test the dirty region tracking of bitmaps.
+ */
+static void testGfxDirtyRegion()
+{
+    const Color                COLOR   = 0x1234;
+    const uint16_t             WIDTH   = 32U;
+    const uint16_t             HEIGHT  = 8U;
+    YAGfxStaticBitmap<32U, 8U> bitmap;
+    YAGfxDynamicBitmap         srcBitmap;
+    YAGfxCanvas                canvas(&bitmap, 4, 2, 8U, 4U);
+    int16_t                    x       = 0;
+    int16_t                    y       = 0;
+    uint16_t                   width   = 0U;
+    uint16_t                   height  = 0U;
+
+    /* A new bitmap is completely dirty. */
+    TEST_ASSERT_TRUE(bitmap.isDirty());
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(0, x);
+    TEST_ASSERT_EQUAL_INT16(0, y);
+    TEST_ASSERT_EQUAL_UINT16(WIDTH, width);
+    TEST_ASSERT_EQUAL_UINT16(HEIGHT, height);
+
+    bitmap.fillScreen(0U);
+    bitmap.clearDirty();
+    TEST_ASSERT_FALSE(bitmap.isDirty());
+    TEST_ASSERT_FALSE(bitmap.getDirtyRegion(x, y, width, height));
+
+    /* Drawing with the same color doesn't change anything. */
+    bitmap.fillScreen(0U);
+    bitmap.drawPixel(1, 1, 0U);
+    TEST_ASSERT_FALSE(bitmap.isDirty());
+
+    /* Single pixel */
+    bitmap.drawPixel(3, 5, COLOR);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(3, x);
+    TEST_ASSERT_EQUAL_INT16(5, y);
+    TEST_ASSERT_EQUAL_UINT16(1U, width);
+    TEST_ASSERT_EQUAL_UINT16(1U, height);
+
+    /* Bounding box of pixel and line */
+    bitmap.drawHLine(10, 2, 5U, COLOR);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(3, x);
+    TEST_ASSERT_EQUAL_INT16(2, y);
+    TEST_ASSERT_EQUAL_UINT16(12U, width);
+    TEST_ASSERT_EQUAL_UINT16(4U, height);
+    bitmap.clearDirty();
+
+    /* Only the changed part of a line is dirty. */
+    bitmap.drawHLine(0, 2, WIDTH, COLOR);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(0, x);
+    TEST_ASSERT_EQUAL_INT16(2, y);
+    TEST_ASSERT_EQUAL_UINT16(WIDTH, width);
+    TEST_ASSERT_EQUAL_UINT16(1U, height);
+    bitmap.clearDirty();
+
+    bitmap.drawVLine(20, 0, HEIGHT, COLOR);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(20, x);
+    TEST_ASSERT_EQUAL_INT16(0, y);
+    TEST_ASSERT_EQUAL_UINT16(1U, width);
+    TEST_ASSERT_EQUAL_UINT16(HEIGHT, height);
+    bitmap.clearDirty();
+
+    /* Drawing in a canvas marks the parent. The first canvas row has
+     * already the color.
+     */
+    canvas.fillScreen(COLOR);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(4, x);
+    TEST_ASSERT_EQUAL_INT16(3, y);
+    TEST_ASSERT_EQUAL_UINT16(8U, width);
+    TEST_ASSERT_EQUAL_UINT16(3U, height);
+    bitmap.clearDirty();
+
+    /* Copying an equal bitmap doesn't change anything. */
+    TEST_ASSERT_TRUE(srcBitmap.create(WIDTH, HEIGHT));
+    srcBitmap.copy(bitmap);
+    bitmap.copy(srcBitmap);
+    TEST_ASSERT_FALSE(bitmap.isDirty());
+
+    srcBitmap.drawPixel(0, 7, COLOR);
+    srcBitmap.drawPixel(31, 7, COLOR);
+    bitmap.drawBitmap(0, 0, srcBitmap);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(0, x);
+    TEST_ASSERT_EQUAL_INT16(7, y);
+    TEST_ASSERT_EQUAL_UINT16(WIDTH, width);
+    TEST_ASSERT_EQUAL_UINT16(1U, height);
+    bitmap.clearDirty();
+
+    /* The unchanged pixels at both line ends are not dirty. */
+    bitmap.drawHLine(0, 7, WIDTH, COLOR);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(1, x);
+    TEST_ASSERT_EQUAL_INT16(7, y);
+    TEST_ASSERT_EQUAL_UINT16(WIDTH - 2U, width);
+    TEST_ASSERT_EQUAL_UINT16(1U, height);
+    TEST_ASSERT_TRUE(COLOR == bitmap.getColor(1, 7));
+    TEST_ASSERT_TRUE(COLOR == bitmap.getColor(30, 7));
+    bitmap.clearDirty();
+
+    /* Marking outside the bitmap is limited to the bitmap. */
+    bitmap.markDirty(-4, -4, 8U, 8U);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRegion(x, y, width, height));
+    TEST_ASSERT_EQUAL_INT16(0, x);
+    TEST_ASSERT_EQUAL_INT16(0, y);
+    TEST_ASSERT_EQUAL_UINT16(4U, width);
+    TEST_ASSERT_EQUAL_UINT16(4U, height);
+    bitmap.clearDirty();
+
+    bitmap.markDirty(WIDTH, HEIGHT, 2U, 2U);
+    TEST_ASSERT_TRUE(bitmap.isDirty());
+    TEST_ASSERT_FALSE(bitmap.getDirtyRegion(x, y, width, height));
 }
 
 /**
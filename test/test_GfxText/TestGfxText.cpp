@@ -36,6 +36,7 @@
 #include <unity.h>
 #include <YAGfxText.h>
 #include <YAGfxBrush.h>
+#include <GlyphCache.hpp>
 #include <TomThumb.h>
 #include <Util.h>
 
@@ -58,6 +59,8 @@
  *****************************************************************************/
 
 static void testGfxText();
+static void testGlyphCache();
+static bool verifyGlyph(const YAGfxTest& gfx, const GFXglyph& glyph, int16_t cursorX, int16_t cursorY, const Color& color);
 
 /******************************************************************************
  * Local Variables
@@ -93,6 +96,7 @@ extern int main(int argc, char** argv)
     UNITY_BEGIN();
 
     RUN_TEST(testGfxText);
+    RUN_TEST(testGlyphCache);
 
     return UNITY_END();
 }
@@ -173,3 +177,105 @@ static void testGfxText()
     TEST_ASSERT_TRUE(testGfxText.getTextBoundingBox(glyph->xAdvance, "AA", boundingBoxWidth, boundingBoxHeight));
     TEST_ASSERT_EQUAL_UINT16(2U * TomThumb.yAdvance, boundingBoxHeight);
 }
+
+/**
+ * Test the glyph cache, by comparing every drawn glyph with its bitmap.
+ */
+static void testGlyphCache()
+{
+    YAGfxTest               testGfx;
+    YAGfxText               testGfxText;
+    const Color             COLOR = 0x1234;
+    YAGfxSolidBrush         brush(COLOR);
+    const GlyphCache::Font* font  = GlyphCache::getFont(&TomThumb);
+    uint16_t                uChar = 0U;
+
+    /* No font, nothing to cache. */
+    TEST_ASSERT_NULL(GlyphCache::getFont(nullptr));
+
+    /* The font is decoded only once. */
+    TEST_ASSERT_NOT_NULL(font);
+    TEST_ASSERT_EQUAL_PTR(&TomThumb, font->gfxFont);
+    TEST_ASSERT_EQUAL_PTR(font, GlyphCache::getFont(&TomThumb));
+
+    testGfxText.setFont(&TomThumb);
+    testGfxText.setTextWrap(false);
+    testGfxText.setBrush(brush);
+
+    for (uChar = TomThumb.first; uChar <= TomThumb.last; ++uChar)
+    {
+        char            singleChar = static_cast<char>(uChar);
+        const GFXglyph* glyph      = testGfxText.getFont().getGlyph(singleChar);
+
+        /* Line feed and carriage return have no glyph. */
+        if (nullptr != glyph)
+        {
+            /* Completely inside. */
+            testGfx.fillScreen(ColorDef::BLACK);
+            testGfxText.setTextCursorPos(1, 6);
+            testGfxText.drawChar(testGfx, singleChar);
+            TEST_ASSERT_TRUE(verifyGlyph(testGfx, *glyph, 1, 6, COLOR));
+
+            /* Clipped at the left and top border. */
+            testGfx.fillScreen(ColorDef::BLACK);
+            testGfxText.setTextCursorPos(-1, 2);
+            testGfxText.drawChar(testGfx, singleChar);
+            TEST_ASSERT_TRUE(verifyGlyph(testGfx, *glyph, -1, 2, COLOR));
+
+            /* Clipped at the right and bottom border. */
+            testGfx.fillScreen(ColorDef::BLACK);
+            testGfxText.setTextCursorPos(YAGfxTest::WIDTH - 2, YAGfxTest::HEIGHT + 1);
+            testGfxText.drawChar(testGfx, singleChar);
+            TEST_ASSERT_TRUE(verifyGlyph(testGfx, *glyph, YAGfxTest::WIDTH - 2, YAGfxTest::HEIGHT + 1, COLOR));
+        }
+    }
+}
+
+/**
+ * Verify that exactly the visible pixels of a glyph are drawn.
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] glyph     Glyph which was drawn
+ * @param[in] cursorX   Cursor x-coordinate, the glyph was drawn at.
+ * @param[in] cursorY   Cursor y-coordinate, the glyph was drawn at.
+ * @param[in] color     Glyph color
+ *
+ * @return If the glyph matches, it will return true otherwise false.
+ */
+static bool verifyGlyph(const YAGfxTest& gfx, const GFXglyph& glyph, int16_t cursorX, int16_t cursorY, const Color& color)
+{
+    bool    isEqual = true;
+    int16_t x       = 0;
+    int16_t y       = 0;
+
+    for (y = 0; y < YAGfxTest::HEIGHT; ++y)
+    {
+        for (x = 0; x < YAGfxTest::WIDTH; ++x)
+        {
+            int16_t bitmapX  = x - cursorX - glyph.xOffset;
+            int16_t bitmapY  = y - cursorY - glyph.yOffset;
+            Color   expected = ColorDef::BLACK;
+
+            if ((0 <= bitmapX) &&
+                (glyph.width > bitmapX) &&
+                (0 <= bitmapY) &&
+                (glyph.height > bitmapY))
+            {
+                uint16_t bitIdx = bitmapY * glyph.width + bitmapX;
+                uint8_t  bits   = TomThumb.bitmap[glyph.bitmapOffset + bitIdx / 8U];
+
+                if (0U != (bits & (0x80U >> (bitIdx % 8U))))
+                {
+                    expected = color;
+                }
+            }
+
+            if (expected != gfx.getColor(x, y))
+            {
+                isEqual = false;
+            }
+        }
+    }
+
+    return isEqual;
+}
@@ -62,6 +62,8 @@ static void testGifImgPlayerStatic();
 static void testGifImgPlayerAnimated();
 static void testGifImgPlayerMemStatic();
 static void testGifImgPlayerMemAnimated();
+static void testGifImgPlayerFrameCache();
+static uint32_t calcChecksum(YAGfxTest& testGfx);
 
 /******************************************************************************
  * Local Variables
@@ -118,6 +120,7 @@ extern int main(int argc, char** argv)
     RUN_TEST(testGifImgPlayerAnimated);
     RUN_TEST(testGifImgPlayerMemStatic);
     RUN_TEST(testGifImgPlayerMemAnimated);
+    RUN_TEST(testGifImgPlayerFrameCache);
 
     return UNITY_END();
 }
@@ -279,3 +282,103 @@ static void testGifImgPlayerMemAnimated()
 
     gifImgPlayer.close();
 }
+
+/**
+ * Calculate a checksum over the whole test graphics.
+ *
+ * @param[in] testGfx   Test graphics
+ *
+ * @return Checksum
+ */
+static uint32_t calcChecksum(YAGfxTest& testGfx)
+{
+    uint32_t checksum = 0U;
+    int16_t  x;
+    int16_t  y;
+
+    for (y = 0; y < YAGfxTest::HEIGHT; ++y)
+    {
+        for (x = 0; x < YAGfxTest::WIDTH; ++x)
+        {
+            checksum = checksum * 31U + static_cast<uint32_t>(testGfx.getColor(x, y));
+        }
+    }
+
+    return checksum;
+}
+
+/**
+ * Test GIF image player with a animated GIF image, which is replayed from
+ * the frame cache after the second loop.
+ */
+static void testGifImgPlayerFrameCache()
+{
+    const uint32_t     LOOPS      = 4U;
+    const uint32_t     MAX_SCENES = 32U;
+    GifFileToMemLoader gifFileLoader;
+    GifImgPlayer       gifImgPlayer;
+    YAGfxTest          testGfx;
+    YAGfxCanvas        canvas(&testGfx, 0, 0, YAGfxTest::WIDTH, YAGfxTest::HEIGHT);
+    FS                 fileSystem;
+    uint32_t           scenes[LOOPS][MAX_SCENES];
+    uint32_t           sceneCnt[LOOPS] = { 0U };
+    uint32_t           loop            = 0U;
+    uint32_t           idx;
+
+    TEST_ASSERT_EQUAL(GifImgPlayer::RET_OK, gifImgPlayer.open(fileSystem, "./test/test_GifImgPlayer/TestAnimation.gif", gifFileLoader));
+
+    /* Collect the sequence of different scenes per animation loop. */
+    while (LOOPS > loop)
+    {
+        uint32_t checksum = 0U;
+
+        TEST_ASSERT_EQUAL(true, gifImgPlayer.play(canvas));
+        checksum = calcChecksum(testGfx);
+
+        /* The first loop is decoded, all loops after the recorded one are
+         * replayed from the cache.
+         */
+        if (0U == loop)
+        {
+            TEST_ASSERT_FALSE(gifImgPlayer.isPlayingFromCache());
+        }
+        else if (2U <= loop)
+        {
+            TEST_ASSERT_TRUE(gifImgPlayer.isPlayingFromCache());
+        }
+        else
+        {
+            ;
+        }
+
+        if ((0U == sceneCnt[loop]) ||
+            (checksum != scenes[loop][sceneCnt[loop] - 1U]))
+        {
+            TEST_ASSERT_TRUE(MAX_SCENES > sceneCnt[loop]);
+            scenes[loop][sceneCnt[loop]] = checksum;
+            ++sceneCnt[loop];
+        }
+
+        if (true == gifImgPlayer.isTrailerFound())
+        {
+            ++loop;
+        }
+    }
+
+    gifImgPlayer.close();
+
+    /* The 2nd loop was decoded and recorded, all further loops were replayed
+     * from the cache and must show the same scenes.
+     */
+    TEST_ASSERT_TRUE(1U < sceneCnt[1U]);
+
+    for (loop = 2U; loop < LOOPS; ++loop)
+    {
+        TEST_ASSERT_EQUAL_UINT32(sceneCnt[1U], sceneCnt[loop]);
+
+        for (idx = 0U; idx < sceneCnt[1U]; ++idx)
+        {
+            TEST_ASSERT_EQUAL_UINT32(scenes[1U][idx], scenes[loop][idx]);
+        }
+    }
+}
@@ -0,0 +1,368 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   TestJsonStreamFilter.cpp
+ * @brief  Test the incremental JSON filter.
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <Util.h>
+#include <JsonStreamFilter.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static bool filterInChunks(JsonStreamFilter& jsonStreamFilter, const char* json, size_t chunkSize);
+static void testJsonStreamFilterPassThrough(void);
+static void testJsonStreamFilterObject(void);
+static void testJsonStreamFilterArray(void);
+static void testJsonStreamFilterChunks(void);
+static void testJsonStreamFilterInvalid(void);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Weather forecast like JSON document, used for the tests.
+ */
+static const char* gForecast =
+    "{\n"
+    "  \"cod\": \"200\",\n"
+    "  \"list\": [\n"
+    "    { \"dt\": 1700000000, \"main\": { \"temp\": 4.5, \"humidity\": 87 }, \"weather\": [ { \"id\": 800, \"icon\": \"01d\" } ] },\n"
+    "    { \"dt\": 1700010800, \"main\": { \"temp\": -1.25e1, \"humidity\": 90 }, \"weather\": [ { \"id\": 500, \"icon\": \"10n\" } ] }\n"
+    "  ],\n"
+    "  \"city\": { \"name\": \"K\\u00f6ln \\\"Nord\\\"\", \"sunrise\": null, \"valid\": true }\n"
+    "}\n";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char **argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(testJsonStreamFilterPassThrough);
+    RUN_TEST(testJsonStreamFilterObject);
+    RUN_TEST(testJsonStreamFilterArray);
+    RUN_TEST(testJsonStreamFilterChunks);
+    RUN_TEST(testJsonStreamFilterInvalid);
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Filter the JSON document by feeding it in chunks of the given size.
+ *
+ * @param[in] jsonStreamFilter  JSON stream filter
+ * @param[in] json              JSON document
+ * @param[in] chunkSize         Chunk size in byte
+ *
+ * @return If successful, it will return true otherwise false.
+ */
+static bool filterInChunks(JsonStreamFilter& jsonStreamFilter, const char* json, size_t chunkSize)
+{
+    bool   isSuccessful = true;
+    size_t size         = strlen(json);
+    size_t index        = 0U;
+
+    jsonStreamFilter.reset();
+
+    while ((true == isSuccessful) && (size > index))
+    {
+        size_t available = size - index;
+        size_t chunk     = (chunkSize < available) ? chunkSize : available;
+
+        isSuccessful     = jsonStreamFilter.parse(&json[index], chunk);
+        index           += chunk;
+    }
+
+    if (true == isSuccessful)
+    {
+        isSuccessful = jsonStreamFilter.finish();
+    }
+
+    return isSuccessful;
+}
+
+/**
+ * Test the JSON stream filter without a filter.
+ */
+static void testJsonStreamFilterPassThrough(void)
+{
+    JsonStreamFilter jsonStreamFilter;
+    bool             isSuccessful = false;
+
+    /* Without filter, the whole JSON document is kept minified. */
+    isSuccessful = filterInChunks(jsonStreamFilter, "{ \"a\" : 1, \"b\": [ true, null, \"x\\\"y\" ], \"c\": {} }", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("{\"a\":1,\"b\":[true,null,\"x\\\"y\"],\"c\":{}}", jsonStreamFilter.getOutput().c_str());
+
+    /* A literal at top level ends with the JSON document. */
+    isSuccessful = filterInChunks(jsonStreamFilter, " 42", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("42", jsonStreamFilter.getOutput().c_str());
+
+    /* The filter true keeps everything too. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("true"));
+    isSuccessful = filterInChunks(jsonStreamFilter, "[1, [2, 3]]", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("[1,[2,3]]", jsonStreamFilter.getOutput().c_str());
+}
+
+/**
+ * Test the JSON stream filter with object filters.
+ */
+static void testJsonStreamFilterObject(void)
+{
+    JsonStreamFilter jsonStreamFilter;
+    bool             isSuccessful = false;
+
+    /* Only the declared members are kept, escaped strings are kept as they are. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"city\": { \"name\": true, \"valid\": true } }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, gForecast, 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("{\"city\":{\"name\":\"K\\u00f6ln \\\"Nord\\\"\",\"valid\":true}}", jsonStreamFilter.getOutput().c_str());
+
+    /* A member, which is declared with false, is skipped. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"cod\": true, \"city\": false }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, gForecast, 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("{\"cod\":\"200\"}", jsonStreamFilter.getOutput().c_str());
+
+    /* Like the ArduinoJson filter, a non-zero number or a string keeps a value too. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"cod\": 0.5, \"list\": [ { \"dt\": \"x\", \"main\": 0.0e1 } ], \"city\": null }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, gForecast, 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("{\"cod\":\"200\",\"list\":[{\"dt\":1700000000},{\"dt\":1700010800}]}", jsonStreamFilter.getOutput().c_str());
+
+    /* The wildcard matches every member. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"city\": { \"*\": true } }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, "{\"city\":{\"a\":1,\"b\":\"2\"},\"x\":3}", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("{\"city\":{\"a\":1,\"b\":\"2\"}}", jsonStreamFilter.getOutput().c_str());
+
+    /* A value, which doesn't match to its filter, is replaced with null. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"a\": { \"b\": true }, \"c\": [ true ] }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, "{\"a\":5,\"c\":{\"d\":1}}", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("{\"a\":null,\"c\":null}", jsonStreamFilter.getOutput().c_str());
+
+    /* A document, which doesn't match to the filter, is replaced with null. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"a\": true }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, "[1,2]", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("null", jsonStreamFilter.getOutput().c_str());
+
+    /* A filter, which skips the whole document, results in an empty output. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("null"));
+    isSuccessful = filterInChunks(jsonStreamFilter, gForecast, 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("", jsonStreamFilter.getOutput().c_str());
+
+    /* Escaped keys are compared decoded, but written escaped. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"a\": true, \"\\u00f6\": true, \"\\ud83d\\ude00\": true }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, "{\"\\u0061\":5,\"\\u00F6\":6,\"\xc3\xb6\":7,\"\\ud83d\\ude00\":8,\"b\":9}", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("{\"\\u0061\":5,\"\\u00F6\":6,\"\xc3\xb6\":7,\"\\ud83d\\ude00\":8}", jsonStreamFilter.getOutput().c_str());
+}
+
+/**
+ * Test the JSON stream filter with array filters.
+ */
+static void testJsonStreamFilterArray(void)
+{
+    JsonStreamFilter jsonStreamFilter;
+    bool             isSuccessful = false;
+
+    /* The first array element of the filter is applied to all elements. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"list\": [ { \"main\": { \"temp\": true }, \"weather\": [ { \"icon\": true } ] } ] }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, gForecast, 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"list\":[{\"main\":{\"temp\":4.5},\"weather\":[{\"icon\":\"01d\"}]},{\"main\":{\"temp\":-1.25e1},\"weather\":[{\"icon\":\"10n\"}]}]}",
+        jsonStreamFilter.getOutput().c_str());
+
+    /* An empty array filter skips all elements. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"list\": [] }"));
+    isSuccessful = filterInChunks(jsonStreamFilter, gForecast, 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("{\"list\":[]}", jsonStreamFilter.getOutput().c_str());
+}
+
+/**
+ * Test that the result doesn't depend on the chunk size.
+ */
+static void testJsonStreamFilterChunks(void)
+{
+    JsonStreamFilter jsonStreamFilter;
+    String           expected;
+    size_t           chunkSize;
+
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("{ \"list\": [ { \"dt\": true, \"main\": true } ], \"city\": { \"name\": true } }"));
+    TEST_ASSERT_TRUE(filterInChunks(jsonStreamFilter, gForecast, strlen(gForecast)));
+    expected = jsonStreamFilter.getOutput();
+
+    for (chunkSize = 1U; chunkSize < strlen(gForecast); ++chunkSize)
+    {
+        bool isSuccessful = filterInChunks(jsonStreamFilter, gForecast, chunkSize);
+
+        TEST_ASSERT_TRUE(isSuccessful);
+        TEST_ASSERT_EQUAL_STRING(expected.c_str(), jsonStreamFilter.getOutput().c_str());
+    }
+}
+
+/**
+ * Test the JSON stream filter with invalid input.
+ */
+static void testJsonStreamFilterInvalid(void)
+{
+    JsonStreamFilter jsonStreamFilter;
+    bool             isSuccessful = false;
+    String           nested;
+    size_t           depth;
+
+    /* Invalid filters. */
+    TEST_ASSERT_FALSE(jsonStreamFilter.setFilter("{ \"a\": }"));
+    TEST_ASSERT_FALSE(jsonStreamFilter.setFilter("{ \"a\": true"));
+    TEST_ASSERT_FALSE(jsonStreamFilter.setFilter("[ true ] true"));
+    TEST_ASSERT_FALSE(jsonStreamFilter.setFilter("{ \"a\": tru }"));
+    TEST_ASSERT_FALSE(jsonStreamFilter.setFilter("{ \"\\x\": true }"));
+
+    /* An invalid filter skips everything. */
+    isSuccessful = filterInChunks(jsonStreamFilter, "{\"a\":1}", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("", jsonStreamFilter.getOutput().c_str());
+
+    /* Invalid JSON documents. */
+    TEST_ASSERT_TRUE(jsonStreamFilter.setFilter("true"));
+    isSuccessful = filterInChunks(jsonStreamFilter, "{\"a\" 1}", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "{\"a\":1", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[1,2] 3", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+
+    /* Invalid literals and escapes. */
+    isSuccessful = filterInChunks(jsonStreamFilter, "{\"a\":tru}", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[truex]", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[nul]", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[01]", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[1.]", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[-]", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[1e+]", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[+1]", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "1.", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+    isSuccessful = filterInChunks(jsonStreamFilter, "[\"\\x\"]", 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+
+    /* Valid literals. */
+    isSuccessful = filterInChunks(jsonStreamFilter, "[0,-0.5,10E-2,1e+3,true,false,null]", 64U);
+    TEST_ASSERT_TRUE(isSuccessful);
+    TEST_ASSERT_EQUAL_STRING("[0,-0.5,10E-2,1e+3,true,false,null]", jsonStreamFilter.getOutput().c_str());
+
+    /* Too deep nesting. */
+    for (depth = 0U; depth <= JsonStreamFilter::MAX_DEPTH; ++depth)
+    {
+        nested += "[";
+    }
+
+    isSuccessful = filterInChunks(jsonStreamFilter, nested.c_str(), 64U);
+    TEST_ASSERT_FALSE(isSuccessful);
+}
@@ -34,6 +34,7 @@
  * Includes
  *****************************************************************************/
 #include <unity.h>
+#include <chrono>
 #include <LzwDecoder.h>
 #include <Util.h>
 
@@ -54,6 +55,8 @@
  *****************************************************************************/
 
 static void testLzwDecoder();
+static void testLzwDecoderBlock();
+static void testLzwDecoderThroughput();
 
 /******************************************************************************
  * Local Variables
@@ -84,6 +87,9 @@ static const uint8_t    EXPECTED_DATA[] =
     /* 9 */ 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01
 };
 
+/** Number of decode runs, used to measure the throughput. */
+static const uint32_t   THROUGHPUT_RUNS     = 100000U;
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -114,6 +120,8 @@ extern int main(int argc, char **argv)
     UNITY_BEGIN();
 
     RUN_TEST(testLzwDecoder);
+    RUN_TEST(testLzwDecoderBlock);
+    RUN_TEST(testLzwDecoderThroughput);
 
     return UNITY_END();
 }
@@ -180,3 +188,124 @@ static void testLzwDecoder()
 
     lzwDecoder.deInit();
 }
+
+/**
+ * Test the block oriented LZW decoder with input and output split into
+ * small chunks, to verify that decoding continues seamless.
+ */
+static void testLzwDecoderBlock()
+{
+    LzwDecoder  lzwDecoder;
+    size_t      inputChunkSize;
+    size_t      outputChunkSize;
+
+    for (inputChunkSize = 1U; inputChunkSize <= sizeof(INPUT_DATA); ++inputChunkSize)
+    {
+        for (outputChunkSize = 1U; outputChunkSize <= sizeof(EXPECTED_DATA); outputChunkSize += 7U)
+        {
+            LzwDecoder::Status  status      = LzwDecoder::STATUS_NEED_INPUT;
+            size_t              srcIndex    = 0U;
+            size_t              dstIndex    = 0U;
+            size_t              outputSize  = outputChunkSize;
+            uint8_t             dstBuffer[sizeof(EXPECTED_DATA)];
+
+            TEST_ASSERT_TRUE(lzwDecoder.init(2U));
+
+            while (LzwDecoder::STATUS_END != status)
+            {
+                size_t inputSize  = sizeof(INPUT_DATA) - srcIndex;
+                size_t inputUsed  = 0U;
+                size_t outputUsed = 0U;
+
+                inputSize = (inputChunkSize < inputSize) ? inputChunkSize : inputSize;
+
+                status = lzwDecoder.decode(&INPUT_DATA[srcIndex], inputSize, inputUsed, &dstBuffer[dstIndex], outputSize, outputUsed);
+                TEST_ASSERT_NOT_EQUAL(LzwDecoder::STATUS_ERROR, status);
+
+                srcIndex += inputUsed;
+                dstIndex += outputUsed;
+
+                TEST_ASSERT_LESS_OR_EQUAL(sizeof(INPUT_DATA), srcIndex);
+                TEST_ASSERT_LESS_OR_EQUAL(sizeof(EXPECTED_DATA), dstIndex);
+
+                /* Limit the output buffer to the remaining space. */
+                if ((sizeof(EXPECTED_DATA) - dstIndex) < outputSize)
+                {
+                    outputSize = sizeof(EXPECTED_DATA) - dstIndex;
+                }
+            }
+
+            TEST_ASSERT_EQUAL(sizeof(EXPECTED_DATA), dstIndex);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(EXPECTED_DATA, dstBuffer, sizeof(EXPECTED_DATA));
+
+            lzwDecoder.deInit();
+        }
+    }
+}
+
+/**
+ * Measure the throughput of the callback and the block oriented LZW decoder.
+ */
+static void testLzwDecoderThroughput()
+{
+    LzwDecoder                              lzwDecoder;
+    uint32_t                                run;
+    uint8_t                                 dstBuffer[sizeof(EXPECTED_DATA)];
+    std::chrono::steady_clock::time_point   timestampBegin;
+    uint64_t                                durationCallbackNs;
+    uint64_t                                durationBlockNs;
+
+    timestampBegin = std::chrono::steady_clock::now();
+
+    for (run = 0U; run < THROUGHPUT_RUNS; ++run)
+    {
+        size_t srcIndex = 0U;
+        size_t dstIndex = 0U;
+
+        lzwDecoder.init(2U);
+
+        TEST_ASSERT_TRUE(lzwDecoder.decode(
+            [&srcIndex](uint8_t& data) -> bool
+            {
+                data = INPUT_DATA[srcIndex];
+                ++srcIndex;
+
+                return true;
+            },
+            [&dstBuffer, &dstIndex](uint8_t data) -> bool
+            {
+                dstBuffer[dstIndex] = data;
+                ++dstIndex;
+
+                return true;
+            }
+        ));
+
+        lzwDecoder.deInit();
+    }
+
+    durationCallbackNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - timestampBegin).count();
+    timestampBegin     = std::chrono::steady_clock::now();
+
+    for (run = 0U; run < THROUGHPUT_RUNS; ++run)
+    {
+        size_t             inputUsed  = 0U;
+        size_t             outputUsed = 0U;
+        LzwDecoder::Status status;
+
+        lzwDecoder.init(2U);
+
+        status = lzwDecoder.decode(INPUT_DATA, sizeof(INPUT_DATA), inputUsed, dstBuffer, sizeof(dstBuffer), outputUsed);
+        TEST_ASSERT_EQUAL(LzwDecoder::STATUS_END, status);
+        TEST_ASSERT_EQUAL(sizeof(EXPECTED_DATA), outputUsed);
+
+        lzwDecoder.deInit();
+    }
+
+    durationBlockNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - timestampBegin).count();
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(EXPECTED_DATA, dstBuffer, sizeof(EXPECTED_DATA));
+
+    printf("LzwDecoder callback: %6.2f MB/s\n", (1000.0 * THROUGHPUT_RUNS * sizeof(EXPECTED_DATA)) / static_cast<double>(durationCallbackNs));
+    printf("LzwDecoder block   : %6.2f MB/s\n", (1000.0 * THROUGHPUT_RUNS * sizeof(EXPECTED_DATA)) / static_cast<double>(durationBlockNs));
+}
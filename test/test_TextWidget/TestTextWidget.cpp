@@ -59,6 +59,9 @@
 
 static void testTokenizer();
 static void testTextWidget();
+static void testTextLayout();
+static void testScrollStrip();
+static void verifyScrollStrip(TextWidget& widget, uint32_t steps);
 
 /******************************************************************************
  * Local Variables
@@ -95,6 +98,8 @@ extern int main(int argc, char** argv)
 
     RUN_TEST(testTokenizer);
     RUN_TEST(testTextWidget);
+    RUN_TEST(testTextLayout);
+    RUN_TEST(testScrollStrip);
 
     return UNITY_END();
 }
@@ -136,39 +141,39 @@ static void testTokenizer()
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "{abc}"));
     TEST_ASSERT_EQUAL(1U, ast.length());
     TEST_ASSERT_EQUAL(TWToken::TYPE_KEYWORD, ast[0U].getType());
-    TEST_ASSERT_EQUAL_STRING("{abc}", ast[0U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("{abc}", ast[0U].getStr());
 
     /* Only text */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "abc"));
     TEST_ASSERT_EQUAL(1U, ast.length());
     TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[0U].getType());
-    TEST_ASSERT_EQUAL_STRING("abc", ast[0U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("abc", ast[0U].getStr());
 
     /* Only line feed */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "\n"));
     TEST_ASSERT_EQUAL(1U, ast.length());
     TEST_ASSERT_EQUAL(TWToken::TYPE_LINE_FEED, ast[0U].getType());
-    TEST_ASSERT_EQUAL_STRING("\n", ast[0U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("\n", ast[0U].getStr());
 
     /* Text with escape of character */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "a\\b"));
     TEST_ASSERT_EQUAL(1U, ast.length());
     TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[0U].getType());
-    TEST_ASSERT_EQUAL_STRING("ab", ast[0U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("ab", ast[0U].getStr());
 
     /* Text with escaped {} */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "a\\{b\\}"));
     TEST_ASSERT_EQUAL(1U, ast.length());
     TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[0U].getType());
-    TEST_ASSERT_EQUAL_STRING("a{b}", ast[0U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("a{b}", ast[0U].getStr());
 
     /* Order: keyword, text */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "{a}b"));
     TEST_ASSERT_EQUAL(2U, ast.length());
     TEST_ASSERT_EQUAL(TWToken::TYPE_KEYWORD, ast[0U].getType());
     TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[1U].getType());
-    TEST_ASSERT_EQUAL_STRING("{a}", ast[0U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("b", ast[1U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("{a}", ast[0U].getStr());
+    TEST_ASSERT_EQUAL_STRING("b", ast[1U].getStr());
 
     /* Order: keyword, keyword, text */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "{a}{b}c"));
@@ -176,9 +181,9 @@ static void testTokenizer()
     TEST_ASSERT_EQUAL(TWToken::TYPE_KEYWORD, ast[0U].getType());
     TEST_ASSERT_EQUAL(TWToken::TYPE_KEYWORD, ast[1U].getType());
     TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[2U].getType());
-    TEST_ASSERT_EQUAL_STRING("{a}", ast[0U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("{b}", ast[1U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("c", ast[2U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("{a}", ast[0U].getStr());
+    TEST_ASSERT_EQUAL_STRING("{b}", ast[1U].getStr());
+    TEST_ASSERT_EQUAL_STRING("c", ast[2U].getStr());
 
     /* Order: keyword, text, keyword, text */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "{a}b{c}d"));
@@ -187,10 +192,10 @@ static void testTokenizer()
     TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[1U].getType());
     TEST_ASSERT_EQUAL(TWToken::TYPE_KEYWORD, ast[2U].getType());
     TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[3U].getType());
-    TEST_ASSERT_EQUAL_STRING("{a}", ast[0U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("b", ast[1U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("{c}", ast[2U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("d", ast[3U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("{a}", ast[0U].getStr());
+    TEST_ASSERT_EQUAL_STRING("b", ast[1U].getStr());
+    TEST_ASSERT_EQUAL_STRING("{c}", ast[2U].getStr());
+    TEST_ASSERT_EQUAL_STRING("d", ast[3U].getStr());
 
     /* Order: keyword, text, line feed, keyword, text */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "{a}b\n{c}d"));
@@ -200,11 +205,11 @@ static void testTokenizer()
     TEST_ASSERT_EQUAL(TWToken::TYPE_LINE_FEED, ast[2U].getType());
     TEST_ASSERT_EQUAL(TWToken::TYPE_KEYWORD, ast[3U].getType());
     TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[4U].getType());
-    TEST_ASSERT_EQUAL_STRING("{a}", ast[0U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("b", ast[1U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("\n", ast[2U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("{c}", ast[3U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("d", ast[4U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("{a}", ast[0U].getStr());
+    TEST_ASSERT_EQUAL_STRING("b", ast[1U].getStr());
+    TEST_ASSERT_EQUAL_STRING("\n", ast[2U].getStr());
+    TEST_ASSERT_EQUAL_STRING("{c}", ast[3U].getStr());
+    TEST_ASSERT_EQUAL_STRING("d", ast[4U].getStr());
 
     /* Text move operator */
     TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "a{b}"));
@@ -213,8 +218,38 @@ static void testTokenizer()
     ast2 = std::move(ast);
     TEST_ASSERT_EQUAL(0U, ast.length());
     TEST_ASSERT_EQUAL(2U, ast2.length());
-    TEST_ASSERT_EQUAL_STRING("a", ast2[0U].getStr().c_str());
-    TEST_ASSERT_EQUAL_STRING("{b}", ast2[1U].getStr().c_str());
+    TEST_ASSERT_EQUAL_STRING("a", ast2[0U].getStr());
+    TEST_ASSERT_EQUAL_STRING("{b}", ast2[1U].getStr());
+
+    /* Order: escaped text, keyword */
+    TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "a\\{{b}"));
+    TEST_ASSERT_EQUAL(2U, ast.length());
+    TEST_ASSERT_EQUAL(TWToken::TYPE_TEXT, ast[0U].getType());
+    TEST_ASSERT_EQUAL(TWToken::TYPE_KEYWORD, ast[1U].getType());
+    TEST_ASSERT_EQUAL_STRING("a{", ast[0U].getStr());
+    TEST_ASSERT_EQUAL(2U, ast[0U].getLength());
+    TEST_ASSERT_EQUAL_STRING("{b}", ast[1U].getStr());
+
+    /* Text copy operator, the copy shall not refer to the strings of the origin. */
+    ast2 = ast;
+    TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "{c}d"));
+    TEST_ASSERT_EQUAL(2U, ast2.length());
+    TEST_ASSERT_EQUAL_STRING("a{", ast2[0U].getStr());
+    TEST_ASSERT_EQUAL_STRING("{b}", ast2[1U].getStr());
+
+    /* Same format with other text reuses the token strings memory. */
+    TEST_ASSERT_EQUAL(true, tokenizer.parse(ast, "{c}e"));
+    TEST_ASSERT_EQUAL(2U, ast.length());
+    TEST_ASSERT_EQUAL_STRING("{c}", ast[0U].getStr());
+    TEST_ASSERT_EQUAL_STRING("e", ast[1U].getStr());
+
+    /* Set token string in place and appended. */
+    TEST_ASSERT_EQUAL(true, ast.setTokenStr(0U, "f", 1U));
+    TEST_ASSERT_EQUAL(true, ast.setTokenStr(1U, "ghijklmnopqrstuvwxyz", 20U));
+    TEST_ASSERT_EQUAL(false, ast.setTokenStr(2U, "f", 1U));
+    TEST_ASSERT_EQUAL_STRING("f", ast[0U].getStr());
+    TEST_ASSERT_EQUAL_STRING("ghijklmnopqrstuvwxyz", ast[1U].getStr());
+    TEST_ASSERT_EQUAL(20U, ast[1U].getLength());
 }
 
 /**
@@ -309,3 +344,154 @@ static void testTextWidget()
     textWidget.setFormatStr("{0x41} Hello World!");
     TEST_ASSERT_EQUAL_STRING("A Hello World!", textWidget.getStr().c_str());
 }
+
+/**
+ * Test the text layout, which is reused over several paints.
+ */
+static void testTextLayout()
+{
+    YAGfxTest       testGfx;
+    YAGfxTest       expectedGfx;
+    TextWidget      textWidget(YAGfxTest::WIDTH, YAGfxTest::HEIGHT);
+    YAGfxSolidBrush brushA(ColorDef::WHITE);
+    YAGfxSolidBrush brushB(ColorDef::RED);
+    YAGfxText       expectedText(TextWidget::DEFAULT_FONT, brushA);
+    int16_t         cursorY = TextWidget::DEFAULT_FONT.getHeight() - 1;
+    int16_t         x       = 0;
+    int16_t         y       = 0;
+
+    /* Show text immediately. */
+    textWidget.disableFadeEffect();
+    textWidget.setFormatStr("A{#FF0000}B");
+
+    /* Text with the color of the default solid brush and the color of the keyword. */
+    testGfx.fill(ColorDef::BLACK);
+    textWidget.update(testGfx);
+
+    expectedGfx.fill(ColorDef::BLACK);
+    expectedText.setTextCursorPos(0, cursorY);
+    expectedText.drawText(expectedGfx, "A");
+    expectedText.setBrush(brushB);
+    expectedText.drawText(expectedGfx, "B");
+
+    for (y = 0; y < YAGfxTest::HEIGHT; ++y)
+    {
+        for (x = 0; x < YAGfxTest::WIDTH; ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT32(expectedGfx.getColor(x, y), testGfx.getColor(x, y));
+        }
+    }
+
+    /* Changing the solid brush shall influence only the text, which is not
+     * colored by keyword.
+     */
+    textWidget.setSolidBrush(ColorDef::GREEN);
+    testGfx.fill(ColorDef::BLACK);
+    textWidget.update(testGfx);
+
+    brushA.setColor(ColorDef::GREEN);
+    expectedGfx.fill(ColorDef::BLACK);
+    expectedText.setBrush(brushA);
+    expectedText.setTextCursorPos(0, cursorY);
+    expectedText.drawText(expectedGfx, "A");
+    expectedText.setBrush(brushB);
+    expectedText.drawText(expectedGfx, "B");
+
+    for (y = 0; y < YAGfxTest::HEIGHT; ++y)
+    {
+        for (x = 0; x < YAGfxTest::WIDTH; ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT32(expectedGfx.getColor(x, y), testGfx.getColor(x, y));
+        }
+    }
+}
+
+/**
+ * Test the scroll strip, which must show the same as the directly drawn text.
+ */
+static void testScrollStrip()
+{
+    TextWidget     textWidget(YAGfxTest::WIDTH, YAGfxTest::HEIGHT);
+    const uint32_t SCROLL_STEPS = 8U;
+
+    /* Scroll as fast as possible to keep the test short. */
+    TEST_ASSERT_TRUE(TextWidget::setScrollPause(TextWidget::MIN_SCROLL_PAUSE));
+
+    /* Show text immediately. The text is wider than the drawing area and scrolls. */
+    textWidget.disableFadeEffect();
+    textWidget.enableScrollStrip();
+    textWidget.setFormatStr("Hello {#FF0000}World!");
+
+    /* Text with solid colors is copied from the scroll strip. */
+    verifyScrollStrip(textWidget, SCROLL_STEPS);
+
+    /* Changing the solid brush shall render the scroll strip again. */
+    textWidget.setSolidBrush(ColorDef::GREEN);
+    verifyScrollStrip(textWidget, SCROLL_STEPS);
+
+    /* Text with a linear gradient depends on the absolute position and
+     * is drawn directly.
+     */
+    textWidget.setLinearGradientBrush(ColorDef::RED, ColorDef::BLUE, 0U, YAGfxTest::WIDTH, false);
+    verifyScrollStrip(textWidget, SCROLL_STEPS);
+
+    TEST_ASSERT_TRUE(TextWidget::setScrollPause(TextWidget::DEFAULT_SCROLL_PAUSE));
+}
+
+/**
+ * Paint the text widget with scroll strip and a copy of it without scroll
+ * strip, until the text scrolled the given number of steps. Every frame of
+ * both must be equal.
+ *
+ * @param[in] widget    Text widget with enabled scroll strip
+ * @param[in] steps     Number of scroll steps
+ */
+static void verifyScrollStrip(TextWidget& widget, uint32_t steps)
+{
+    const unsigned long TIMEOUT   = 10000U; /* ms */
+    YAGfxTest           stripGfx;
+    YAGfxTest           directGfx;
+    YAGfxTest           previousGfx;
+    uint32_t            stepCnt   = 0U;
+    unsigned long       timestamp = millis();
+    int16_t             x         = 0;
+    int16_t             y         = 0;
+
+    while ((steps > stepCnt) && (TIMEOUT > (millis() - timestamp)))
+    {
+        /* The copy has the same state and draws the same frame. Scrolling
+         * happens after drawing, therefore the frames are comparable.
+         */
+        TextWidget directWidget(widget);
+        bool       isChanged = false;
+
+        directWidget.disableScrollStrip();
+
+        stripGfx.fill(ColorDef::BLACK);
+        widget.update(stripGfx);
+
+        directGfx.fill(ColorDef::BLACK);
+        directWidget.update(directGfx);
+
+        for (y = 0; y < YAGfxTest::HEIGHT; ++y)
+        {
+            for (x = 0; x < YAGfxTest::WIDTH; ++x)
+            {
+                TEST_ASSERT_EQUAL_UINT32(directGfx.getColor(x, y), stripGfx.getColor(x, y));
+
+                if (static_cast<uint32_t>(previousGfx.getColor(x, y)) != static_cast<uint32_t>(stripGfx.getColor(x, y)))
+                {
+                    previousGfx.getColor(x, y) = stripGfx.getColor(x, y);
+                    isChanged                  = true;
+                }
+            }
+        }
+
+        if (true == isChanged)
+        {
+            ++stepCnt;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(steps, stepCnt);
+}
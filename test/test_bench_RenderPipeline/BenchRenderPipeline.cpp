@@ -0,0 +1,745 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @file   BenchRenderPipeline.cpp
+ * @brief  Benchmark of the render pipeline on the native host.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * Every benchmark measures the average runtime and the number of heap
+ * allocations per frame. The results are printed and written as JSON
+ * to BENCH_OUTPUT_FILE, which allows to compare them between two builds.
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <unity.h>
+#include <Util.h>
+#include <YAGfxBitmap.h>
+#include <TextWidget.h>
+#include <GifImgPlayer.h>
+#include <LzwDecoder.h>
+#include <FadeEffectController.h>
+#include <DoubleFrameBuffer.h>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+#ifndef BENCH_OUTPUT_FILE
+
+/** Path to the JSON file, where the benchmark results are written to. */
+#define BENCH_OUTPUT_FILE   "./bench_render_pipeline.json"
+
+#endif  /* BENCH_OUTPUT_FILE */
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Result of a single benchmark run.
+ */
+typedef struct
+{
+    const char* name;           /**< Name of the measured function. */
+    uint16_t    width;          /**< Display width in pixels. */
+    uint16_t    height;         /**< Display height in pixels. */
+    uint32_t    frames;         /**< Number of measured frames. */
+    uint64_t    durationNs;     /**< Overall runtime in ns. */
+    uint64_t    allocations;    /**< Overall number of heap allocations. */
+
+} BenchResult;
+
+/**
+ * Display resolution, used for a benchmark run.
+ */
+typedef struct
+{
+    uint16_t    width;  /**< Width in pixels. */
+    uint16_t    height; /**< Height in pixels. */
+
+} Resolution;
+
+/**
+ * GIF loader, which reads from a memory buffer without touching the filesystem.
+ * This keeps the file I/O out of the GIF image player measurement.
+ */
+class BenchGifLoader : public IGifLoader
+{
+public:
+
+    /**
+     * Construct the loader.
+     *
+     * @param[in] data  GIF file data
+     * @param[in] size  GIF file size in bytes
+     */
+    BenchGifLoader(const uint8_t* data, size_t size) :
+        IGifLoader(),
+        m_data(data),
+        m_size(size),
+        m_pos(0U),
+        m_isOpen(false)
+    {
+    }
+
+    /**
+     * Destroy the loader.
+     */
+    ~BenchGifLoader() override
+    {
+    }
+
+    /**
+     * Open the GIF file. The filesystem and the file name are ignored.
+     *
+     * @param[in] fs        Filesystem to use
+     * @param[in] fileName  Name of the GIF file.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool open(FS& fs, const String& fileName) final
+    {
+        UTIL_NOT_USED(fs);
+        UTIL_NOT_USED(fileName);
+
+        m_pos    = 0U;
+        m_isOpen = (nullptr != m_data);
+
+        return m_isOpen;
+    }
+
+    /**
+     * Close the GIF file.
+     */
+    void close() final
+    {
+        m_isOpen = false;
+    }
+
+    /**
+     * Read data from GIF.
+     *
+     * @param[in] buffer    Buffer to fill.
+     * @param[in] size      Buffer size in bytes.
+     *
+     * @return If successful read, it will return true otherwise false.
+     */
+    bool read(void* buffer, size_t size) final
+    {
+        bool isSuccessful = false;
+
+        if ((true == m_isOpen) &&
+            (m_size >= (m_pos + size)))
+        {
+            memcpy(buffer, &m_data[m_pos], size);
+            m_pos        += size;
+            isSuccessful  = true;
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Get file position.
+     *
+     * @return File position
+     */
+    size_t position() final
+    {
+        return m_pos;
+    }
+
+    /**
+     * Set file position.
+     *
+     * @param[in] position  File position to set
+     * @param[in] mode      The seek mode.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool seek(size_t position, SeekMode mode) final
+    {
+        bool    isSuccessful    = false;
+        size_t  newPos          = position;
+
+        if (SeekCur == mode)
+        {
+            newPos = m_pos + position;
+        }
+        else if (SeekEnd == mode)
+        {
+            newPos = m_size - position;
+        }
+        else
+        {
+            ;
+        }
+
+        if (m_size >= newPos)
+        {
+            m_pos        = newPos;
+            isSuccessful = true;
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * If file is opened, it will return true otherwise false.
+     *
+     * @return File status
+     */
+    operator bool() const final
+    {
+        return m_isOpen;
+    }
+
+private:
+
+    const uint8_t*  m_data;     /**< GIF file data */
+    size_t          m_size;     /**< GIF file size in bytes */
+    size_t          m_pos;      /**< Current read position */
+    bool            m_isOpen;   /**< Is file opened? */
+
+    BenchGifLoader(const BenchGifLoader& other);
+    BenchGifLoader& operator=(const BenchGifLoader& other);
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void benchDisplayMgrUpdate();
+static void benchFadeEffectControllerUpdate();
+static void benchTextWidgetPaint();
+static void benchGifImgPlayerPlay();
+static void benchLzwDecoderDecode();
+static void benchLzwDecoderDecodeBlock();
+
+template < typename TFunc >
+static void measure(const char* name, const Resolution& resolution, uint32_t frames, TFunc frame);
+static bool writeResults(const char* fileName);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Display resolutions, which are benchmarked. */
+static const Resolution     RESOLUTIONS[] =
+{
+    { 32U,  8U },
+    { 32U, 16U },
+    { 64U, 64U }
+};
+
+/** Number of frames per benchmark run. */
+static const uint32_t       FRAMES              = 2000U;
+
+/** Scrolling text, which is used for the text related benchmarks. */
+static const char*          SCROLLING_TEXT      = "{#FF00FF}Hello {#00FF00}World! This text is long enough to scroll on every panel.";
+
+/** GIF animation, which is used for the GIF image player benchmark. */
+static const char*          GIF_FILE_NAME       = "./test/test_GifImgPlayer/TestAnimation.gif";
+
+/** LZW encoded input data with a min. code length of 2 bits. See test_LzwDecoder. */
+static const uint8_t        LZW_INPUT_DATA[]    =
+{
+    0x8C, 0x2D, 0x99, 0x87, 0x2A, 0x1C, 0xDC, 0x33, 0xA0, 0x02, 0x75, 0xEC, 0x95, 0xFA, 0xA8, 0xDE, 0x60, 0x8C, 0x04, 0x91, 0x4C, 0x01
+};
+
+/** Number of decoded indices of the LZW input data. */
+static const size_t         LZW_OUTPUT_SIZE     = 100U;
+
+/** Max. number of benchmark results. */
+static const size_t         MAX_RESULTS         = 32U;
+
+/** Benchmark results. */
+static BenchResult          gResults[MAX_RESULTS];
+
+/** Number of benchmark results. */
+static size_t               gResultCount        = 0U;
+
+/** Number of heap allocations via operator new. */
+static uint64_t             gAllocationCounter  = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Allocate memory and count the allocation.
+ *
+ * @param[in] size  Size in bytes
+ *
+ * @return Allocated memory
+ */
+void* operator new(size_t size)
+{
+    void* ptr = malloc((0U == size) ? 1U : size);
+
+    if (nullptr == ptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    ++gAllocationCounter;
+
+    return ptr;
+}
+
+/**
+ * Allocate memory and count the allocation.
+ *
+ * @param[in] size  Size in bytes
+ *
+ * @return Allocated memory
+ */
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+/**
+ * Release memory.
+ *
+ * @param[in] ptr   Memory to release
+ */
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+/**
+ * Release memory.
+ *
+ * @param[in] ptr   Memory to release
+ */
+void operator delete[](void* ptr) noexcept
+{
+    free(ptr);
+}
+
+/**
+ * Main entry point
+ *
+ * @param[in] argc  Number of command line arguments
+ * @param[in] argv  Command line arguments
+ */
+extern int main(int argc, char** argv)
+{
+    UTIL_NOT_USED(argc);
+    UTIL_NOT_USED(argv);
+
+    UNITY_BEGIN();
+
+    RUN_TEST(benchDisplayMgrUpdate);
+    RUN_TEST(benchFadeEffectControllerUpdate);
+    RUN_TEST(benchTextWidgetPaint);
+    RUN_TEST(benchGifImgPlayerPlay);
+    RUN_TEST(benchLzwDecoderDecode);
+    RUN_TEST(benchLzwDecoderDecodeBlock);
+
+    if (false == writeResults(BENCH_OUTPUT_FILE))
+    {
+        printf("Failed to write benchmark results to %s.\n", BENCH_OUTPUT_FILE);
+    }
+
+    return UNITY_END();
+}
+
+/**
+ * Setup a test. This function will be called before every test by unity.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test. This function will be called after every test by unity.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Benchmark a complete display frame, like DisplayMgr::update() does it:
+ * the active plugin draws into the selected framebuffer and the fade effect
+ * controller transfers it to the display.
+ *
+ * The DisplayMgr itself depends on FreeRTOS and the HAL, therefore its
+ * update sequence is rebuilt here with the same components.
+ */
+static void benchDisplayMgrUpdate()
+{
+    size_t idx;
+
+    for (idx = 0U; idx < UTIL_ARRAY_NUM(RESOLUTIONS); ++idx)
+    {
+        const Resolution&       resolution = RESOLUTIONS[idx];
+        DoubleFrameBuffer       doubleFrameBuffer;
+        FadeEffectController    fadeEffectController(doubleFrameBuffer);
+        YAGfxDynamicBitmap      display;
+        TextWidget              textWidget(resolution.width, resolution.height);
+
+        TEST_ASSERT_TRUE(doubleFrameBuffer.create(resolution.width, resolution.height));
+        TEST_ASSERT_TRUE(display.create(resolution.width, resolution.height));
+
+        fadeEffectController.selectFadeEffect(FadeEffectController::FADE_EFFECT_NONE);
+        textWidget.setFormatStr(SCROLLING_TEXT);
+
+        measure("DisplayMgr::update", resolution, FRAMES,
+            [&]()
+            {
+                YAGfxDynamicBitmap& selectedFrameBuffer = doubleFrameBuffer.getSelectedFramebuffer();
+
+                selectedFrameBuffer.fillScreen(ColorDef::BLACK);
+                textWidget.update(selectedFrameBuffer);
+                fadeEffectController.update(display);
+            });
+    }
+}
+
+/**
+ * Benchmark the fade effect controller with the linear fade effect, which
+ * is permanently restarted.
+ */
+static void benchFadeEffectControllerUpdate()
+{
+    size_t idx;
+
+    for (idx = 0U; idx < UTIL_ARRAY_NUM(RESOLUTIONS); ++idx)
+    {
+        const Resolution&       resolution = RESOLUTIONS[idx];
+        DoubleFrameBuffer       doubleFrameBuffer;
+        FadeEffectController    fadeEffectController(doubleFrameBuffer);
+        YAGfxDynamicBitmap      display;
+
+        TEST_ASSERT_TRUE(doubleFrameBuffer.create(resolution.width, resolution.height));
+        TEST_ASSERT_TRUE(display.create(resolution.width, resolution.height));
+
+        /* The fade effect is changed only in idle state. */
+        fadeEffectController.selectFadeEffect(FadeEffectController::FADE_EFFECT_LINEAR);
+        fadeEffectController.update(display);
+
+        doubleFrameBuffer.getSelectedFramebuffer().fillScreen(ColorDef::RED);
+        doubleFrameBuffer.getPreviousFramebuffer().fillScreen(ColorDef::BLUE);
+
+        measure("FadeEffectController::update", resolution, FRAMES,
+            [&]()
+            {
+                if (false == fadeEffectController.isRunning())
+                {
+                    fadeEffectController.start();
+                }
+
+                fadeEffectController.update(display);
+            });
+    }
+}
+
+/**
+ * Benchmark the text widget with a scrolling text.
+ */
+static void benchTextWidgetPaint()
+{
+    size_t idx;
+
+    for (idx = 0U; idx < UTIL_ARRAY_NUM(RESOLUTIONS); ++idx)
+    {
+        const Resolution&   resolution = RESOLUTIONS[idx];
+        YAGfxDynamicBitmap  canvas;
+        TextWidget          textWidget(resolution.width, resolution.height);
+
+        TEST_ASSERT_TRUE(canvas.create(resolution.width, resolution.height));
+
+        textWidget.setFormatStr(SCROLLING_TEXT);
+
+        /* The new text is prepared in the first paint call. */
+        textWidget.update(canvas);
+
+        measure("TextWidget::paint", resolution, FRAMES,
+            [&]()
+            {
+                textWidget.update(canvas);
+            });
+    }
+}
+
+/**
+ * Benchmark the GIF image player. Every frame opens the animation and
+ * decodes its first scene, which covers the parsing, the LZW decoding and
+ * the drawing.
+ */
+static void benchGifImgPlayerPlay()
+{
+    FS      fileSystem;
+    File    fd          = fileSystem.open(GIF_FILE_NAME);
+    size_t  fileSize    = 0U;
+    uint8_t fileData[1024U];
+    size_t  idx;
+
+    TEST_ASSERT_TRUE(fd);
+    fileSize = fd.size();
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(fileData), fileSize);
+    TEST_ASSERT_EQUAL(fileSize, fd.read(fileData, fileSize));
+    fd.close();
+
+    for (idx = 0U; idx < UTIL_ARRAY_NUM(RESOLUTIONS); ++idx)
+    {
+        const Resolution&   resolution = RESOLUTIONS[idx];
+        YAGfxDynamicBitmap  canvas;
+        BenchGifLoader      gifLoader(fileData, fileSize);
+        GifImgPlayer        gifImgPlayer;
+
+        TEST_ASSERT_TRUE(canvas.create(resolution.width, resolution.height));
+
+        measure("GifImgPlayer::play", resolution, FRAMES,
+            [&]()
+            {
+                TEST_ASSERT_EQUAL(GifImgPlayer::RET_OK, gifImgPlayer.open(fileSystem, GIF_FILE_NAME, gifLoader));
+                TEST_ASSERT_TRUE(gifImgPlayer.play(canvas));
+                gifImgPlayer.close();
+            });
+    }
+}
+
+/**
+ * Benchmark the LZW decoder. The decoder doesn't depend on the display
+ * resolution, therefore the resolution is only used to scale the number
+ * of decoded images per frame to the number of pixels.
+ */
+static void benchLzwDecoderDecode()
+{
+    size_t idx;
+
+    for (idx = 0U; idx < UTIL_ARRAY_NUM(RESOLUTIONS); ++idx)
+    {
+        const Resolution&   resolution  = RESOLUTIONS[idx];
+        const uint32_t      IMAGES      = (resolution.width * resolution.height + LZW_OUTPUT_SIZE - 1U) / LZW_OUTPUT_SIZE;
+        LzwDecoder          lzwDecoder;
+
+        measure("LzwDecoder::decode", resolution, FRAMES,
+            [&]()
+            {
+                uint32_t image;
+
+                for (image = 0U; image < IMAGES; ++image)
+                {
+                    size_t  srcIndex = 0U;
+                    size_t  dstIndex = 0U;
+
+                    lzwDecoder.init(2U);
+
+                    TEST_ASSERT_TRUE(lzwDecoder.decode(
+                        [&srcIndex](uint8_t& data) -> bool
+                        {
+                            bool isSuccessful = false;
+
+                            if (sizeof(LZW_INPUT_DATA) > srcIndex)
+                            {
+                                data = LZW_INPUT_DATA[srcIndex];
+                                ++srcIndex;
+
+                                isSuccessful = true;
+                            }
+
+                            return isSuccessful;
+                        },
+                        [&dstIndex](uint8_t data) -> bool
+                        {
+                            UTIL_NOT_USED(data);
+                            ++dstIndex;
+
+                            return true;
+                        }
+                    ));
+
+                    lzwDecoder.deInit();
+
+                    TEST_ASSERT_EQUAL(LZW_OUTPUT_SIZE, dstIndex);
+                }
+            });
+    }
+}
+
+/**
+ * Benchmark the block oriented LZW decoder, see benchLzwDecoderDecode().
+ */
+static void benchLzwDecoderDecodeBlock()
+{
+    size_t idx;
+
+    for (idx = 0U; idx < UTIL_ARRAY_NUM(RESOLUTIONS); ++idx)
+    {
+        const Resolution&   resolution  = RESOLUTIONS[idx];
+        const uint32_t      IMAGES      = (resolution.width * resolution.height + LZW_OUTPUT_SIZE - 1U) / LZW_OUTPUT_SIZE;
+        LzwDecoder          lzwDecoder;
+        uint8_t             output[LZW_OUTPUT_SIZE];
+
+        measure("LzwDecoder::decode (block)", resolution, FRAMES,
+            [&]()
+            {
+                uint32_t image;
+
+                for (image = 0U; image < IMAGES; ++image)
+                {
+                    size_t              inputUsed   = 0U;
+                    size_t              outputUsed  = 0U;
+                    LzwDecoder::Status  status;
+
+                    lzwDecoder.init(2U);
+
+                    status = lzwDecoder.decode(LZW_INPUT_DATA, sizeof(LZW_INPUT_DATA), inputUsed, output, sizeof(output), outputUsed);
+
+                    lzwDecoder.deInit();
+
+                    TEST_ASSERT_EQUAL(LzwDecoder::STATUS_END, status);
+                    TEST_ASSERT_EQUAL(LZW_OUTPUT_SIZE, outputUsed);
+                }
+            });
+    }
+}
+
+/**
+ * Measure the runtime and the heap allocations of a frame function and
+ * store the result.
+ *
+ * @tparam TFunc    Frame function type
+ *
+ * @param[in] name          Name of the measured function
+ * @param[in] resolution    Display resolution
+ * @param[in] frames        Number of frames
+ * @param[in] frame         Frame function, which is called once per frame.
+ */
+template < typename TFunc >
+static void measure(const char* name, const Resolution& resolution, uint32_t frames, TFunc frame)
+{
+    std::chrono::steady_clock::time_point   timestampBegin;
+    std::chrono::steady_clock::time_point   timestampEnd;
+    uint64_t                                allocationsBegin;
+    uint32_t                                run;
+    BenchResult                             result;
+
+    TEST_ASSERT_LESS_THAN(MAX_RESULTS, gResultCount);
+
+    allocationsBegin    = gAllocationCounter;
+    timestampBegin      = std::chrono::steady_clock::now();
+
+    for (run = 0U; run < frames; ++run)
+    {
+        frame();
+    }
+
+    timestampEnd = std::chrono::steady_clock::now();
+
+    result.name         = name;
+    result.width        = resolution.width;
+    result.height       = resolution.height;
+    result.frames       = frames;
+    result.durationNs   = std::chrono::duration_cast<std::chrono::nanoseconds>(timestampEnd - timestampBegin).count();
+    result.allocations  = gAllocationCounter - allocationsBegin;
+
+    printf("%-30s %2u x %2u: %8llu ns/frame, %6.2f allocations/frame\n",
+        result.name,
+        result.width,
+        result.height,
+        static_cast<unsigned long long>(result.durationNs / result.frames),
+        static_cast<double>(result.allocations) / result.frames);
+
+    gResults[gResultCount] = result;
+    ++gResultCount;
+}
+
+/**
+ * Write all benchmark results as JSON to a file.
+ *
+ * @param[in] fileName  Name of the JSON file
+ *
+ * @return If successful, it will return true otherwise false.
+ */
+static bool writeResults(const char* fileName)
+{
+    bool    isSuccessful    = false;
+    FILE*   fd              = fopen(fileName, "w");
+
+    if (nullptr != fd)
+    {
+        size_t idx;
+
+        fprintf(fd, "{\n    \"benchmarks\": [\n");
+
+        for (idx = 0U; idx < gResultCount; ++idx)
+        {
+            const BenchResult& result = gResults[idx];
+
+            fprintf(fd, "        { \"name\": \"%s\", \"width\": %u, \"height\": %u, \"frames\": %u, \"nsPerFrame\": %llu, \"allocationsPerFrame\": %.2f }%s\n",
+                result.name,
+                result.width,
+                result.height,
+                result.frames,
+                static_cast<unsigned long long>(result.durationNs / result.frames),
+                static_cast<double>(result.allocations) / result.frames,
+                ((idx + 1U) < gResultCount) ? "," : "");
+        }
+
+        fprintf(fd, "    ]\n}\n");
+        fclose(fd);
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}